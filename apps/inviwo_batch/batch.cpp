@@ -0,0 +1,444 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/processors/exporter.h>
+#include <inviwo/core/properties/property.h>
+#include <inviwo/core/util/localetools.h>
+#include <inviwo/core/util/consolelogger.h>
+#include <inviwo/core/util/logerrorcounter.h>
+#include <inviwo/core/util/commandlineparser.h>
+#include <inviwo/core/util/settings/systemsettings.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/exception.h>
+
+#include <inviwo/sys/moduleloading.h>
+
+#include <modules/json/jsonmodule.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+/**
+ * Modules that need a windowing system, an OpenGL/OpenCL context, or a GUI. Modules depending on
+ * any of these are disabled as well by registerModulesFiltered.
+ */
+constexpr std::array<std::string_view, 7> nonHeadlessModules{
+    "opengl", "opencl", "glfw", "qtwidgets", "sgct", "webbrowser", "python3qt"};
+
+/**
+ * A set of property values to evaluate the network for. The sweep file is a json object on the
+ * form
+ *     {"parameters": {"Processor.property": [value1, value2, ...], ...}}
+ * where each value is either passed to the property json converter directly, if it is an object,
+ * or wrapped as {"value": value}. The network is evaluated for every combination of values, with
+ * the last parameter varying fastest.
+ */
+struct Sweep {
+    std::vector<std::string> paths;
+    std::vector<std::vector<json>> values;
+
+    size_t size() const {
+        size_t count = 1;
+        for (const auto& list : values) count *= list.size();
+        return count;
+    }
+
+    std::vector<const json*> combination(size_t index) const {
+        std::vector<const json*> res(values.size());
+        for (size_t i = values.size(); i-- > 0;) {
+            res[i] = &values[i][index % values[i].size()];
+            index /= values[i].size();
+        }
+        return res;
+    }
+};
+
+Sweep loadSweep(const std::filesystem::path& file) {
+    Sweep sweep;
+    if (file.empty()) return sweep;
+
+    std::ifstream in(file);
+    if (!in) {
+        throw FileException(SourceContext{}, "Could not open sweep file {}", file);
+    }
+    const auto root = json::parse(in);
+    const auto wrap = [](const json& value) {
+        return value.is_object() ? value : json{{"value", value}};
+    };
+    for (const auto& [path, values] : root.at("parameters").items()) {
+        auto& list = sweep.values.emplace_back();
+        if (values.is_array()) {
+            for (const auto& value : values) list.push_back(wrap(value));
+        } else {
+            list.push_back(wrap(values));
+        }
+        if (list.empty()) {
+            throw Exception(SourceContext{}, "Sweep parameter '{}' has no values", path);
+        }
+        sweep.paths.push_back(path);
+    }
+    return sweep;
+}
+
+/**
+ * Wakes up the main thread when work is enqueued to the front, such that background jobs of
+ * PoolProcessors can finish without busy waiting.
+ */
+class FrontSignal {
+public:
+    void notify() {
+        {
+            const std::scoped_lock lock{mutex_};
+            pending_ = true;
+        }
+        cv_.notify_one();
+    }
+    void wait() {
+        std::unique_lock lock{mutex_};
+        cv_.wait_for(lock, std::chrono::milliseconds{50}, [&]() { return pending_; });
+        pending_ = false;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool pending_ = false;
+};
+
+void waitForNetwork(InviwoApplication& app, FrontSignal& signal) {
+    app.processFront();
+    while (app.getProcessorNetwork()->runningBackgroundJobs() > 0) {
+        signal.wait();
+        app.processFront();
+    }
+}
+
+std::string quoteArg(std::string_view arg) {
+    std::string res;
+#ifdef WIN32
+    res.push_back('"');
+    for (auto c : arg) {
+        if (c == '"') res.push_back('\\');
+        res.push_back(c);
+    }
+    res.push_back('"');
+#else
+    res.push_back('\'');
+    for (auto c : arg) {
+        if (c == '\'') {
+            res.append("'\\''");
+        } else {
+            res.push_back(c);
+        }
+    }
+    res.push_back('\'');
+#endif
+    return res;
+}
+
+std::filesystem::path timingsFile(const std::filesystem::path& output, size_t shard,
+                                  size_t shards) {
+    return shards > 1 ? output / fmt::format("timings-{}.csv", shard) : output / "timings.csv";
+}
+
+constexpr std::string_view timingsHeader = "run,evaluate_ms,export_ms,files,warnings,errors";
+
+/**
+ * Evaluate the network for every combination of the sweep that belongs to this shard, i.e. run
+ * indices where `run % shards == shard`, and export all Exporter and DataExporter processors
+ * into `output/run-XXXX/`.
+ * @return the number of failed runs
+ */
+size_t runSweep(InviwoApplication& app, FrontSignal& signal, LogErrorCounter& counter,
+                const Sweep& sweep, const std::filesystem::path& output,
+                const std::vector<FileExtension>& extensions, size_t shard, size_t shards) {
+    auto* network = app.getProcessorNetwork();
+    const auto& converter =
+        app.getModuleManager().getModuleByType<JSONModule>()->getJSONPropertyConverter();
+
+    std::ofstream timings(timingsFile(output, shard, shards));
+    timings << timingsHeader << '\n';
+
+    const Clock total;
+    size_t runs = 0;
+    size_t failed = 0;
+    for (size_t run = shard; run < sweep.size(); run += shards, ++runs) {
+        const auto dir = output / fmt::format("run-{:04}", run);
+        counter.reset();
+        Clock clock;
+        double evaluateMs = 0.0;
+        double exportMs = 0.0;
+        size_t files = 0;
+        try {
+            const auto values = sweep.combination(run);
+            json parameters = json::object();
+            {
+                const NetworkLock lock{network};
+                for (size_t i = 0; i < values.size(); ++i) {
+                    auto* property = network->getProperty(sweep.paths[i]);
+                    if (!property) {
+                        throw Exception(SourceContext{}, "Could not find property '{}'",
+                                        sweep.paths[i]);
+                    }
+                    converter.fromJSON(*values[i], *property);
+                    parameters[sweep.paths[i]] = *values[i];
+                }
+            }
+            waitForNetwork(app, signal);
+            evaluateMs = clock.getElapsedMilliseconds();
+
+            clock.reset();
+            clock.start();
+            std::filesystem::create_directories(dir);
+            std::ofstream{dir / "parameters.json"} << parameters.dump(4);
+            files = util::exportAllFiles(*network, dir, "UPN", extensions, Overwrite::Yes).size();
+            files +=
+                util::exportAllDataFiles(*network, dir, "UPN", extensions, Overwrite::Yes).size();
+            exportMs = clock.getElapsedMilliseconds();
+        } catch (const Exception& e) {
+            log::exception(e, "Run {} failed: {}", run, e.getMessage());
+        } catch (const std::exception& e) {
+            log::error("Run {} failed: {}", run, e.what());
+        }
+        if (counter.getErrorCount() > 0) ++failed;
+
+        log::info("Run {:4} evaluate {:9.2f} ms export {:9.2f} ms {} files", run, evaluateMs,
+                  exportMs, files);
+        timings << fmt::format("{},{:.3f},{:.3f},{},{},{}\n", run, evaluateMs, exportMs, files,
+                               counter.getWarnCount(), counter.getErrorCount());
+    }
+    log::info("Evaluated {} runs in {:.2f} s, {} failed", runs, total.getElapsedSeconds(), failed);
+    return failed;
+}
+
+/**
+ * Launch @p jobs worker processes of this executable with the same arguments, each with a shard of
+ * the sweep, then merge their timing reports into `output/timings.csv`.
+ * Separate processes are used since an InviwoApplication, and the front queue that PoolProcessors
+ * report back to, is shared by all networks within a process.
+ */
+int runWorkers(const CommandLineParser& cmdParser, size_t jobs,
+               const std::filesystem::path& output) {
+    std::string command = quoteArg(filesystem::getExecutablePath().string());
+    const auto& args = cmdParser.getArgs();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "-j" || args[i] == "--jobs") {
+            ++i;
+        } else if (!args[i].starts_with("--jobs=")) {
+            command.append(" ").append(quoteArg(args[i]));
+        }
+    }
+
+    std::vector<int> results(jobs, 0);
+    {
+        std::vector<std::jthread> workers;
+        for (size_t shard = 0; shard < jobs; ++shard) {
+            workers.emplace_back([&, shard]() {
+                auto cmd = fmt::format("{} --shard {} --shards {}", command, shard, jobs);
+                if (const auto& ignored = cmdParser.getIgnoredArgs(); !ignored.empty()) {
+                    cmd.append(" --");
+                    for (const auto& arg : ignored) cmd.append(" ").append(quoteArg(arg));
+                }
+#ifdef WIN32
+                // cmd.exe strips the outer quotes of the command line
+                cmd = fmt::format("\"{}\"", cmd);
+#endif
+                results[shard] = std::system(cmd.c_str());
+            });
+        }
+    }
+
+    std::vector<std::pair<size_t, std::string>> lines;
+    for (size_t shard = 0; shard < jobs; ++shard) {
+        const auto file = timingsFile(output, shard, jobs);
+        std::ifstream in(file);
+        std::string line;
+        std::getline(in, line);  // header
+        while (std::getline(in, line)) {
+            if (line.empty()) continue;
+            lines.emplace_back(std::stoull(line.substr(0, line.find(','))), line);
+        }
+        in.close();
+        std::error_code ec;
+        std::filesystem::remove(file, ec);
+    }
+    std::ranges::sort(lines);
+
+    std::ofstream timings(output / "timings.csv");
+    timings << timingsHeader << '\n';
+    for (const auto& [run, line] : lines) timings << line << '\n';
+
+    const auto failedWorkers = std::ranges::count_if(results, [](int res) { return res != 0; });
+    log::info("{} runs completed by {} workers, timings written to {}", lines.size(), jobs,
+              output / "timings.csv");
+    return failedWorkers == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    inviwo::util::configureCodePage();
+
+    inviwo::LogCentral logger;
+    inviwo::LogCentral::init(&logger);
+    auto consoleLogger = std::make_shared<inviwo::ConsoleLogger>();
+    logger.registerLogger(consoleLogger);
+    auto logCounter = std::make_shared<inviwo::LogErrorCounter>();
+    logger.registerLogger(logCounter);
+
+    InviwoApplication inviwoApp(argc, argv, "Inviwo-Batch");
+    inviwoApp.printApplicationInfo();
+
+    FrontSignal frontSignal;
+    inviwoApp.setPostEnqueueFront([&]() { frontSignal.notify(); });
+
+    auto& cmdParser = inviwoApp.getCommandLineParser();
+
+    // Only load modules that work without a GPU or a windowing system
+    const auto filter = [envFilter = inviwo::util::makeEnvironmentModuleFilter()](
+                            const inviwo::ModuleContainer& m) {
+        return std::ranges::contains(nonHeadlessModules, m.identifier()) || envFilter(m);
+    };
+    const auto progressCallback = [&](std::string_view s) { inviwo::log::info("{}", s); };
+    inviwo::util::registerModulesFiltered(inviwoApp.getModuleManager(), filter, progressCallback,
+                                          inviwoApp.getSystemSettings().moduleSearchPaths_.get(),
+                                          cmdParser.getModuleSearchPaths());
+
+    TCLAP::ValueArg<std::string> sweepArg(
+        "", "sweep", "Json file with property values to evaluate the network for", false, "",
+        "sweep file");
+    TCLAP::ValueArg<size_t> jobsArg(
+        "j", "jobs", "Number of network instances to evaluate in parallel, one per process",
+        false, 1, "count");
+    TCLAP::MultiArg<std::string> extensionArg(
+        "e", "extension",
+        "Preferred file extensions for exported data, otherwise the extension selected in each "
+        "export processor is used",
+        false, "extension");
+    TCLAP::ValueArg<size_t> shardArg("", "shard", "Index of this worker process (internal)",
+                                     false, 0, "index");
+    TCLAP::ValueArg<size_t> shardsArg("", "shards", "Number of worker processes (internal)", false,
+                                      1, "count");
+    cmdParser.add(&sweepArg);
+    cmdParser.add(&jobsArg);
+    cmdParser.add(&extensionArg);
+    cmdParser.add(&shardArg);
+    cmdParser.add(&shardsArg);
+
+    // Do this after registerModules if some arguments were added
+    cmdParser.parse();
+
+    if (!cmdParser.getLoadWorkspaceFromArg()) {
+        log::error("No workspace given, specify one with --workspace");
+        return 1;
+    }
+
+    const auto output = cmdParser.getOutputPath().empty() ? filesystem::getWorkingDirectory()
+                                                          : cmdParser.getOutputPath();
+    std::filesystem::create_directories(output);
+
+    Sweep sweep;
+    try {
+        sweep = loadSweep(sweepArg.getValue());
+    } catch (const Exception& e) {
+        log::exception(e);
+        return 1;
+    } catch (const std::exception& e) {
+        log::error("Unable to read sweep file {}: {}", sweepArg.getValue(), e.what());
+        return 1;
+    }
+
+    const auto jobs = std::clamp<size_t>(jobsArg.getValue(), 1, sweep.size());
+    if (jobs > 1 && shardsArg.getValue() == 1) {
+        return runWorkers(cmdParser, jobs, output);
+    }
+    const auto shards = std::max<size_t>(shardsArg.getValue(), 1);
+    const auto shard = shardArg.getValue();
+
+    // Share the cores between the worker processes
+    const auto cores = static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency()));
+    inviwoApp.resizePool(std::max<size_t>(cores / shards, 1));
+
+    const auto workspace = cmdParser.getWorkspacePath();
+    try {
+        const NetworkLock lock{inviwoApp.getProcessorNetwork()};
+        inviwoApp.getWorkspaceManager()->load(workspace, [&](SourceContext) {
+            try {
+                throw;
+            } catch (const IgnoreException& e) {
+                log::exception(e, "Incomplete network loading {} due to {}", workspace,
+                               e.getMessage());
+            }
+        });
+    } catch (const AbortException& e) {
+        log::exception(e, "Unable to load network {} due to {}", workspace, e.getMessage());
+        return 1;
+    } catch (const IgnoreException& e) {
+        log::exception(e, "Incomplete network loading {} due to {}", workspace, e.getMessage());
+        return 1;
+    }
+    waitForNetwork(inviwoApp, frontSignal);
+
+    cmdParser.processCallbacks();  // run any command line callbacks from modules.
+
+    std::vector<FileExtension> extensions;
+    std::ranges::transform(extensionArg.getValue(), std::back_inserter(extensions),
+                           [](const std::string& ext) { return FileExtension{ext, ""}; });
+
+    const auto failed = runSweep(inviwoApp, frontSignal, *logCounter, sweep, output, extensions,
+                                 shard, shards);
+
+    inviwoApp.getProcessorNetwork()->clear();
+
+    return failed == 0 ? 0 : 1;
+}
@@ -33,6 +33,7 @@
 #include <inviwo/core/util/glmutils.h>
 #include <inviwo/core/util/glmcomp.h>
 #include <inviwo/core/util/glmmatext.h>
+#include <inviwo/core/util/threadutil.h>
 
 #include <glm/common.hpp>
 
@@ -42,6 +43,11 @@
 #include <span>
 #include <tuple>
 #include <cmath>
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <limits>
+#include <cstdint>
 
 namespace inviwo::util {
 
@@ -112,10 +118,221 @@ std::pair<size_t, double> optimalBinCount(DataMapper dataMap, size_t bins) {
     }
 }
 
+/**
+ * Mapping from data values to histogram bins, shared by all histogram kernels
+ */
+struct HistogramBinning {
+    double rangeMin;
+    double scale;
+    ptrdiff_t maxBin;
+    double maxBinD;
+};
+
+/**
+ * Partial histograms and statistics of a part of the data. The sum and sum of squares are kept
+ * per chunk in calculateHistograms and merged in order to get results that are independent of
+ * the number of threads used.
+ */
+template <typename T>
+struct HistogramAccumulator {
+    using D = typename util::same_extent<T, double>::type;
+    static constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
+
+    explicit HistogramAccumulator(size_t numbins) {
+        for (auto& hist : hists) hist.resize(numbins, 0);
+    }
+
+    void merge(const HistogramAccumulator& other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+        count += other.count;
+        for (size_t channel = 0; channel < extent; ++channel) {
+            underflow[channel] += other.underflow[channel];
+            overflow[channel] += other.overflow[channel];
+            std::ranges::transform(hists[channel], other.hists[channel], hists[channel].begin(),
+                                   std::plus<>{});
+        }
+    }
+
+    D min{std::numeric_limits<double>::max()};
+    D max{std::numeric_limits<double>::lowest()};
+    size_t count{0};
+    std::array<size_t, extent> underflow{0};
+    std::array<size_t, extent> overflow{0};
+    std::array<std::vector<size_t>, extent> hists;
+};
+
+/**
+ * Number of elements processed per chunk by calculateHistograms. The chunking is independent of
+ * the number of threads, so the results do not depend on the size of the thread pool.
+ */
+constexpr size_t histogramChunkSize = size_t{1} << 20;
+
+/**
+ * Add the elements in \p data to the histograms in \p acc.
+ * @return the sum and the sum of squares of \p data
+ */
+template <typename T>
+auto accumulateHistogram(std::span<const T> data, const HistogramBinning& binning,
+                         HistogramAccumulator<T>& acc) {
+    using D = typename HistogramAccumulator<T>::D;
+    constexpr size_t extent = HistogramAccumulator<T>::extent;
+
+    D sum(0);
+    D sum2(0);
+
+    if constexpr (std::is_floating_point_v<T>) {
+        // Keep the statistics in a separate, branch free, loop to allow the compiler to
+        // vectorize it.
+        double min = acc.min;
+        double max = acc.max;
+        for (const auto item : data) {
+            const auto val = static_cast<double>(item);
+            min = val < min ? val : min;
+            max = val > max ? val : max;
+            sum += val;
+            sum2 += val * val;
+        }
+        acc.min = min;
+        acc.max = max;
+        acc.count += data.size();
+
+        auto* hist = acc.hists[0].data();
+        size_t underflow = 0;
+        size_t overflow = 0;
+        for (const auto item : data) {
+            const auto nc = (static_cast<double>(item) - binning.rangeMin) * binning.scale;
+            if (nc >= 0.0 && nc < binning.maxBinD) {
+                ++hist[static_cast<ptrdiff_t>(nc)];
+            } else if (nc >= binning.maxBinD) {
+                ++overflow;
+            } else {  // negative or NaN
+                ++underflow;
+            }
+        }
+        acc.underflow[0] += underflow;
+        acc.overflow[0] += overflow;
+    } else {
+        const D rangeMin(binning.rangeMin);
+        const D rangeScaleFactor(binning.scale);
+
+        for (const auto& item : data) {
+            const auto val = static_cast<D>(item);
+
+            acc.min = glm::min(acc.min, val);
+            acc.max = glm::max(acc.max, val);
+            sum += val;
+            sum2 += val * val;
+
+            const auto normalized = (val - rangeMin) * rangeScaleFactor;
+
+            for (size_t channel = 0; channel < extent; ++channel) {
+                const auto nc = util::glmcomp(normalized, channel);
+
+                // check the range using doubles first to avoid overflows when casting
+                if (nc < 0.0) {
+                    ++acc.underflow[channel];
+                } else if (nc >= binning.maxBinD) {
+                    ++acc.overflow[channel];
+                } else {
+                    const auto v = static_cast<ptrdiff_t>(nc);
+                    if (v < 0) {
+                        ++acc.underflow[channel];
+                    } else if (v > binning.maxBin) {
+                        ++acc.overflow[channel];
+                    } else {
+                        ++acc.hists[channel][v];
+                    }
+                }
+            }
+        }
+        acc.count += data.size();
+    }
+    return std::pair{sum, sum2};
+}
+
+/**
+ * For 8 and 16 bit integer data count the occurrences of each value. The bins and statistics are
+ * derived from the value counts afterwards, see accumulateValueCounts.
+ * Four interleaved sets of 32 bit counters are used in \p scratch to avoid stalls on repeated
+ * values, they have to be flushed by flushValueCounts before they can overflow.
+ */
+template <typename T>
+void countValues(std::span<const T> data, std::span<uint32_t> scratch) {
+    using U = std::make_unsigned_t<T>;
+    constexpr size_t nValues = size_t{1} << (8 * sizeof(T));
+    auto* c0 = scratch.data();
+    auto* c1 = c0 + nValues;
+    auto* c2 = c1 + nValues;
+    auto* c3 = c2 + nValues;
+
+    const auto* it = data.data();
+    const auto* end = it + data.size();
+    for (; it + 4 <= end; it += 4) {
+        ++c0[static_cast<U>(it[0])];
+        ++c1[static_cast<U>(it[1])];
+        ++c2[static_cast<U>(it[2])];
+        ++c3[static_cast<U>(it[3])];
+    }
+    for (; it != end; ++it) {
+        ++c0[static_cast<U>(*it)];
+    }
+}
+
+inline void flushValueCounts(std::span<uint32_t> scratch, std::span<size_t> counts) {
+    const auto nValues = counts.size();
+    for (size_t i = 0; i < nValues; ++i) {
+        counts[i] += size_t{scratch[i]} + scratch[i + nValues] + scratch[i + 2 * nValues] +
+                     scratch[i + 3 * nValues];
+    }
+    std::ranges::fill(scratch, uint32_t{0});
+}
+
+/**
+ * Fill \p acc from value counts of 8 and 16 bit integer data. The value counts are indexed by the
+ * unsigned representation of the values.
+ * @return the sum and the sum of squares of the data
+ */
+template <typename T>
+std::pair<double, double> accumulateValueCounts(std::span<const size_t> counts,
+                                                const HistogramBinning& binning,
+                                                HistogramAccumulator<T>& acc) {
+    using U = std::make_unsigned_t<T>;
+    double sum = 0.0;
+    double sum2 = 0.0;
+    // iterate in value order, i.e. negative values first for signed types
+    constexpr auto first = static_cast<ptrdiff_t>(std::numeric_limits<T>::lowest());
+    constexpr auto last = static_cast<ptrdiff_t>(std::numeric_limits<T>::max());
+    for (ptrdiff_t value = first; value <= last; ++value) {
+        const auto count = counts[static_cast<U>(static_cast<T>(value))];
+        if (count == 0) continue;
+        const auto val = static_cast<double>(value);
+        const auto dcount = static_cast<double>(count);
+
+        acc.min = glm::min(acc.min, val);
+        acc.max = glm::max(acc.max, val);
+        acc.count += count;
+        sum += dcount * val;
+        sum2 += dcount * val * val;
+
+        const auto nc = (val - binning.rangeMin) * binning.scale;
+        if (nc < 0.0) {
+            acc.underflow[0] += count;
+        } else if (nc >= binning.maxBinD) {
+            acc.overflow[0] += count;
+        } else {
+            acc.hists[0][static_cast<size_t>(nc)] += count;
+        }
+    }
+    return {sum, sum2};
+}
+
 }  // namespace detail
 
 /**
  * Calculate histograms and statistics for a given span \p data of type \p T.
+ * The data is processed in chunks in parallel on the thread pool, if available, using per thread
+ * histograms that are merged at the end. The results are independent of the number of threads.
  *
  * @tparam T       underlying data type, can be a scalar or glm vector type
  * @param data
@@ -129,60 +346,104 @@ std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const Data
                                              size_t bins) {
     // a double type with the same extent as T
     using D = typename util::same_extent<T, double>::type;
-    constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
-
-    D min(std::numeric_limits<double>::max());
-    D max(std::numeric_limits<double>::lowest());
-    D sum(0);
-    D sum2(0);
-    size_t count(0);
-
-    std::array<size_t, extent> underflow{0};
-    std::array<size_t, extent> overflow{0};
+    using Acc = detail::HistogramAccumulator<T>;
+    constexpr size_t extent = Acc::extent;
+    constexpr bool countAllValues =
+        std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 2;
 
     auto [numbins, effectiveRange] = detail::optimalBinCount<T>(dataMap, bins);
-    const D rangeMin(dataMap.dataRange.x);
-    const D rangeScaleFactor(static_cast<double>(numbins - 1) / effectiveRange);
+    const detail::HistogramBinning binning{
+        .rangeMin = dataMap.dataRange.x,
+        .scale = static_cast<double>(numbins - 1) / effectiveRange,
+        .maxBin = static_cast<ptrdiff_t>(numbins) - 1,
+        .maxBinD = static_cast<double>(numbins)};
 
-    std::array<std::vector<size_t>, extent> hists;
-    for (size_t i = 0; i < extent; ++i) {
-        hists[i].resize(numbins, 0);
-    }
-    const auto maxBin = static_cast<ptrdiff_t>(numbins) - 1;
-    const auto maxBinD = static_cast<double>(numbins);
+    const size_t nChunks =
+        std::max(size_t{1}, (data.size() + detail::histogramChunkSize - 1) /
+                                detail::histogramChunkSize);
+    const auto chunk = [&](size_t i) {
+        const auto begin = std::min(data.size(), i * detail::histogramChunkSize);
+        const auto end = std::min(data.size(), begin + detail::histogramChunkSize);
+        return data.subspan(begin, end - begin);
+    };
 
-    for (const auto& item : data) {
-        const auto val = static_cast<D>(item);
+    // Per thread state, for 8 and 16 bit integers only the value counts are needed
+    constexpr size_t nValues = countAllValues ? size_t{1} << (8 * sizeof(T)) : size_t{0};
+    struct Partial {
+        Acc acc;
+        std::vector<size_t> counts;
+        std::vector<uint32_t> scratch;
+    };
+    const auto makePartial = [&]() {
+        return Partial{.acc = Acc{numbins},
+                       .counts = std::vector<size_t>(nValues, 0),
+                       .scratch = std::vector<uint32_t>(4 * nValues, 0)};
+    };
+    std::vector<std::pair<D, D>> chunkSums(nChunks, std::pair<D, D>{D(0), D(0)});
+    const auto process = [&](Partial& partial, size_t chunkBegin, size_t chunkEnd) {
+        if constexpr (countAllValues) {
+            // a 32 bit counter can hold the counts of at least this many chunks
+            constexpr size_t flushInterval =
+                std::numeric_limits<uint32_t>::max() / detail::histogramChunkSize;
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                detail::countValues<T>(chunk(i), partial.scratch);
+                if ((i - chunkBegin + 1) % flushInterval == 0) {
+                    detail::flushValueCounts(partial.scratch, partial.counts);
+                }
+            }
+            detail::flushValueCounts(partial.scratch, partial.counts);
+        } else {
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                chunkSums[i] = detail::accumulateHistogram<T>(chunk(i), binning, partial.acc);
+            }
+        }
+    };
 
-        min = glm::min(min, val);
-        max = glm::max(max, val);
-        sum += val;
-        sum2 += val * val;
-        count++;
+    const size_t poolSize = util::getPoolSize();
+    const size_t jobs = std::min(nChunks, poolSize);
+    std::vector<Partial> partials;
+    partials.reserve(std::max(jobs, size_t{1}));
+    if (jobs <= 1) {
+        process(partials.emplace_back(makePartial()), 0, nChunks);
+    } else {
+        for (size_t job = 0; job < jobs; ++job) partials.push_back(makePartial());
 
-        const auto normalized = (val - rangeMin) * rangeScaleFactor;
+        std::vector<std::future<void>> futures;
+        futures.reserve(jobs);
+        for (size_t job = 0; job < jobs; ++job) {
+            futures.push_back(util::dispatchPool([&, job]() {
+                process(partials[job], job * nChunks / jobs, (job + 1) * nChunks / jobs);
+            }));
+        }
+        auto& pool = util::getThreadPool();
+        for (const auto& f : futures) pool.wait(f);
+        for (auto& f : futures) f.get();  // propagate any exceptions
+    }
 
-        for (size_t channel = 0; channel < extent; ++channel) {
-            const auto nc = util::glmcomp(normalized, channel);
-
-            // check the range using doubles first to avoid overflows when casting
-            if (nc < 0.0) {
-                ++underflow[channel];
-            } else if (nc >= maxBinD) {
-                ++overflow[channel];
-            } else {
-                const auto v = static_cast<ptrdiff_t>(nc);
-                if (v < 0) {
-                    ++underflow[channel];
-                } else if (v > maxBin) {
-                    ++overflow[channel];
-                } else {
-                    ++hists[channel][v];
-                }
-            }
+    Acc& result = partials.front().acc;
+    D sum(0);
+    D sum2(0);
+    if constexpr (countAllValues) {
+        auto& counts = partials.front().counts;
+        for (size_t job = 1; job < partials.size(); ++job) {
+            std::ranges::transform(counts, partials[job].counts, counts.begin(), std::plus<>{});
+        }
+        std::tie(sum, sum2) = detail::accumulateValueCounts<T>(counts, binning, result);
+    } else {
+        for (size_t job = 1; job < partials.size(); ++job) {
+            result.merge(partials[job].acc);
+        }
+        for (const auto& [chunkSum, chunkSum2] : chunkSums) {
+            sum += chunkSum;
+            sum2 += chunkSum2;
         }
     }
 
+    const auto& min = result.min;
+    const auto& max = result.max;
+    const auto count = result.count;
+    const auto& hists = result.hists;
+
     const auto dcount = static_cast<double>(count);
     const auto mean = sum / dcount;
     const auto stddev = glm::sqrt((dcount * sum2 - sum * sum) / (dcount * (dcount - D{1})));
@@ -202,8 +463,8 @@ std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const Data
             .totalCounts = count,
             .maxCount = maxBinCount,
             .dataMap = histogramDataMap,
-            .underflow = underflow[channel],
-            .overflow = overflow[channel],
+            .underflow = result.underflow[channel],
+            .overflow = result.overflow[channel],
             .dataStats = {.min = util::glmcomp(min, channel),
                           .max = util::glmcomp(max, channel),
                           .mean = util::glmcomp(mean, channel),
@@ -0,0 +1,75 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/buffer/bufferrepresentation.h>
+
+#include <filesystem>
+#include <typeindex>
+
+namespace inviwo {
+
+/**
+ * @ingroup datastructures
+ * A BufferRepresentation that only knows the size and format of its data. The data is loaded
+ * into a BufferRAM by the DiskRepresentationLoader when it is first needed.
+ */
+class IVW_CORE_API BufferDisk : public BufferRepresentation,
+                                public DiskRepresentation<BufferRepresentation, BufferDisk> {
+public:
+    explicit BufferDisk(size_t size, const DataFormatBase* format,
+                        BufferUsage usage = BufferUsage::Static,
+                        BufferTarget target = BufferTarget::Data);
+    explicit BufferDisk(const std::filesystem::path& url, size_t size,
+                        const DataFormatBase* format, BufferUsage usage = BufferUsage::Static,
+                        BufferTarget target = BufferTarget::Data);
+    BufferDisk(const BufferDisk& rhs) = default;
+    BufferDisk& operator=(const BufferDisk& that) = default;
+    virtual BufferDisk* clone() const override;
+    virtual ~BufferDisk();
+
+    virtual const DataFormatBase* getDataFormat() const override;
+    virtual size_t getSize() const override;
+
+    virtual std::type_index getTypeIndex() const override final;
+
+private:
+    // clang-format off
+    [[deprecated("does not work for DiskRepresentation")]]
+    virtual void setSize(size_t size) override;
+    // clang-format on
+
+    const DataFormatBase* dataFormatBase_;
+    size_t size_;
+};
+
+}  // namespace inviwo
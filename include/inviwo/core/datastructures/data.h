@@ -37,6 +37,7 @@
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <typeindex>
 #include <mutex>
@@ -161,6 +162,15 @@ public:
      */
     void removeOtherRepresentations(const Repr* representation);
 
+    /**
+     * Remove all representations except the one of type T, given that it exists and is valid.
+     * The removed representations can then be recreated from T on demand, this is used to release
+     * memory, e.g. dropping the RAM representation of data that can be reloaded from disk.
+     * @return true if the representation of type T was valid and the others were removed
+     */
+    template <typename T>
+    bool releaseOtherRepresentations() const;
+
     /**
      * Delete all representations.
      */
@@ -256,6 +266,8 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
 
         const auto lastValidType = data.lastValidRepresentation_->getTypeIndex();
         if (auto package = factory->getRepresentationConverter(lastValidType, requestedType)) {
+            IVW_TRACE("conversion", fmt::format("{} -> {}", util::demangle(lastValidType.name()),
+                                                util::demangle(typeid(T).name())));
             for (auto converter : package->getConverters()) {
                 const auto dstType = converter->getConverterID().second;
                 const auto srcRepr = data.lastValidRepresentation_;
@@ -423,6 +435,20 @@ void Data<Self, Repr>::removeOtherRepresentations(const Repr* representation) {
     std::swap(repr, representations_);
 }
 
+template <typename Self, typename Repr>
+template <typename T>
+bool Data<Self, Repr>::releaseOtherRepresentations() const {
+    std::scoped_lock lock(mutex_);
+
+    auto repr = findRepr(std::type_index(typeid(T)));
+    if (!repr || !repr->isValid()) return false;
+
+    representations_.clear();
+    representations_.emplace(repr->getTypeIndex(), repr);
+    lastValidRepresentation_ = std::move(repr);
+    return true;
+}
+
 template <typename Self, typename Repr>
 bool Data<Self, Repr>::hasRepresentations() const {
     std::scoped_lock lock(mutex_);
@@ -62,6 +62,12 @@ public:
     void forEach(const std::function<void(const Histogram1D&, size_t)>&) const;
     void discard(const std::function<std::vector<Histogram1D>()>& calculate);
 
+    /**
+     * Use already calculated histograms, for example loaded from a cache. Any pending callbacks
+     * are invoked with the new histograms.
+     */
+    void set(std::vector<Histogram1D> histograms);
+
 private:
     enum class Status { Valid, Calculating, NotSet };
     struct State {
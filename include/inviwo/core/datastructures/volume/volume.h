@@ -176,6 +176,11 @@ public:
     [[nodiscard]] HistogramCache::Result calculateHistograms(
         const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const;
     void discardHistograms();
+    /**
+     * Set already calculated histograms, the histograms should be calculated using the current
+     * data map of the volume.
+     */
+    void setHistograms(std::vector<Histogram1D> histograms);
 
     VolumeConfig config() const;
 
@@ -186,6 +186,14 @@ public:
                        const SwizzleMask& swizzleMask = VolumeConfig::defaultSwizzleMask,
                        InterpolationType interpolation = VolumeConfig::defaultInterpolation,
                        const Wrapping3D& wrapping = VolumeConfig::defaultWrapping);
+    /**
+     * Reference read only @p data kept alive by @p owner, for example a memory mapped file. The
+     * data is copied to memory owned by the representation on the first non-const access.
+     */
+    VolumeRAMPrecision(const T* data, std::shared_ptr<const void> owner, size3_t dimensions,
+                       const SwizzleMask& swizzleMask = VolumeConfig::defaultSwizzleMask,
+                       InterpolationType interpolation = VolumeConfig::defaultInterpolation,
+                       const Wrapping3D& wrapping = VolumeConfig::defaultWrapping);
     explicit VolumeRAMPrecision(const VolumeReprConfig& config);
     VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs);
     VolumeRAMPrecision<T>& operator=(const VolumeRAMPrecision<T>& that);
@@ -254,9 +262,15 @@ public:
     }
 
 private:
+    /**
+     * Copy read only data to memory owned by the representation
+     */
+    T* editableData();
+
     size3_t dimensions_;
     bool ownsDataPtr_;
     std::unique_ptr<T[]> data_;
+    std::shared_ptr<const void> readOnlyOwner_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping3D wrapping_;
@@ -341,6 +355,27 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
                                                    .desc = "VolumeRAM"});
 }
 
+template <typename T>
+VolumeRAMPrecision<T>::VolumeRAMPrecision(const T* data, std::shared_ptr<const void> owner,
+                                          size3_t dimensions, const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping)
+    : VolumeRAM{}
+    , dimensions_{dimensions}
+    , ownsDataPtr_{false}
+    , data_{const_cast<T*>(data)}
+    , readOnlyOwner_{std::move(owner)}
+    , swizzleMask_{swizzleMask}
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {
+
+    if (glm::any(glm::equal(dimensions_, size3_t{0}))) {
+        data_.release();
+        throw Exception{SourceContext{}, "All volume dimensions have to be greater than 0, got {}",
+                        dimensions_};
+    }
+}
+
 template <typename T>
 VolumeRAMPrecision<T>::VolumeRAMPrecision(const VolumeReprConfig& config)
     : VolumeRAMPrecision{config.dimensions.value_or(VolumeConfig::defaultDimensions),
@@ -379,7 +414,9 @@ VolumeRAMPrecision<T>& VolumeRAMPrecision<T>::operator=(const VolumeRAMPrecision
         std::copy(that.getView().begin(), that.getView().end(), data.get());
         data_.swap(data);
         std::swap(dim, dimensions_);
+        if (!ownsDataPtr_) data.release();
         ownsDataPtr_ = true;
+        readOnlyOwner_.reset();
         swizzleMask_ = that.swizzleMask_;
         interpolation_ = that.interpolation_;
         wrapping_ = that.wrapping_;
@@ -416,13 +453,29 @@ const T* VolumeRAMPrecision<T>::getDataTyped() const {
 }
 
 template <typename T>
-T* VolumeRAMPrecision<T>::getDataTyped() {
+T* VolumeRAMPrecision<T>::editableData() {
+    if (readOnlyOwner_) {
+        auto data = std::make_unique<T[]>(glm::compMul(dimensions_));
+        std::copy(data_.get(), data_.get() + glm::compMul(dimensions_), data.get());
+        data_.release();
+        data_ = std::move(data);
+        ownsDataPtr_ = true;
+        readOnlyOwner_.reset();
+        resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
+                                                       .format = DataFormat<T>::id(),
+                                                       .desc = "VolumeRAM"});
+    }
     return data_.get();
 }
 
+template <typename T>
+T* VolumeRAMPrecision<T>::getDataTyped() {
+    return editableData();
+}
+
 template <typename T>
 std::span<T> VolumeRAMPrecision<T>::getView() {
-    return std::span<T>{data_.get(), glm::compMul(dimensions_)};
+    return std::span<T>{editableData(), glm::compMul(dimensions_)};
 }
 
 template <typename T>
@@ -432,7 +485,7 @@ std::span<const T> VolumeRAMPrecision<T>::getView() const {
 
 template <typename T>
 void* VolumeRAMPrecision<T>::getData() {
-    return data_.get();
+    return editableData();
 }
 template <typename T>
 const void* VolumeRAMPrecision<T>::getData() const {
@@ -441,7 +494,7 @@ const void* VolumeRAMPrecision<T>::getData() const {
 
 template <typename T>
 void* VolumeRAMPrecision<T>::getData(size_t pos) {
-    return data_.get() + pos;
+    return editableData() + pos;
 }
 
 template <typename T>
@@ -462,6 +515,7 @@ void VolumeRAMPrecision<T>::setData(void* d, size3_t dimensions) {
 
     if (!ownsDataPtr_) data.release();
     ownsDataPtr_ = true;
+    readOnlyOwner_.reset();
 }
 
 template <typename T>
@@ -494,6 +548,7 @@ void VolumeRAMPrecision<T>::setDimensions(size3_t dimensions) {
 
         if (!ownsDataPtr_) data.release();
         ownsDataPtr_ = true;
+        readOnlyOwner_.reset();
     }
 }
 
@@ -549,22 +604,22 @@ dvec4 VolumeRAMPrecision<T>::getAsDVec4(const size3_t& pos) const {
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDouble(const size3_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec2(const size3_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec3(const size3_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec4(const size3_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
@@ -589,22 +644,22 @@ dvec4 VolumeRAMPrecision<T>::getAsNormalizedDVec4(const size3_t& pos) const {
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDouble(const size3_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec2(const size3_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec3(const size3_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec4(const size3_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename Result, template <class> class Predicate, typename Callable, typename... Args>
@@ -0,0 +1,130 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+
+#include <cstddef>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * @brief Streams the RAM representations of a VolumeSequence within a memory budget.
+ *
+ * Volumes that have a valid VolumeDisk representation are loaded into RAM when accessed and
+ * released again, least recently used first, when the loaded volumes exceed the byte budget. After
+ * each access the next volumes in the current playback direction are loaded in the background, as
+ * far as they fit within the budget. Volumes without a disk representation can not be reloaded
+ * and are passed through untouched.
+ *
+ * Volumes that are still referenced outside of the sequence, for example a volume returned by get
+ * that is still held by a consumer, are never released. Such volumes count against the budget.
+ */
+class IVW_CORE_API VolumeSequenceCache {
+public:
+    struct Stats {
+        size_t hits = 0;        ///< Accesses to volumes that were already loaded
+        size_t misses = 0;      ///< Accesses that had to load the volume
+        size_t prefetched = 0;  ///< Volumes loaded in the background
+        size_t evictions = 0;   ///< Volumes released to stay within the budget
+        size_t loaded = 0;      ///< Number of currently loaded volumes
+        size_t bytes = 0;       ///< Size of the currently loaded volumes
+    };
+
+    explicit VolumeSequenceCache(size_t byteBudget = size_t{1} << 30, size_t prefetchCount = 2);
+    VolumeSequenceCache(const VolumeSequenceCache&) = delete;
+    VolumeSequenceCache(VolumeSequenceCache&&) = delete;
+    VolumeSequenceCache& operator=(const VolumeSequenceCache&) = delete;
+    VolumeSequenceCache& operator=(VolumeSequenceCache&&) = delete;
+    ~VolumeSequenceCache();
+
+    /**
+     * Set the sequence to stream. The loaded volumes of a previous sequence are not released,
+     * since they might still be used elsewhere.
+     */
+    void setSequence(std::shared_ptr<const VolumeSequence> sequence);
+
+    /**
+     * Get the volume at @p index with its RAM representation loaded, releases the least recently
+     * used volumes if needed and starts prefetching the following volumes.
+     */
+    std::shared_ptr<const Volume> get(size_t index);
+
+    void setByteBudget(size_t bytes);
+    size_t getByteBudget() const;
+    void setPrefetchCount(size_t count);
+    size_t getPrefetchCount() const;
+
+    Stats getStats() const;
+    void resetStats();
+
+    /**
+     * Release the RAM representations of all loaded volumes of the current sequence, except for
+     * the volumes still referenced outside of the sequence.
+     */
+    void clear();
+
+private:
+    struct Entry {
+        std::list<size_t>::iterator lru;
+        size_t bytes;
+    };
+
+    static bool isStreamable(const Volume& volume);
+    static size_t sizeInBytes(const Volume& volume);
+
+    void waitForPending();
+    void touch(size_t index, size_t bytes);
+    void evict(const std::vector<size_t>& keep, size_t reserve);
+    void prefetch(size_t index);
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<const VolumeSequence> sequence_;
+    size_t byteBudget_;
+    size_t prefetchCount_;
+    size_t last_ = 0;
+    bool forward_ = true;
+
+    /// Loaded volumes, most recently used first
+    std::list<size_t> lru_;
+    std::unordered_map<size_t, Entry> loaded_;
+    std::unordered_map<size_t, std::shared_future<void>> pending_;
+    size_t pendingBytes_ = 0;
+    Stats stats_;
+};
+
+}  // namespace inviwo
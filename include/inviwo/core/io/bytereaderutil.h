@@ -31,6 +31,7 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/util/glmvec.h>
 
 #include <string_view>
 #include <filesystem>
@@ -46,4 +47,29 @@ void readBytesIntoBuffer(const std::filesystem::path& path, size_t offset, size_
 IVW_CORE_API void readCompressedBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
                                                 size_t bytes, ByteOrder byteOrder,
                                                 size_t elementSize, void* dest);
+
+/**
+ * Read @p bytes bytes at the uncompressed @p offset from a chunked raw file, see ChunkedRawFile.
+ * Only the chunks covering the range are decompressed, in parallel on the thread pool.
+ */
+IVW_CORE_API void readChunkedBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
+                                             size_t bytes, ByteOrder byteOrder, size_t elementSize,
+                                             void* dest);
+
+/**
+ * Read a brick of @p brickDims voxels starting at @p brickOffset from a volume of @p dims voxels
+ * stored at the uncompressed @p offset in a chunked raw file. Only the chunks overlapping the brick
+ * are decompressed. The brick is written densely into @p dest.
+ */
+IVW_CORE_API void readChunkedBrickIntoBuffer(const std::filesystem::path& path, size_t offset,
+                                             size3_t dims, size3_t brickOffset, size3_t brickDims,
+                                             ByteOrder byteOrder, size_t elementSize, void* dest);
+
+/**
+ * Read @p bytes bytes at @p offset using the reader matching @p compression. For compressed data
+ * the offset refers to the uncompressed data.
+ */
+IVW_CORE_API void readBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
+                                      size_t bytes, ByteOrder byteOrder, size_t elementSize,
+                                      Compression compression, void* dest);
 }  // namespace inviwo::util
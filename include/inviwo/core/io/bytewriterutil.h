@@ -40,7 +40,8 @@ namespace inviwo::util {
 
 /**
  * Write \p bytes bytes of the data \p source to the given filepath \p path. The data is compressed
- * if \p compression is enabled and supported.
+ * if \p compression is enabled and supported. Compression::Chunked writes a ChunkedRawFile with
+ * the chunks compressed in parallel.
 *
  * @throw DataReaderException if the file cannot be created or written to
  * @see util::isCompressionSupported
@@ -0,0 +1,122 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * @brief Random access to block compressed raw files (Compression::Chunked)
+ *
+ * The raw data is split into fixed size chunks which are deflate compressed independently. A
+ * header with a chunk index is stored in front of the compressed chunks:
+ * @verbatim
+ * char[8]   magic "ivwchunk"
+ * uint64    version
+ * uint64    uncompressed size in bytes
+ * uint64    chunk size in bytes (the last chunk may be smaller)
+ * uint64    number of chunks N
+ * uint64[N + 1] file offsets of the compressed chunks, the last entry is the end of the file
+ * ...       compressed chunks
+ * @endverbatim
+ * All header fields are stored little endian. Chunks are compressed and decompressed in parallel
+ * on the thread pool, and reads only decompress the chunks that cover the requested bytes.
+ */
+class IVW_CORE_API ChunkedRawFile {
+public:
+    static constexpr size_t defaultChunkSize = size_t{4} << 20;
+
+    /**
+     * Open the file at @p path and read its chunk index.
+     * @throw DataReaderException if the file can not be opened, is not a chunked raw file, or
+     *        its chunk index does not fit the size of the file
+     */
+    explicit ChunkedRawFile(const std::filesystem::path& path);
+
+    /**
+     * Compress @p bytes bytes of @p source into chunks of @p chunkSize bytes and write them to
+     * @p path.
+     * @throw DataWriterException if the file can not be written
+     */
+    static void write(const std::filesystem::path& path, const void* source, size_t bytes,
+                      size_t chunkSize = defaultChunkSize);
+
+    /**
+     * Uncompressed size of the data in bytes
+     */
+    size_t size() const;
+    size_t chunkSize() const;
+    size_t chunkCount() const;
+
+    /**
+     * Read @p bytes uncompressed bytes starting at @p offset into @p dest.
+     * @throw DataReaderException if the range is outside of the data or the file is corrupt
+     */
+    void read(size_t offset, size_t bytes, void* dest) const;
+
+    /**
+     * Read a brick of a volume stored at @p offset in the file. Only the chunks that overlap the
+     * rows of the brick are decompressed. The brick is written densely into @p dest.
+     * @param offset       byte offset of the volume in the uncompressed data
+     * @param dims         dimensions of the stored volume
+     * @param elementSize  size of one voxel in bytes
+     * @param brickOffset  first voxel of the brick
+     * @param brickDims    dimensions of the brick
+     * @param dest         destination, at least compMul(brickDims) * elementSize bytes
+     * @throw DataReaderException if the brick is outside of the volume or the file is corrupt
+     */
+    void readBrick(size_t offset, size3_t dims, size_t elementSize, size3_t brickOffset,
+                   size3_t brickDims, void* dest) const;
+
+private:
+    /**
+     * Read and decompress the given sorted @p chunks, calling @p callback with the chunk index
+     * and the uncompressed data for each of them. Reading is done on the calling thread while
+     * the decompression and the callbacks run on the thread pool.
+     */
+    void forEachChunk(
+        std::span<const size_t> chunks,
+        const std::function<void(size_t, std::span<const std::byte>)>& callback) const;
+
+    std::filesystem::path path_;
+    size_t size_;
+    size_t chunkSize_;
+    std::vector<std::uint64_t> offsets_;
+};
+
+}  // namespace inviwo
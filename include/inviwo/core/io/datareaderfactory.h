@@ -34,6 +34,7 @@
 #include <inviwo/core/util/factory.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/io/datareader.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <memory>
 #include <unordered_map>
@@ -117,6 +118,7 @@ public:
         std::optional<FileExtension> ext = std::nullopt) const {
         if (auto reader = ext ? getReaderForTypeAndExtension<T>(*ext, filePath)
                               : getReaderForTypeAndExtension<T>(filePath)) {
+            IVW_TRACE("read", filePath.string());
             return reader->readData(filePath);
         } else {
             return nullptr;
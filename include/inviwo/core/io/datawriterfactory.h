@@ -34,6 +34,7 @@
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/io/datawriter.h>
 #include <inviwo/core/util/fileextension.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <vector>
 #include <string>
@@ -124,6 +125,7 @@ public:
                                       std::optional<FileExtension> ext = std::nullopt) const {
         if (auto writer = ext ? getWriterForTypeAndExtension<T>(*ext, filePath)
                               : getWriterForTypeAndExtension<T>(filePath)) {
+            IVW_TRACE("write", filePath.string());
             writer->writeData(data, filePath);
             return true;
         } else {
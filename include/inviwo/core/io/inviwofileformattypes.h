@@ -36,12 +36,21 @@
 namespace inviwo {
 
 enum class ByteOrder : std::uint8_t { LittleEndian, BigEndian };
-enum class Compression : std::uint8_t { Disabled, Enabled };
+/**
+ * Disabled: plain raw data, Enabled: a single gzip/bzip/lzma stream, Chunked: independently deflate
+ * compressed chunks with an index for parallel and random access, see ChunkedRawFile.
+ */
+enum class Compression : std::uint8_t { Disabled, Enabled, Chunked };
+enum class MemoryMapping : std::uint8_t { Disabled, Enabled };
 
 IVW_CORE_API std::string_view enumToStr(ByteOrder byteOrder);
 IVW_CORE_API std::string_view enumToStr(Compression compression);
+IVW_CORE_API std::string_view enumToStr(MemoryMapping memoryMapping);
 
 inline std::string_view format_as(ByteOrder byteOrder) { return enumToStr(byteOrder); }
 inline std::string_view format_as(Compression compression) { return enumToStr(compression); }
+inline std::string_view format_as(MemoryMapping memoryMapping) {
+    return enumToStr(memoryMapping);
+}
 
 }  // namespace inviwo
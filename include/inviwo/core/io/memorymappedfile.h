@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <cstddef>
+
+namespace inviwo {
+
+/**
+ * @brief A read only memory mapping of a whole file.
+ * Pages are only loaded from disk when they are accessed, and they are shared with the operating
+ * system page cache, i.e. with all other mappings of the same file. The mapped memory can not be
+ * written to, copy the data to modify it.
+ *
+ * The file should not be modified or truncated while it is mapped, accessing pages beyond the end
+ * of a truncated file will crash the process on most platforms. Replacing the file, i.e. writing a
+ * new file and renaming it over the old one, is safe, the mapping keeps referencing the old file.
+ *
+ * Use MemoryMappedFile::open to share a single mapping between all users of the same file.
+ */
+class IVW_CORE_API MemoryMappedFile {
+public:
+    /**
+     * Map the file at @p path.
+     * @throw FileException if the file could not be opened or mapped.
+     */
+    explicit MemoryMappedFile(const std::filesystem::path& path);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+    ~MemoryMappedFile();
+
+    /**
+     * Get a shared mapping of the file at @p path. An existing mapping is reused as long as the
+     * file has not been modified since it was mapped.
+     * @throw FileException if the file could not be opened or mapped.
+     */
+    static std::shared_ptr<MemoryMappedFile> open(const std::filesystem::path& path);
+
+    const std::filesystem::path& path() const { return path_; }
+    size_t size() const { return size_; }
+    const std::byte* data() const { return data_; }
+    std::span<const std::byte> bytes() const { return {data_, size_}; }
+
+private:
+    std::filesystem::path path_;
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
+
+}  // namespace inviwo
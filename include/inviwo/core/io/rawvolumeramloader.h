@@ -44,12 +44,20 @@ namespace inviwo {
 /**
  * @brief A loader of raw files. Used to create VolumeRAM representations.
  * This class us used by the DatVolumeSequenceReader, IvfVolumeReader and RawVolumeReader.
+ *
+ * With MemoryMapping::Enabled uncompressed data in native byte order is memory mapped instead of
+ * read into a newly allocated buffer, see MemoryMappedFile. The data is then only loaded from disk
+ * when it is accessed and shared between all representations of the same file. The mapping is
+ * read only, the data is copied on the first editable access. The raw file must not be modified
+ * in place while it is mapped. The loader falls back to reading the file if the data can not be
+ * mapped.
  */
 
 class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
 public:
-    RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
-                       ByteOrder byteOrder, Compression compression);
+    RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset, ByteOrder byteOrder,
+                       Compression compression,
+                       MemoryMapping memoryMapping = MemoryMapping::Disabled);
     virtual RawVolumeRAMLoader* clone() const override;
     virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
         const VolumeRepresentation& src) const override;
@@ -61,6 +69,7 @@ private:
     size_t offset_;
     ByteOrder byteOrder_;
     Compression compression_;
+    MemoryMapping memoryMapping_;
 };
 
 }  // namespace inviwo
@@ -35,10 +35,13 @@
 #include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/io/datareader.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
 #include <inviwo/core/io/volumedatareaderdialog.h>
 
+#include <any>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace inviwo {
 class MetaDataOwner;
@@ -60,6 +63,25 @@ public:
 
     const DataFormatBase* getFormat() const { return format_; }
 
+    /**
+     * Set any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual std::any getOption(std::string_view key) override;
+
+    /**
+     * Memory map the raw file instead of reading it, disabled by default.
+     * @see RawVolumeRAMLoader
+     */
+    RawVolumeReader& setMemoryMapping(MemoryMapping memoryMapping);
+    MemoryMapping getMemoryMapping() const;
+
 private:
     std::filesystem::path rawFile_;
     ByteOrder byteOrder_;
@@ -69,6 +91,7 @@ private:
     DataMapper dataMapper_;
     size_t byteOffset_;
     Compression compression_;
+    MemoryMapping memoryMapping_;
 };
 
 }  // namespace inviwo
@@ -35,11 +35,27 @@
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
 #include <inviwo/core/network/evaluationerrorhandler.h>
 
+#include <cstddef>
+#include <future>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace inviwo {
 
 class Processor;
 class ProcessorNetwork;
 
+/**
+ * Evaluates the processors of a network that are invalid and have a sink downstream.
+ * The evaluator keeps a topological order of all processors that is updated incrementally when
+ * connections are added, using the dynamic topological sort of Pearce and Kelly. It also tracks
+ * which processors have been invalidated and which processors have a sink downstream. Evaluating
+ * the network then only visits the invalidated processors, and changing the network does not
+ * require sorting the whole network again.
+ */
 class IVW_CORE_API ProcessorNetworkEvaluator : public ProcessorNetworkObserver,
                                                public ProcessorObserver,
                                                public ProcessorNetworkEvaluationObservable {
@@ -50,6 +66,20 @@ public:
     virtual ~ProcessorNetworkEvaluator();
     void setExceptionHandler(EvaluationErrorHandler handler);
 
+    /**
+     * Evaluate independent branches of the network in parallel. Processors that return true from
+     * Processor::isThreadSafe are processed on the thread pool as soon as all their predecessors
+     * are done, all other processors are processed on the evaluating thread. Resource
+     * initialization, inport onChange callbacks, and observer notifications always happen on the
+     * evaluating thread, and pool jobs are finished in topological order, which keeps the order
+     * of notifications and error reports deterministic. Processors that are connected by property
+     * links are never evaluated concurrently, and a processor that is invalidated while it is
+     * processed on the pool stays invalid and is evaluated again. Disabled by default.
+     * @see SystemSettings::parallelEvaluation_
+     */
+    void setParallelEvaluation(bool enable);
+    bool getParallelEvaluation() const;
+
 private:
     // ProcessorNetworkObserver overrides
     virtual void onProcessorNetworkEvaluateRequest() override;
@@ -62,16 +92,58 @@ private:
     // ProcessorObserver overrides
     virtual void onProcessorSinkChanged(Processor*) override;
     virtual void onProcessorActiveConnectionsChanged(Processor*) override;
+    virtual void onProcessorInvalidationBegin(Processor*) override;
+    virtual void onProcessorReadyChanged(Processor*) override;
 
     void requestEvaluate();
     void evaluate();
+    void evaluateParallel(const std::vector<Processor*>& processors);
+
+    /**
+     * Restore the topological order after adding the connection from @p source to @p target.
+     * Only the processors between the two in the current order are reordered, or just one of
+     * them if it is not connected on the other side, as is common when building a network.
+     */
+    void addEdge(Processor* source, Processor* target);
+    /**
+     * Mark @p processor and everything upstream of it, following active connections, as having a
+     * sink downstream.
+     */
+    void markRelevant(Processor* processor);
+    void updateRelevance();
+    void markDirty(Processor* processor);
+
+    /**
+     * Initialize resources and call onChange for all changed inports.
+     * @return false if any of them threw
+     */
+    bool prepare(Processor* processor);
+    void process(Processor* processor);
+    void finish(Processor* processor, std::future<void>& job);
+    void notReady(Processor* processor);
 
     ProcessorNetwork* processorNetwork_;
-    // the sorted list of processors obtained through topological sorting
-    std::vector<Processor*> processorsSorted_;
-    bool needsSorting_;
+    // topological order of all processors in the network, not necessarily contiguous
+    std::unordered_map<Processor*, std::ptrdiff_t> order_;
+    std::ptrdiff_t firstOrder_;
+    std::ptrdiff_t lastOrder_;
+    // processors with an active path to a sink
+    std::unordered_set<Processor*> relevant_;
+    bool relevanceDirty_;
+    // processors that might need evaluation, with and without a sink downstream
+    std::unordered_set<Processor*> dirty_;
+    std::unordered_set<Processor*> dormant_;
+    // the processors left to evaluate in the current pass, ordered topologically
+    std::set<std::pair<std::ptrdiff_t, Processor*>>* queue_;
+    std::ptrdiff_t position_;
     bool evaluationQueued_;
+    bool parallelEvaluation_;
     size_t reentranceCount_;
+    // set while evaluating in parallel, other threads are running pool jobs
+    std::thread::id evaluatingThread_;
+    // processors being processed on the pool, and the ones invalidated meanwhile
+    std::unordered_set<Processor*> inFlight_;
+    std::unordered_set<Processor*> invalidatedInFlight_;
     EvaluationErrorHandler exceptionHandler_;
 };
 
@@ -61,6 +61,26 @@ public:
         const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) const = 0;
 };
 
+/**
+ * @brief A base class for a Processor that exports the data of its inport, for example the
+ * DataExport processors of the base module. Unlike Exporter, these are not included in
+ * util::exportAllFiles, which is used for the regression snapshots, see util::exportAllDataFiles.
+ */
+class IVW_CORE_API DataExporter {
+public:
+    virtual ~DataExporter() = default;
+
+    /**
+     * Export the data to `path/name.ext` where ext is the first ext on candidateExtensions that
+     * is supported.
+     * @returns a string to the path of the exported file, or std::nullopt if no matching
+     * extensions were found
+     */
+    virtual std::optional<std::filesystem::path> exportFile(
+        const std::filesystem::path& path, std::string_view name,
+        const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) const = 0;
+};
+
 class IVW_CORE_API ImageExporter {
 public:
     virtual ~ImageExporter() = default;
@@ -79,6 +99,16 @@ IVW_CORE_API std::vector<std::filesystem::path> exportAllFiles(
     ProcessorNetwork& network, const std::filesystem::path& dir, std::string_view nameTemplate,
     const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite);
 
+/**
+ * Exports the data from all DataExporter processors in \p network into the directory \p dir
+ * using a \p nameTemplate and candidate extensions. Processors that are not ready, for example
+ * because their inport is not connected, are skipped.
+ * @return names of exported files
+ */
+IVW_CORE_API std::vector<std::filesystem::path> exportAllDataFiles(
+    ProcessorNetwork& network, const std::filesystem::path& dir, std::string_view nameTemplate,
+    const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite);
+
 }  // namespace util
 
 }  // namespace inviwo
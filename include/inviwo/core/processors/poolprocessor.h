@@ -37,6 +37,7 @@
 #include <inviwo/core/util/assertion.h>
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/tracerecorder.h>
 #include <inviwo/core/network/networklock.h>
 
 #include <atomic>
@@ -471,10 +472,11 @@ void PoolProcessor::dispatchMany(std::vector<Job> jobs, Done&& done) {
     for (auto& job : jobs) {
         auto task = makeTask<Result>(std::move(job), state->getStop(), state->getProgress(i++));
         state->futures.push_back(task->get_future());
-        sub.tasks.emplace_back([state, task, app]() {
+        sub.tasks.emplace_back([state, task, app, id = getIdentifier()]() {
             if (!state->stop) {
                 // This code will run in a background thread, make sure the local context is active
                 rendercontext::activateLocal();
+                IVW_TRACE("poolprocessor", id);
                 (*task)();
             }
             callDone(app, std::move(state));
@@ -520,11 +522,12 @@ void PoolProcessor::dispatchOne(Job&& job, Done&& done) {
     auto app = getInviwoApplication();
 
     Submission sub{state,
-                   {[state, task, app]() {
+                   {[state, task, app, id = getIdentifier()]() {
                        if (!state->stop) {
                            // This code will run in a background thread, make sure the local context
                            // is active
                            rendercontext::activateLocal();
+                           IVW_TRACE("poolprocessor", id);
                            (*task)();
                        }
                        callDone(app, std::move(state));
@@ -241,6 +241,15 @@ public:
      */
     virtual void initializeResources() {}
 
+    /**
+     * Returns whether process() may be called on a thread pool worker when the network is
+     * evaluated in parallel, see ProcessorNetworkEvaluator::setParallelEvaluation. A thread safe
+     * process() only reads its inports and properties and sets data on its outports. It must not
+     * modify any properties or wait for the main thread. No successor of the processor is
+     * evaluated while process() is running. Defaults to false.
+     */
+    virtual bool isThreadSafe() const { return false; }
+
     Port* getPort(std::string_view identifier) const;
     Inport* getInport(std::string_view identifier) const;
     Outport* getOutport(std::string_view identifier) const;
@@ -33,7 +33,11 @@
 #include <inviwo/core/util/settings/systemsettings.h>
 #include <inviwo/core/util/threadutil.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <future>
 #include <utility>
+#include <vector>
 
 namespace inviwo {
 
@@ -140,6 +144,53 @@ void forEachParallel(const Iterable& iterable, Callback&& callback, size_t jobs
     }
 }
 
+/**
+ * The number of chunks util::forEachChunk splits @p size elements into. At least one chunk, and at
+ * most 4 times the pool size, with at least @p minChunkSize elements per chunk otherwise.
+ */
+inline size_t numberOfChunks(size_t size, size_t minChunkSize) {
+    return std::clamp<size_t>(size / std::max<size_t>(1, minChunkSize), 1,
+                              4 * std::max<size_t>(1, getPoolSize()));
+}
+
+/**
+ * Split the range [0, @p size) into contiguous chunks, see util::numberOfChunks, and call
+ * `callback(begin, end)` for each chunk on the thread pool. If the Inviwo pool size is zero, or
+ * there is only one chunk, the chunks are processed directly in the calling thread.
+ * The function returns once all chunks have been processed. It waits using ThreadPool::wait, so
+ * it can be called from within a pool task without blocking a worker. Exceptions thrown by the
+ * callback are rethrown after all chunks are done.
+ *
+ * @param size the number of elements
+ * @param callback to call for each chunk with the begin and end index of the chunk
+ * @param minChunkSize the minimum number of elements per chunk, when there are enough elements
+ */
+template <typename Callback>
+void forEachChunk(size_t size, Callback&& callback, size_t minChunkSize) {
+    const auto nChunks = numberOfChunks(size, minChunkSize);
+    if (nChunks == 1 || getPoolSize() == 0) {
+        for (size_t c = 0; c < nChunks; ++c) {
+            callback(size * c / nChunks, size * (c + 1) / nChunks);
+        }
+        return;
+    }
+
+    auto& pool = getThreadPool();
+    std::vector<std::future<void>> futures;
+    futures.reserve(nChunks);
+    for (size_t c = 0; c < nChunks; ++c) {
+        const auto begin = size * c / nChunks;
+        const auto end = size * (c + 1) / nChunks;
+        futures.push_back(pool.enqueue([&callback, begin, end]() { callback(begin, end); }));
+    }
+    for (const auto& future : futures) {
+        pool.wait(future);
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -39,6 +39,10 @@
 #include <inviwo/core/datastructures/image/layerram.h>
 #include <inviwo/core/datastructures/coordinatetransformer.h>
 #include <inviwo/core/util/interpolation.h>
+#include <inviwo/core/util/glmconvert.h>
+
+#include <array>
+#include <span>
 
 namespace inviwo {
 
@@ -129,6 +133,32 @@ protected:
                  glm::any(glm::greaterThan(dvec2{pos}, dvec2(1.0))));
     }
 
+    virtual void sampleDataSpaceBatch(std::span<const dvec3> positions,
+                                      std::span<ReturnType> result) const override {
+        // Dispatch once for the whole batch instead of a virtual call per pixel
+        layer_->dispatch<void>([&](auto lrprecision) {
+            const auto* data = lrprecision->getDataTyped();
+            const size2_t dimsM1 = dims_ - size2_t(1);
+            const dvec2 max{dimsM1};
+
+            const auto pixel = [&](size_t x, size_t y) {
+                return static_cast<ReturnType>(util::glm_convert<dvec4>(data[x + y * dims_.x]));
+            };
+
+            for (size_t i = 0; i < positions.size(); ++i) {
+                const dvec2 samplePos = dvec2{positions[i]} * max;
+                const size2_t indexPos = size2_t(samplePos);
+                const dvec2 interpolants = samplePos - dvec2(indexPos);
+                const size2_t p0 = glm::min(indexPos, dimsM1);
+                const size2_t p1 = glm::min(indexPos + size2_t(1), dimsM1);
+
+                const std::array<ReturnType, 4> samples{pixel(p0.x, p0.y), pixel(p1.x, p0.y),
+                                                        pixel(p0.x, p1.y), pixel(p1.x, p1.y)};
+                result[i] = Interpolation<ReturnType>::bilinear(samples, interpolants);
+            }
+        });
+    }
+
 private:
     ReturnType getPixel(const size2_t& pos) const {
         auto p = glm::clamp(pos, size2_t(0), dims_ - size2_t(1));
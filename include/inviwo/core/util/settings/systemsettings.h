@@ -63,6 +63,8 @@ public:
     BoolProperty breakOnException_;
     BoolProperty stackTraceInException_;
     BoolProperty enableResourceTracking_;
+    BoolProperty enableTracing_;
+    BoolProperty parallelEvaluation_;
 
     BoolProperty redirectCout_;
     BoolProperty redirectCerr_;
@@ -31,6 +31,11 @@
 
 #include <inviwo/core/datastructures/spatialdata.h>
 #include <inviwo/core/datastructures/datatraits.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <array>
+#include <span>
 
 namespace inviwo {
 
@@ -53,6 +58,16 @@ public:
     auto sample(const dvec2& pos, CoordinateSpace space) const -> ReturnType;
     auto sample(const vec2& pos, CoordinateSpace space) const -> ReturnType;
 
+    /**
+     * Sample all \p positions and write the results to \p result, equivalent to calling
+     * sample(pos) for each position. Derived samplers can override sampleDataSpaceBatch to avoid
+     * the per sample overhead, i.e. the virtual call and the data format conversion.
+     * @throws Exception if \p positions and \p result are not of the same size.
+     */
+    void sample(std::span<const dvec3> positions, std::span<ReturnType> result) const;
+    void sample(std::span<const dvec3> positions, std::span<ReturnType> result,
+                CoordinateSpace space) const;
+
     bool withinBounds(const dvec3& pos) const;
     bool withinBounds(const vec3& pos) const;
     bool withinBounds(const dvec2& pos) const;
@@ -72,10 +87,20 @@ public:
 protected:
     virtual ReturnType sampleDataSpace(const dvec3& pos) const = 0;
     virtual bool withinBoundsDataSpace(const dvec3& pos) const = 0;
+    /**
+     * Sample all positions given in data space. The default implementation calls
+     * sampleDataSpace for each position.
+     */
+    virtual void sampleDataSpaceBatch(std::span<const dvec3> positions,
+                                      std::span<ReturnType> result) const;
 
     CoordinateSpace space_;
     const SpatialEntity& spatialEntity_;
     dmat4 transform_;
+
+private:
+    void sampleBatch(const dmat4& toData, std::span<const dvec3> positions,
+                     std::span<ReturnType> result) const;
 };
 
 template <typename ReturnType>
@@ -162,6 +187,61 @@ auto SpatialSampler<ReturnType>::sample(const dvec3& pos, CoordinateSpace space)
     }
 }
 
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sample(std::span<const dvec3> positions,
+                                        std::span<ReturnType> result) const {
+    if (space_ != CoordinateSpace::Data) {
+        sampleBatch(transform_, positions, result);
+    } else {
+        if (positions.size() != result.size()) {
+            throw Exception(SourceContext{}, "Size mismatch, got {} positions but {} results",
+                            positions.size(), result.size());
+        }
+        sampleDataSpaceBatch(positions, result);
+    }
+}
+
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sample(std::span<const dvec3> positions,
+                                        std::span<ReturnType> result,
+                                        CoordinateSpace space) const {
+    if (space != CoordinateSpace::Data) {
+        const dmat4 m{
+            spatialEntity_.getCoordinateTransformer().getMatrix(space, CoordinateSpace::Data)};
+        sampleBatch(m, positions, result);
+    } else {
+        sample(positions, result);
+    }
+}
+
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sampleBatch(const dmat4& toData,
+                                             std::span<const dvec3> positions,
+                                             std::span<ReturnType> result) const {
+    if (positions.size() != result.size()) {
+        throw Exception(SourceContext{}, "Size mismatch, got {} positions but {} results",
+                        positions.size(), result.size());
+    }
+    // Transform the positions in blocks to avoid allocating a buffer for all of them
+    constexpr size_t blockSize = 256;
+    std::array<dvec3, blockSize> block;
+    for (size_t begin = 0; begin < positions.size(); begin += blockSize) {
+        const auto count = std::min(blockSize, positions.size() - begin);
+        for (size_t i = 0; i < count; ++i) {
+            const auto p = toData * dvec4(positions[begin + i], 1.0);
+            block[i] = dvec3(p) / p.w;
+        }
+        sampleDataSpaceBatch(std::span{block.data(), count}, result.subspan(begin, count));
+    }
+}
+
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sampleDataSpaceBatch(std::span<const dvec3> positions,
+                                                      std::span<ReturnType> result) const {
+    std::transform(positions.begin(), positions.end(), result.begin(),
+                   [&](const dvec3& pos) { return sampleDataSpace(pos); });
+}
+
 template <typename ReturnType>
 bool SpatialSampler<ReturnType>::withinBounds(const vec3& pos) const {
     return withinBounds(static_cast<dvec3>(pos));
@@ -61,19 +61,32 @@
 #include <warn/push>
 #include <warn/ignore/all>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <future>
 #include <functional>
 #include <stdexcept>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <warn/pop>
 
 namespace inviwo {
 
+/**
+ * A work-stealing thread pool. Each worker owns a task deque, tasks enqueued from a worker are
+ * pushed to that worker's deque and executed in LIFO order by the worker, while idle workers steal
+ * from the other end. Tasks enqueued from outside the pool go to a shared injection queue.
+ * Use ThreadPool::wait to wait for a future from within a task, the calling worker will then keep
+ * running other tasks while waiting instead of blocking.
+ */
 class IVW_CORE_API ThreadPool {
 public:
     ThreadPool(
@@ -93,12 +106,102 @@ public:
      */
     void enqueueRaw(std::function<void()> f);
 
+    /**
+     * Wait until @p future is ready. When called from one of the worker threads of this pool the
+     * worker will run other pending tasks while waiting, this avoids deadlocks when a task waits
+     * for tasks it has enqueued itself. From any other thread this is a plain wait.
+     */
+    template <typename Future>
+    void wait(const Future& future);
+
+    /**
+     * Run one pending task on the calling thread if it is one of the worker threads of this pool.
+     * @return true if a task was run.
+     */
+    bool runPendingTask();
+
     size_t trySetSize(size_t size);
     size_t getSize() const;
 
     size_t getQueueSize();
 
 private:
+    /**
+     * Move only type erased task, small callables like a std::packaged_task are stored inline to
+     * avoid an extra allocation per enqueued task.
+     */
+    class Task {
+    public:
+        Task() = default;
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+        Task(F&& f) {  // NOLINT
+            using T = std::decay_t<F>;
+            if constexpr (sizeof(T) <= bufferSize && alignof(T) <= alignof(std::max_align_t) &&
+                          std::is_nothrow_move_constructible_v<T>) {
+                ::new (static_cast<void*>(storage_)) T(std::forward<F>(f));
+                ops_ = &Inline<T>::ops;
+            } else {
+                ::new (static_cast<void*>(storage_)) T*(new T(std::forward<F>(f)));
+                ops_ = &Heap<T>::ops;
+            }
+        }
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task(Task&& rhs) noexcept : ops_{rhs.ops_} {
+            if (ops_) {
+                ops_->move(storage_, rhs.storage_);
+                rhs.ops_ = nullptr;
+            }
+        }
+        Task& operator=(Task&& rhs) noexcept {
+            if (this != &rhs) {
+                reset();
+                if (rhs.ops_) {
+                    rhs.ops_->move(storage_, rhs.storage_);
+                    ops_ = std::exchange(rhs.ops_, nullptr);
+                }
+            }
+            return *this;
+        }
+        ~Task() { reset(); }
+
+        void operator()() { ops_->invoke(storage_); }
+        explicit operator bool() const { return ops_ != nullptr; }
+
+    private:
+        struct Ops {
+            void (*invoke)(void*);
+            void (*move)(void* dst, void* src) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+        template <typename T>
+        struct Inline {
+            static T* get(void* s) { return std::launder(static_cast<T*>(s)); }
+            static void invoke(void* s) { (*get(s))(); }
+            static void move(void* dst, void* src) noexcept {
+                ::new (dst) T(std::move(*get(src)));
+                get(src)->~T();
+            }
+            static void destroy(void* s) noexcept { get(s)->~T(); }
+            static constexpr Ops ops{&invoke, &move, &destroy};
+        };
+        template <typename T>
+        struct Heap {
+            static T* get(void* s) { return *std::launder(static_cast<T**>(s)); }
+            static void invoke(void* s) { (*get(s))(); }
+            static void move(void* dst, void* src) noexcept { ::new (dst) T*(get(src)); }
+            static void destroy(void* s) noexcept { delete get(s); }
+            static constexpr Ops ops{&invoke, &move, &destroy};
+        };
+        void reset() {
+            if (ops_) std::exchange(ops_, nullptr)->destroy(storage_);
+        }
+
+        static constexpr size_t bufferSize = 6 * sizeof(void*);
+        alignas(std::max_align_t) std::byte storage_[bufferSize];
+        const Ops* ops_ = nullptr;
+    };
+
     enum class State {
         Free,     //< Worker is waiting for tasks.
         Working,  //< Worker is running a task.
@@ -116,13 +219,32 @@ private:
         ~Worker();
 
         std::atomic<State> state;  //< State of the worker
+        std::mutex mutex;          //< Guards tasks
+        std::deque<Task> tasks;    //< Local tasks, the owner pops from the back, thieves the front
+        ThreadPool& pool;
+        size_t index;
         std::thread thread;
     };
+
+    void push(Task task);
+    bool pop(Worker* self, Task& task);
+    bool steal(Worker* self, Task& task);
+    void notify();
+    static Worker*& currentWorker();
+    bool isWorkerThread() const;
+
     // need to keep track of threads so we can join them
     std::vector<std::unique_ptr<Worker>> workers;
+    mutable std::shared_mutex workers_mutex;
+    std::atomic<size_t> nworkers{0};
 
-    // the task queue
-    std::queue<std::function<void()>> tasks;
+    // the injection queue for tasks enqueued from outside the pool
+    std::deque<Task> tasks;
+
+    // number of tasks in the injection queue and all worker queues
+    std::atomic<size_t> pending{0};
+    // number of workers waiting on condition
+    std::atomic<size_t> sleeping{0};
 
     // synchronization
     std::mutex queue_mutex;
@@ -138,19 +260,31 @@ template <class F, class... Args>
 auto ThreadPool::enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
     using return_type = std::invoke_result_t<F, Args...>;
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+    std::packaged_task<return_type()> task{
+        std::bind(std::forward<F>(f), std::forward<Args>(args)...)};
 
-    std::future<return_type> res = task->get_future();
+    std::future<return_type> res = task.get_future();
 
-    if (workers.empty()) {
-        (*task)();  // No worker threads, just run the task.
+    if (getSize() == 0) {
+        task();  // No worker threads, just run the task.
     } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace([task]() { (*task)(); });
+        push(Task{std::move(task)});
     }
-    condition.notify_one();
     return res;
 }
 
+template <typename Future>
+void ThreadPool::wait(const Future& future) {
+    using namespace std::chrono_literals;
+    if (!isWorkerThread()) {
+        future.wait();
+        return;
+    }
+    while (future.wait_for(0s) != std::future_status::ready) {
+        if (!runPendingTask()) {
+            future.wait_for(100us);
+        }
+    }
+}
+
 }  // namespace inviwo
@@ -0,0 +1,168 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/sourcecontext.h>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * Records timestamped spans, e.g. processor evaluation, thread pool jobs, and representation
+ * conversions, to be able to see where the time of a frame goes. Each thread records into its own
+ * ring buffer, so recording never contends with other threads and only the most recent events are
+ * kept. The recording can be exported in the Chrome trace event format and opened in
+ * chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Recording is off by default and when disabled a trace point only costs a relaxed atomic load.
+ * Use TraceScope or IVW_TRACE to add trace points.
+ */
+class IVW_CORE_API TraceRecorder {
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct Event {
+        std::string_view category;
+        std::string name;
+        clock::time_point start;
+        clock::duration duration;
+        std::uint32_t thread;
+    };
+
+    static bool isEnabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+
+    /**
+     * Set the number of events kept per thread. Existing recordings are cleared.
+     */
+    static void setCapacity(size_t eventsPerThread);
+    static size_t getCapacity();
+
+    /**
+     * Remove all recorded events.
+     */
+    static void clear();
+
+    /**
+     * Record a span. @p category has to outlive the recording, hence the Literal.
+     */
+    static void record(Literal category, std::string name, clock::time_point start,
+                       clock::time_point end);
+
+    /**
+     * Collect the recorded events of all threads, sorted by start time.
+     */
+    static std::vector<Event> getEvents();
+
+    /**
+     * Write all recorded events as Chrome trace event JSON.
+     */
+    static void writeChromeTrace(std::ostream& os);
+    /**
+     * Write all recorded events as Chrome trace event JSON to @p path.
+     * @throw FileException if the file could not be opened.
+     */
+    static void writeChromeTrace(const std::filesystem::path& path);
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+/**
+ * Records the lifetime of the scope as a span in the TraceRecorder. The name is only evaluated if
+ * the recording is enabled, pass a callable returning the name to avoid formatting it otherwise.
+ * @see IVW_TRACE
+ */
+class TraceScope {
+public:
+    TraceScope(Literal category, std::string_view name) : category_{category} {
+        if (TraceRecorder::isEnabled()) {
+            name_ = name;
+            start();
+        }
+    }
+    template <std::invocable Func>
+    TraceScope(Literal category, Func&& nameFunc) : category_{category} {
+        if (TraceRecorder::isEnabled()) {
+            name_ = std::forward<Func>(nameFunc)();
+            start();
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope(TraceScope&&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+    TraceScope& operator=(TraceScope&&) = delete;
+    ~TraceScope() {
+        if (active_) {
+            TraceRecorder::record(category_, std::move(name_), start_, TraceRecorder::clock::now());
+        }
+    }
+
+private:
+    void start() {
+        active_ = true;
+        start_ = TraceRecorder::clock::now();
+    }
+
+    Literal category_;
+    bool active_ = false;
+    std::string name_;
+    TraceRecorder::clock::time_point start_;
+};
+
+}  // namespace inviwo
+
+/**
+ * \def IVW_TRACE(category, name)
+ * Record the rest of the current scope as a span in the TraceRecorder. The name expression is
+ * only evaluated while the recording is enabled.
+ *
+ * @param category a string literal, e.g. "process"
+ * @param name     an expression convertible to std::string
+ */
+#define IVW_TRACE(category, name)                                                        \
+    const ::inviwo::TraceScope IVW_TRACE_ADDLINE(inviwoTraceScope)(                      \
+        ::inviwo::operator""_sl(category, sizeof(category) - 1),                         \
+        [&]() -> std::string { return std::string(name); })
+
+#define IVW_TRACE_ADDLINE_PART1(x, y) x##y
+#define IVW_TRACE_ADDLINE_PART2(x, y) IVW_TRACE_ADDLINE_PART1(x, y)
+#define IVW_TRACE_ADDLINE(x) IVW_TRACE_ADDLINE_PART2(x, __LINE__)
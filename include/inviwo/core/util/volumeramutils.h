@@ -87,8 +87,10 @@ void forEachVoxelParallel(const size3_t dims, C callback, size_t jobs = 0) {
         }));
     }
 
+    // Let pool threads help out instead of blocking when called from within a task
+    auto& pool = util::getThreadPool();
     for (const auto& e : futures) {
-        e.wait();
+        pool.wait(e);
     }
 }
 template <typename C>
@@ -37,9 +37,60 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>
 
 #include <inviwo/core/util/spatialsampler.h>
+#include <inviwo/core/util/glmconvert.h>
+
+#include <array>
+#include <span>
 
 namespace inviwo {
 
+namespace detail {
+
+/**
+ * Trilinear sampling of a typed voxel array at positions in data space, matching
+ * VolumeSampler::sampleDataSpace. Without any virtual calls in the loop the compiler is free to
+ * inline the conversion and interpolation for the given voxel type.
+ */
+template <typename ReturnType, typename T>
+void sampleTrilinear(const T* data, size3_t dims, std::span<const dvec3> positions,
+                     std::span<ReturnType> result) {
+    const size3_t dimsM1 = dims - size3_t(1);
+    const dvec3 max{dimsM1};
+    const size_t strideY = dims.x;
+    const size_t strideZ = dims.x * dims.y;
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const auto& pos = positions[i];
+        if (glm::any(glm::lessThan(pos, dvec3(0.0))) ||
+            glm::any(glm::greaterThan(pos, dvec3(1.0)))) {
+            result[i] = ReturnType(0.0);
+            continue;
+        }
+        const dvec3 samplePos = pos * max;
+        const size3_t indexPos = size3_t(samplePos);
+        const dvec3 interpolants = samplePos - dvec3(indexPos);
+        const size3_t next = glm::min(indexPos + size3_t(1), dimsM1);
+
+        const size_t x0 = indexPos.x;
+        const size_t x1 = next.x;
+        const size_t y0 = indexPos.y * strideY;
+        const size_t y1 = next.y * strideY;
+        const size_t z0 = indexPos.z * strideZ;
+        const size_t z1 = next.z * strideZ;
+
+        const auto voxel = [&](size_t offset) {
+            return util::glm_convert<ReturnType>(data[offset]);
+        };
+        const std::array<ReturnType, 8> samples{
+            voxel(x0 + y0 + z0), voxel(x1 + y0 + z0), voxel(x0 + y1 + z0), voxel(x1 + y1 + z0),
+            voxel(x0 + y0 + z1), voxel(x1 + y0 + z1), voxel(x0 + y1 + z1), voxel(x1 + y1 + z1)};
+
+        result[i] = Interpolation<ReturnType, double>::trilinear(samples, interpolants);
+    }
+}
+
+}  // namespace detail
+
 template <typename ReturnType = dvec4>
 class VolumeSampler : public SpatialSampler<ReturnType> {
 public:
@@ -52,6 +103,8 @@ public:
 protected:
     virtual ReturnType sampleDataSpace(const dvec3& pos) const override;
     virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+    virtual void sampleDataSpaceBatch(std::span<const dvec3> positions,
+                                      std::span<ReturnType> result) const override;
     ReturnType getVoxel(const size3_t& pos) const;
 
     std::shared_ptr<const Volume> volume_;
@@ -97,6 +150,15 @@ auto VolumeSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> Retur
     return Interpolation<ReturnType, double>::trilinear(samples, interpolants);
 }
 
+template <typename ReturnType>
+void VolumeSampler<ReturnType>::sampleDataSpaceBatch(std::span<const dvec3> positions,
+                                                     std::span<ReturnType> result) const {
+    // Dispatch once for the whole batch instead of a virtual call per voxel
+    ram_->dispatch<void>([&](auto vrprecision) {
+        detail::sampleTrilinear(vrprecision->getDataTyped(), dims_, positions, result);
+    });
+}
+
 template <>
 inline double VolumeSampler<double>::getVoxel(const size3_t& pos) const {
     const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
@@ -33,9 +33,11 @@
 
 #include <inviwo/core/network/workspacemanager.h>
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <QObject>
 
@@ -47,6 +49,14 @@ namespace inviwo {
 class AutoSaver;
 class ProcessorNetwork;
 
+/**
+ * Keeps an undo history of the workspace. The workspace is saved whenever it has been modified
+ * and the difference to the previous state is stored as an undo step. A step holds the serialized
+ * state before and after the change of each modified processor, and the added and removed
+ * connections and links. Undo and redo apply a step in place, so only the modified processors are
+ * deserialized, added, or removed. Changes to other parts of the workspace than the network are
+ * stored as full workspace states and are restored by reloading the whole workspace.
+ */
 class IVW_QTAPPLICATIONBASE_API UndoManager : public QObject {
 public:
     UndoManager(
@@ -76,8 +86,13 @@ public:
     bool eventFilter(QObject* watched, QEvent* event) override;
 
 private:
-    using DiffType = std::vector<std::pmr::string>::iterator::difference_type;
+    struct State;
+    struct Step;
+    using DiffType = std::ptrdiff_t;
 
+    std::unique_ptr<State> saveState();
+    void apply(const Step& step, bool forward);
+    void applyInPlace(const Step& step, bool forward);
     void updateActions();
 
     ProcessorNetwork* network_;
@@ -87,8 +102,10 @@ private:
     bool dirty_ = true;
     size_t triggerId_ = 0;
     bool isRestoring = false;
+    /// The index of the last applied step in the undo buffer, -1 if none
     DiffType head_ = -1;
-    std::vector<std::shared_ptr<const std::pmr::string>> undoBuffer_;
+    std::unique_ptr<State> current_;
+    std::vector<Step> undoBuffer_;
 
     QAction* undoAction_;
     QAction* redoAction_;
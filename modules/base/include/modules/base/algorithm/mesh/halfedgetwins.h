@@ -0,0 +1,90 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace meshutil {
+
+/**
+ * @brief The twins of the half edges of a triangle list, together with edge statistics.
+ *
+ * Half edge `3 * t + i` goes from corner `i` to corner `(i + 1) % 3` of triangle `t`. The twin of
+ * a half edge from `a` to `b` is the first half edge, in triangle order, from `b` to `a`.
+ * Degenerate half edges, where `a == b`, never have a twin.
+ */
+struct IVW_MODULE_BASE_API HalfEdgeTwins {
+    static constexpr std::uint32_t noTwin = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief The twin of each half edge, or noTwin for boundary edges
+     */
+    std::vector<std::uint32_t> twins;
+    /**
+     * @brief Number of distinct undirected edges, degenerate edges are not counted
+     */
+    std::size_t edges = 0;
+    /**
+     * @brief Number of edges with a single half edge
+     */
+    std::size_t boundaryEdges = 0;
+    /**
+     * @brief Number of edges with more than two half edges, or two half edges in the same
+     * direction
+     */
+    std::size_t nonManifoldEdges = 0;
+
+    bool isClosed() const { return boundaryEdges == 0; }
+    bool isManifold() const { return nonManifoldEdges == 0; }
+};
+
+/**
+ * @brief Find the twins of all half edges of a triangle list.
+ *
+ * A key is created for the undirected edge of each half edge in parallel. The keys are then radix
+ * sorted, which places all half edges of an edge next to each other in triangle order, and the
+ * twins are linked in a single pass over the sorted keys. This scales to meshes with many millions
+ * of triangles, unlike building a map of edges.
+ *
+ * @param triangles vertex indices, three per triangle
+ */
+IVW_MODULE_BASE_API HalfEdgeTwins findHalfEdgeTwins(std::span<const std::uint32_t> triangles);
+
+}  // namespace meshutil
+
+}  // namespace inviwo
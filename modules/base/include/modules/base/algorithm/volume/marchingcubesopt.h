@@ -69,6 +69,35 @@ IVW_MODULE_BASE_API std::shared_ptr<Mesh> marchingCubesOpt(
     std::shared_ptr<const Volume> volume, double iso, const vec4& color, bool invert, bool enclose,
     std::function<void(float)> progressCallback = nullptr,
     std::function<bool(const size3_t&)> maskingCallback = nullptr);
+
+/**
+ * Extracts an iso surface from a volume using the Marching Cubes algorithm on multiple threads.
+ *
+ * The volume is split into slabs along z that are extracted in parallel on the thread pool, the
+ * buffers of each slab are sized from a first counting pass. Vertices are welded by edge index
+ * within each slab and the vertices on the planes shared between two slabs are stitched
+ * afterwards, resulting in the same mesh topology as util::marchingCubesOpt.
+ * Without a thread pool the slabs are extracted one after another on the calling thread.
+ *
+ * Note: Shares interface with util::marchingcubes and util::marchingtetrahedron
+ *
+ * @param volume the scalar volume
+ * @param iso iso-value for the extracted surface
+ * @param color the color of the resulting surface
+ * @param invert flips the normals of the surface normals (useful when values greater than the
+ * iso-value is 'outside' of the surface)
+ * @param enclose whether to create surface where the iso surface intersects the volume boundaries
+ * @param progressCallback if set, will be called will executing with the current progress in the
+ * interval [0,1], useful for progress bars. Always called from the calling thread.
+ * @param maskingCallback optional callback to test whether current cell should be evaluated or not
+ * (return true to include current cell). Will be called concurrently from multiple threads.
+ * @param slabs number of slabs to split the volume into, 0 will pick a number based on the size
+ * of the thread pool.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Mesh> marchingCubesParallel(
+    std::shared_ptr<const Volume> volume, double iso, const vec4& color, bool invert, bool enclose,
+    std::function<void(float)> progressCallback = nullptr,
+    std::function<bool(const size3_t&)> maskingCallback = nullptr, size_t slabs = 0);
 }  // namespace util
 
 namespace marching {
@@ -78,9 +78,11 @@ struct IVW_MODULE_BASE_API SplatSettings {
  * world-space distance between the point and each voxel center inside the per-point footprint.
  * Points whose footprint lies entirely outside the volume are skipped.
  *
- * The work is parallelized by splitting the output volume into a number of disjoint Z-slabs. Each
- * worker iterates over all points but only writes voxels inside its slab, so no atomics or locks
- * are needed.
+ * The work is parallelized by splitting the output volume into a number of disjoint Z-slabs. The
+ * points are first binned by the slabs their footprints overlap, in a parallel counting sort, then
+ * each worker iterates over the points of its slab and only writes voxels inside it, so no atomics
+ * or locks are needed. For volumes whose axes are aligned with the world axes the distances, and
+ * for the Gaussian kernel also the kernel values, are computed per axis instead of per voxel.
  *
  * @param positions      point positions, will be transformed with @c settings.pointTransform before
  *                       calculating distances
@@ -49,7 +49,9 @@ namespace util {
  * Implementation of Voronoi segmentation.
  *
  * The function returns a volume with each voxel containing the index for the closest seed point
- * (according to the power distance with or without weights).
+ * (according to the power distance with or without weights). The closest seed is found with a
+ * KD-tree over the seed points and the voxels are processed in parallel on the thread pool.
+ * Ties are resolved to the first seed point in seedPointsWithIndices.
  *
  *     * volumeDimensions is the dimensions for the volume.
  *     * indexToDataMatrix is the matrix to transform the voxel positions from index to data
@@ -59,7 +61,12 @@ namespace util {
  *     * seedPointsWithIndices is a vector containing the seed points for the algorithm together
  *       with their index number on the form {index, position}. The positions are expected be in
  *       model space.
- *     * wrapping the wrapping mode of the volume, @see Wrapping3D.
+ *     * wrapping the wrapping mode of the volume, @see Wrapping3D. With Wrapping::Repeat the
+ *       distance along that axis is periodic, seed points are expected to lie inside the volume.
+ *       The periodic distance is the minimum image distance: the data space difference is
+ *       wrapped into [-0.5, 0.5] along each repeating axis and then measured in model space.
+ *       If the basis vector of a repeating axis is not orthogonal to the other basis vectors the
+ *       KD-tree cannot be used and all seed points are compared for each voxel.
  *     * weights is an optional vector containing the weights for each seed point. If set the
  *       weighted version of voronoi should be used.
  */
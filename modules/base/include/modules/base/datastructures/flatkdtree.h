@@ -0,0 +1,349 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <glm/gtx/norm.hpp>
+
+namespace inviwo {
+
+/**
+ * A static KD-tree built in bulk from a set of points. The tree is stored implicitly in a flat
+ * array, the root of a range of points is its median element and the two halves are the left and
+ * right subtrees. It is built with std::nth_element in O(n log n), splitting along the dimension
+ * with the largest extent. Small ranges are leaves that are scanned linearly.
+ *
+ * All queries return indices into the span of points the tree was built from. The batched queries
+ * are run in parallel on the thread pool if there is one.
+ *
+ * Compared to KDTree there is no per node allocation, which makes it much faster to build and
+ * query for large point sets, but points can not be added or removed after construction.
+ */
+template <unsigned int N, typename P = double>
+class FlatKDTree {
+public:
+    using Point = Vector<N, P>;
+    using Index = std::uint32_t;
+    static constexpr Index npos = std::numeric_limits<Index>::max();
+    static constexpr size_t leafSize = 8;
+
+    /**
+     * The result of a batched query, operator[](i) gives the indices found for query i.
+     */
+    class Result {
+    public:
+        size_t size() const { return offsets_.size() - 1; }
+        bool empty() const { return size() == 0; }
+        std::span<const Index> operator[](size_t i) const {
+            return std::span<const Index>{indices_}.subspan(offsets_[i],
+                                                            offsets_[i + 1] - offsets_[i]);
+        }
+        /**
+         * The indices of all queries after each other
+         */
+        std::span<const Index> indices() const { return indices_; }
+
+    private:
+        friend FlatKDTree;
+        std::vector<Index> indices_;
+        std::vector<size_t> offsets_{0};
+    };
+
+    FlatKDTree() = default;
+    /**
+     * @throw Exception if there are more points than can be indexed by Index
+     */
+    explicit FlatKDTree(std::span<const Point> points);
+
+    size_t size() const { return nodes_.size(); }
+    bool empty() const { return nodes_.empty(); }
+
+    /**
+     * The index of the point closest to query or npos if the tree is empty. If several points
+     * are equally close the one with the lowest index is returned.
+     */
+    Index nearest(const Point& query) const;
+
+    /**
+     * Finds the result.size() points closest to query, ordered by increasing distance.
+     * @return the number of found points, less than result.size() if the tree is smaller.
+     */
+    size_t kNearest(const Point& query, std::span<Index> result) const;
+
+    /**
+     * Appends the indices of all points within radius of query to result, in no specific order.
+     */
+    void withinRadius(const Point& query, P radius, std::vector<Index>& result) const;
+
+    /**
+     * Finds the k nearest points of each query, ordered by increasing distance. Each query gets
+     * min(k, size()) indices.
+     */
+    Result kNearest(std::span<const Point> queries, size_t k) const;
+
+    /**
+     * Finds all points within radius of each query.
+     */
+    Result withinRadius(std::span<const Point> queries, P radius) const;
+
+private:
+    struct Node {
+        Point pos;
+        Index index;
+    };
+
+    static constexpr size_t minChunkSize = 1024;
+
+    void build(size_t begin, size_t end);
+    size_t kNearest(const Point& query, std::span<Index> result,
+                    std::vector<std::pair<P, Index>>& heap) const;
+
+    /**
+     * Visits all points that might be within sqrt(maxDist2) of query. visit(node, dist2) may
+     * lower maxDist2 to prune the search further.
+     */
+    template <typename Visit>
+    void search(size_t begin, size_t end, const Point& query, const P& maxDist2,
+                Visit& visit) const;
+
+    std::vector<Node> nodes_;
+    std::vector<std::uint8_t> splitDims_;
+};
+
+template <unsigned int N, typename P>
+FlatKDTree<N, P>::FlatKDTree(std::span<const Point> points) : nodes_{}, splitDims_{} {
+    if (points.size() > std::numeric_limits<Index>::max()) {
+        throw Exception(SourceContext{}, "FlatKDTree supports at most {} points, got {}",
+                        std::numeric_limits<Index>::max(), points.size());
+    }
+    nodes_.resize(points.size());
+    splitDims_.resize(points.size(), 0);
+    for (size_t i = 0; i < points.size(); ++i) {
+        nodes_[i] = Node{points[i], static_cast<Index>(i)};
+    }
+    build(0, nodes_.size());
+}
+
+template <unsigned int N, typename P>
+void FlatKDTree<N, P>::build(size_t begin, size_t end) {
+    if (end - begin <= leafSize) return;
+
+    Point min{nodes_[begin].pos};
+    Point max{nodes_[begin].pos};
+    for (size_t i = begin + 1; i < end; ++i) {
+        min = glm::min(min, nodes_[i].pos);
+        max = glm::max(max, nodes_[i].pos);
+    }
+    const auto extent = max - min;
+    std::uint8_t dim = 0;
+    for (unsigned int d = 1; d < N; ++d) {
+        if (extent[d] > extent[dim]) dim = static_cast<std::uint8_t>(d);
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    std::nth_element(nodes_.begin() + begin, nodes_.begin() + mid, nodes_.begin() + end,
+                     [dim](const Node& a, const Node& b) { return a.pos[dim] < b.pos[dim]; });
+    splitDims_[mid] = dim;
+
+    // Build large subtrees concurrently, the subtrees only touch their own range.
+    constexpr size_t parallelSize = size_t{1} << 16;
+    if (end - begin > parallelSize && util::getPoolSize() > 0) {
+        auto& pool = util::getThreadPool();
+        auto left = pool.enqueue([this, begin, mid]() { build(begin, mid); });
+        build(mid + 1, end);
+        pool.wait(left);
+        left.get();
+    } else {
+        build(begin, mid);
+        build(mid + 1, end);
+    }
+}
+
+template <unsigned int N, typename P>
+template <typename Visit>
+void FlatKDTree<N, P>::search(size_t begin, size_t end, const Point& query, const P& maxDist2,
+                              Visit& visit) const {
+    if (end - begin <= leafSize) {
+        for (size_t i = begin; i < end; ++i) {
+            visit(i, glm::distance2(query, nodes_[i].pos));
+        }
+        return;
+    }
+    const size_t mid = begin + (end - begin) / 2;
+    const auto& node = nodes_[mid];
+    visit(mid, glm::distance2(query, node.pos));
+
+    const auto diff = query[splitDims_[mid]] - node.pos[splitDims_[mid]];
+    if (diff < P{0}) {
+        search(begin, mid, query, maxDist2, visit);
+        if (diff * diff <= maxDist2) search(mid + 1, end, query, maxDist2, visit);
+    } else {
+        search(mid + 1, end, query, maxDist2, visit);
+        if (diff * diff <= maxDist2) search(begin, mid, query, maxDist2, visit);
+    }
+}
+
+template <unsigned int N, typename P>
+typename FlatKDTree<N, P>::Index FlatKDTree<N, P>::nearest(const Point& query) const {
+    Index result = npos;
+    auto maxDist2 = std::numeric_limits<P>::max();
+    auto visit = [&](size_t i, P dist2) {
+        if (dist2 < maxDist2 || (dist2 == maxDist2 && nodes_[i].index < result)) {
+            maxDist2 = dist2;
+            result = nodes_[i].index;
+        }
+    };
+    search(0, nodes_.size(), query, maxDist2, visit);
+    return result;
+}
+
+template <unsigned int N, typename P>
+size_t FlatKDTree<N, P>::kNearest(const Point& query, std::span<Index> result) const {
+    std::vector<std::pair<P, Index>> heap;
+    return kNearest(query, result, heap);
+}
+
+template <unsigned int N, typename P>
+size_t FlatKDTree<N, P>::kNearest(const Point& query, std::span<Index> result,
+                                  std::vector<std::pair<P, Index>>& heap) const {
+    const size_t k = std::min(result.size(), nodes_.size());
+    if (k == 0) return 0;
+
+    // max heap of the k closest points so far
+    heap.clear();
+    heap.reserve(k);
+    auto maxDist2 = std::numeric_limits<P>::max();
+    auto visit = [&](size_t i, P dist2) {
+        if (heap.size() < k) {
+            heap.emplace_back(dist2, nodes_[i].index);
+            std::ranges::push_heap(heap);
+            if (heap.size() == k) maxDist2 = heap.front().first;
+        } else if (dist2 < maxDist2) {
+            std::ranges::pop_heap(heap);
+            heap.back() = {dist2, nodes_[i].index};
+            std::ranges::push_heap(heap);
+            maxDist2 = heap.front().first;
+        }
+    };
+    search(0, nodes_.size(), query, maxDist2, visit);
+
+    std::ranges::sort_heap(heap);
+    std::ranges::transform(heap, result.begin(), [](const auto& item) { return item.second; });
+    return k;
+}
+
+template <unsigned int N, typename P>
+void FlatKDTree<N, P>::withinRadius(const Point& query, P radius,
+                                    std::vector<Index>& result) const {
+    const auto maxDist2 = radius * radius;
+    auto visit = [&](size_t i, P dist2) {
+        if (dist2 <= maxDist2) result.push_back(nodes_[i].index);
+    };
+    search(0, nodes_.size(), query, maxDist2, visit);
+}
+
+template <unsigned int N, typename P>
+auto FlatKDTree<N, P>::kNearest(std::span<const Point> queries, size_t k) const -> Result {
+    const size_t count = std::min(k, nodes_.size());
+    Result res;
+    res.indices_.resize(queries.size() * count);
+    res.offsets_.resize(queries.size() + 1);
+    for (size_t i = 0; i < res.offsets_.size(); ++i) res.offsets_[i] = i * count;
+
+    util::forEachChunk(
+        queries.size(),
+        [&](size_t begin, size_t end) {
+            std::vector<std::pair<P, Index>> heap;
+            for (size_t i = begin; i < end; ++i) {
+                kNearest(queries[i], std::span<Index>{res.indices_}.subspan(i * count, count),
+                         heap);
+            }
+        },
+        minChunkSize);
+    return res;
+}
+
+template <unsigned int N, typename P>
+auto FlatKDTree<N, P>::withinRadius(std::span<const Point> queries, P radius) const -> Result {
+    Result res;
+    res.offsets_.resize(queries.size() + 1, 0);
+
+    // Each chunk collects its indices separately, then they are concatenated in query order
+    const auto size = queries.size();
+    const auto nChunks = util::numberOfChunks(size, minChunkSize);
+    std::vector<std::vector<Index>> chunks(nChunks);
+    util::forEachChunk(
+        nChunks,
+        [&](size_t firstChunk, size_t lastChunk) {
+            for (auto c = firstChunk; c < lastChunk; ++c) {
+                auto& indices = chunks[c];
+                for (size_t i = size * c / nChunks; i < size * (c + 1) / nChunks; ++i) {
+                    withinRadius(queries[i], radius, indices);
+                    res.offsets_[i + 1] = indices.size();
+                }
+            }
+        },
+        1);
+
+    // The offsets are relative to the start of each chunk
+    size_t total = 0;
+    for (size_t c = 0; c < nChunks; ++c) {
+        for (size_t i = size * c / nChunks; i < size * (c + 1) / nChunks; ++i) {
+            res.offsets_[i + 1] += total;
+        }
+        total += chunks[c].size();
+    }
+    res.indices_.reserve(total);
+    for (auto& chunk : chunks) {
+        res.indices_.insert(res.indices_.end(), chunk.begin(), chunk.end());
+    }
+    return res;
+}
+
+template <typename P = double>
+using FlatK2DTree = FlatKDTree<2, P>;
+template <typename P = double>
+using FlatK3DTree = FlatKDTree<3, P>;
+
+}  // namespace inviwo
@@ -33,7 +33,9 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/io/datareader.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
 
+#include <any>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -68,7 +70,7 @@ namespace inviwo {
  *   - __WorldVector(1|2|3|4)__ Defines a world transformation matrix that is applied last to orient
  *                              the data in world space. (Optional, default: IdentityMatrix)
  *   - __DatFile__      Relative path to other file to create a VolumeSequence from.
- *   - __DataRange__    DataRange of volume (Optional, defaults to the min/max of the first volume)
+ *   - __DataRange__    DataRange of volume (Optional, defaults to the min/max of the data)
  *   - __ValueRange__   ValueRange of volume (Optional, defaults to the DataRange)
  *   - __ValueName__    Name of Value domain (Optional, defaults to "")
  *   - __ValueUnit__    Value Unit (Optional, defaults to Unit{})
@@ -90,9 +92,29 @@ namespace inviwo {
  *     + Datfile: sequence0.dat
  *     + Datfile: sequence1.dat
  *     + Datfile: sequence2.dat
+ *
+ * If no DataRange is given, the data range of the first volume of each .dat file is by default
+ * computed from the data and used for all volumes of that file. The data range of every volume can
+ * instead be computed, in parallel over the volumes, see DataRangeMode. Optionally the computed
+ * ranges and histograms are saved in a "<file>.dat.stats" sidecar file next to the .dat file, and
+ * reused as long as the raw files are unchanged, see setDataRangeCache.
+ * @see DataRangeMode
  */
 class IVW_MODULE_BASE_API DatVolumeSequenceReader : public DataReaderType<VolumeSequence> {
 public:
+    /**
+     * How to find the data range of volumes without a DataRange
+     */
+    enum class DataRangeMode {
+        First,     ///< Use the min/max of the first volume of each .dat file for all its volumes
+        Compute,   ///< Compute the min/max and histograms of every volume
+        Estimate,  ///< Use the min/max over a few evenly spaced volumes for all volumes
+        Defer,     ///< Do not look at the data, use the range of the data format
+    };
+    static constexpr DataRangeMode defaultDataRangeMode = DataRangeMode::First;
+    static constexpr size_t defaultDataRangeSamples = 3;
+    static constexpr bool defaultDataRangeCache = false;
+
     DatVolumeSequenceReader();
     DatVolumeSequenceReader(const DatVolumeSequenceReader&) = default;
     DatVolumeSequenceReader(DatVolumeSequenceReader&&) noexcept = default;
@@ -104,8 +126,54 @@ public:
     virtual std::shared_ptr<VolumeSequence> readData(
         const std::filesystem::path& filePath) override;
 
+    /**
+     * Set any of the settings supported by the reader, supported keys:
+     * * DataRangeMode (DatVolumeSequenceReader::DataRangeMode)
+     * * DataRangeSamples (size_t)
+     * * DataRangeCache (bool)
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the reader, supported keys:
+     * * DataRangeMode (DatVolumeSequenceReader::DataRangeMode)
+     * * DataRangeSamples (size_t)
+     * * DataRangeCache (bool)
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual std::any getOption(std::string_view key) override;
+
+    DatVolumeSequenceReader& setDataRangeMode(DataRangeMode mode);
+    DataRangeMode getDataRangeMode() const;
+
+    /**
+     * Number of volumes to look at when estimating the data range
+     * @see DataRangeMode::Estimate
+     */
+    DatVolumeSequenceReader& setDataRangeSamples(size_t samples);
+    size_t getDataRangeSamples() const;
+
+    /**
+     * Read and write the computed data ranges and histograms to a "<file>.dat.stats" sidecar
+     * file, disabled by default.
+     */
+    DatVolumeSequenceReader& setDataRangeCache(bool enable);
+    bool getDataRangeCache() const;
+
+    /**
+     * Memory map the raw files instead of reading them, disabled by default.
+     * @see RawVolumeRAMLoader
+     */
+    DatVolumeSequenceReader& setMemoryMapping(MemoryMapping memoryMapping);
+    MemoryMapping getMemoryMapping() const;
+
 private:
     bool enableLogOutput_;
+    DataRangeMode dataRangeMode_ = defaultDataRangeMode;
+    size_t dataRangeSamples_ = defaultDataRangeSamples;
+    bool dataRangeCache_ = defaultDataRangeCache;
+    MemoryMapping memoryMapping_ = MemoryMapping::Disabled;
 };
 
 class IVW_MODULE_BASE_API DatVolumeReader : public DataReaderType<Volume> {
@@ -119,6 +187,28 @@ public:
     virtual ~DatVolumeReader() = default;
 
     virtual std::shared_ptr<Volume> readData(const std::filesystem::path& filePath) override;
+
+    /**
+     * Set any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual std::any getOption(std::string_view key) override;
+
+    /**
+     * Memory map the raw files instead of reading them, disabled by default.
+     * @see RawVolumeRAMLoader
+     */
+    DatVolumeReader& setMemoryMapping(MemoryMapping memoryMapping);
+    MemoryMapping getMemoryMapping() const;
+
+private:
+    MemoryMapping memoryMapping_ = MemoryMapping::Disabled;
 };
 
 }  // namespace inviwo
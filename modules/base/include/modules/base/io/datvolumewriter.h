@@ -33,7 +33,9 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/io/datawriter.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
 
+#include <any>
 #include <string_view>
 
 namespace inviwo {
@@ -52,11 +54,30 @@ public:
 
     virtual void writeData(const Volume* data,
                            const std::filesystem::path& filePath) const override;
+
+    /**
+     * Set any of the settings supported by the writer, supported keys:
+     * * Compression (inviwo::Compression), defaults to Compression::Disabled
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the writer, supported keys:
+     * * Compression (inviwo::Compression)
+     */
+    virtual std::any getOption(std::string_view key) const override;
+
+    DatVolumeWriter& setCompression(Compression compression);
+    Compression getCompression() const;
+
+private:
+    Compression compression_ = Compression::Disabled;
 };
 
 namespace util {
 IVW_MODULE_BASE_API void writeDatVolume(const Volume& data, const std::filesystem::path& filePath,
-                                        Overwrite overwrite = Overwrite::No);
+                                        Overwrite overwrite = Overwrite::No,
+                                        Compression compression = Compression::Disabled);
 }
 
 }  // namespace inviwo
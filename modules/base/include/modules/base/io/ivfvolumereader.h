@@ -33,7 +33,9 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/io/datareader.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
 
+#include <any>
 #include <memory>
 #include <string_view>
 
@@ -53,6 +55,28 @@ public:
     virtual ~IvfVolumeReader() = default;
 
     virtual std::shared_ptr<Volume> readData(const std::filesystem::path& filePath) override;
+
+    /**
+     * Set any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual std::any getOption(std::string_view key) override;
+
+    /**
+     * Memory map the raw files instead of reading them, disabled by default.
+     * @see RawVolumeRAMLoader
+     */
+    IvfVolumeReader& setMemoryMapping(MemoryMapping memoryMapping);
+    MemoryMapping getMemoryMapping() const;
+
+private:
+    MemoryMapping memoryMapping_ = MemoryMapping::Disabled;
 };
 
 /**
@@ -70,6 +94,28 @@ public:
 
     virtual std::shared_ptr<VolumeSequence> readData(
         const std::filesystem::path& filePath) override;
+
+    /**
+     * Set any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the reader, supported keys:
+     * * MemoryMapping (MemoryMapping)
+     */
+    virtual std::any getOption(std::string_view key) override;
+
+    /**
+     * Memory map the raw files instead of reading them, disabled by default.
+     * @see RawVolumeRAMLoader
+     */
+    IvfVolumeSequenceReader& setMemoryMapping(MemoryMapping memoryMapping);
+    MemoryMapping getMemoryMapping() const;
+
+private:
+    MemoryMapping memoryMapping_ = MemoryMapping::Disabled;
 };
 
 }  // namespace inviwo
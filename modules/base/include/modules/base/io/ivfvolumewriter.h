@@ -33,7 +33,9 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/io/datawriter.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
 
+#include <any>
 #include <string_view>
 
 namespace inviwo {
@@ -96,6 +98,24 @@ public:
     virtual ~IvfVolumeWriter() = default;
 
     virtual void writeData(const Volume* data, const std::filesystem::path& filePath) const;
+
+    /**
+     * Set any of the settings supported by the writer, supported keys:
+     * * Compression (inviwo::Compression), defaults to Compression::Enabled
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the writer, supported keys:
+     * * Compression (inviwo::Compression)
+     */
+    virtual std::any getOption(std::string_view key) const override;
+
+    IvfVolumeWriter& setCompression(Compression compression);
+    Compression getCompression() const;
+
+private:
+    Compression compression_ = Compression::Enabled;
 };
 
 /**
@@ -147,12 +167,39 @@ public:
     virtual ~IvfVolumeSequenceWriter() = default;
 
     virtual void writeData(const VolumeSequence* data, const std::filesystem::path& filePath) const;
+
+    /**
+     * Set any of the settings supported by the writer, supported keys:
+     * * Compression (inviwo::Compression), defaults to Compression::Enabled
+     */
+    virtual bool setOption(std::string_view key, std::any value) override;
+
+    /**
+     * Get any of the settings supported by the writer, supported keys:
+     * * Compression (inviwo::Compression)
+     */
+    virtual std::any getOption(std::string_view key) const override;
+
+    IvfVolumeSequenceWriter& setCompression(Compression compression);
+    Compression getCompression() const;
+
+private:
+    Compression compression_ = Compression::Enabled;
 };
 
 namespace util {
 
+/**
+ * @brief Writes a volume to disk
+ *
+ * Creates one main file (<tt>[name].ivf</tt>) and one raw file, <tt>[name].raw</tt>,
+ * <tt>[name].raw.gz</tt> or <tt>[name].raw.zc</tt> depending on \p compression.
+ * Compression::Chunked writes a ChunkedRawFile which is compressed and read in parallel and
+ * supports reading sub regions.
+ */
 IVW_MODULE_BASE_API void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
-                                        Overwrite overwrite = Overwrite::Yes);
+                                        Overwrite overwrite = Overwrite::Yes,
+                                        Compression compression = Compression::Enabled);
 
 /**
  * @brief Writes a volume sequence to disk
@@ -166,13 +213,15 @@ IVW_MODULE_BASE_API void writeIvfVolume(const Volume& data, const std::filesyste
  * @param parentFolder    parent folder
  * @param relativePathToElements    path of raw files relative to \p path
  * @param overwrite       whether or not to overwrite existing files.
+ * @param compression     how to compress the raw files, see Compression
  * @return path to the created main file
  *
  * @see inviwo::IvfVolumeSequenceWriter inviwo::IvfVolumeSequenceReader
  */
 IVW_MODULE_BASE_API std::filesystem::path writeIvfVolumeSequence(
     const VolumeSequence& data, std::string_view name, const std::filesystem::path& parentFolder,
-    const std::filesystem::path& relativePathToElements = {}, Overwrite overwrite = Overwrite::Yes);
+    const std::filesystem::path& relativePathToElements = {}, Overwrite overwrite = Overwrite::Yes,
+    Compression compression = Compression::Enabled);
 
 }  // namespace util
 
@@ -31,6 +31,7 @@
 
 #include <modules/base/basemoduledefine.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/exporter.h>
 #include <inviwo/core/common/factoryutil.h>
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/properties/fileproperty.h>
@@ -42,15 +43,18 @@
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/util/fileextension.h>
 #include <inviwo/core/util/filedialogstate.h>
-#include <inviwo/core/common/factoryutil.h>
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <fmt/std.h>
 
 namespace inviwo {
 
 /**
- * A base class for simple export processors.
+ * A base class for simple export processors. Besides exporting on demand via the export button,
+ * the processor is also a DataExporter such that util::exportAllDataFiles will write its data.
  */
 template <typename DataType, typename PortType = DataInport<DataType>>
-class DataExport : public Processor {
+class DataExport : public Processor, public DataExporter {
 public:
     DataExport(DataWriterFactory* wf = util::getDataWriterFactory(),
                const std::filesystem::path& file = {},
@@ -64,10 +68,18 @@ public:
 
     virtual const ProcessorInfo& getProcessorInfo() const override = 0;
 
+    /**
+     * Export the data to `path/name.ext` where ext is the first of \p candidateExtensions with a
+     * matching writer. If none match, the extension selected in the file property is used.
+     */
+    virtual std::optional<std::filesystem::path> exportFile(
+        const std::filesystem::path& path, std::string_view name,
+        const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) const override;
+
 protected:
     void exportData();
 
-    virtual const DataType* getData() = 0;
+    virtual const DataType* getData() const = 0;
 
     DataWriterFactory* wf_;
     PortType port_;
@@ -135,7 +147,10 @@ void DataExport<DataType, PortType>::exportData() {
     }
 
     writer->setOverwrite(overwrite_ ? Overwrite::Yes : Overwrite::No);
-    writer->writeData(data, file_.get());
+    {
+        IVW_TRACE("write", file_.get().string());
+        writer->writeData(data, file_.get());
+    }
     log::info("Data exported to disk: {}", file_.get().string());
 
     // update widgets as the file might now exist
@@ -143,6 +158,45 @@ void DataExport<DataType, PortType>::exportData() {
     file_.updateWidgets();
 }
 
+template <typename DataType, typename PortType>
+std::optional<std::filesystem::path> DataExport<DataType, PortType>::exportFile(
+    const std::filesystem::path& path, std::string_view name,
+    const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) const {
+
+    const auto* data = getData();
+    if (!data) {
+        throw Exception(SourceContext{}, "Inport has no data");
+    }
+
+    const auto write = [&](std::unique_ptr<DataWriterType<DataType>> writer,
+                           std::string_view ext) {
+        const auto file = path / fmt::format("{}.{}", name, ext);
+        writer->setOverwrite(overwrite);
+        IVW_TRACE("write", file.string());
+        writer->writeData(data, file);
+        return file;
+    };
+
+    for (const auto& ext : candidateExtensions) {
+        if (auto writer = wf_->template getWriterForTypeAndExtension<DataType>(ext.extension)) {
+            return write(std::move(writer), ext.extension);
+        }
+    }
+
+    const auto& selected = file_.getSelectedExtension();
+    if (!selected.empty() && !selected.matchesAll()) {
+        if (auto writer = wf_->template getWriterForTypeAndExtension<DataType>(selected)) {
+            return write(std::move(writer), selected.extension);
+        }
+    }
+    if (const auto ext = file_.get().extension().string(); ext.size() > 1) {
+        if (auto writer = wf_->template getWriterForTypeAndExtension<DataType>(file_.get())) {
+            return write(std::move(writer), ext.substr(1));
+        }
+    }
+    return std::nullopt;
+}
+
 template <typename DataType, typename PortType>
 void DataExport<DataType, PortType>::process() {
     if (exportQueued_) exportData();
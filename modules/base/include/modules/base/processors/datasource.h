@@ -43,6 +43,7 @@
 #include <inviwo/core/util/fileextension.h>
 #include <inviwo/core/util/fileextensionutils.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <fmt/std.h>
 
@@ -184,6 +185,7 @@ void DataSource<DataType, PortType, ReaderType>::load() {
     if (auto reader =
             rf_->template getReaderForTypeAndExtension<ReaderType>(sext, filePath.get())) {
         try {
+            IVW_TRACE("read", filePath.get().string());
             auto data = transform(reader->readData(filePath.get()));
             port_.setData(data);
             if (deserialized_) {
@@ -41,6 +41,9 @@
 #include <inviwo/core/ports/dataoutport.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
+#include <inviwo/core/network/processornetworkobserver.h>
+#include <inviwo/core/processors/processorobserver.h>
+#include <inviwo/core/properties/propertyownerobserver.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/io/datawriterfactory.h>
 #include <inviwo/core/io/datareaderfactory.h>
@@ -55,6 +58,9 @@
 
 #include <filesystem>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <fmt/std.h>
 
@@ -62,9 +68,73 @@ namespace inviwo {
 
 namespace detail {
 
-IVW_MODULE_BASE_API std::string cacheState(Processor* p, ProcessorNetwork& net,
-                                           const std::filesystem::path& refPath,
-                                           std::pmr::string& xml);
+/**
+ * Serialize the state of all processors upstream of \p p, and the connections and links between
+ * them, into \p xml.
+ */
+IVW_MODULE_BASE_API void cacheStateXML(Processor* p, ProcessorNetwork& net,
+                                       const std::filesystem::path& refPath,
+                                       std::pmr::string& xml);
+
+/**
+ * Keeps a hash key of the state of all processors upstream of a cache processor. The key is
+ * updated incrementally: a processor is only serialized and hashed again after one of its
+ * properties has changed, and the upstream processors, connections, and links are only revisited
+ * after the network has changed. When nothing has changed, key() returns the previous key.
+ */
+class IVW_MODULE_BASE_API CacheState : public ProcessorNetworkObserver,
+                                       public ProcessorObserver,
+                                       public PropertyOwnerObserver {
+public:
+    explicit CacheState(Processor* cache);
+    CacheState(const CacheState&) = delete;
+    CacheState(CacheState&&) = delete;
+    CacheState& operator=(const CacheState&) = delete;
+    CacheState& operator=(CacheState&&) = delete;
+    virtual ~CacheState() = default;
+
+    void setNetwork(ProcessorNetwork* network);
+
+    const std::string& key(const std::filesystem::path& refPath);
+
+private:
+    struct Fingerprint {
+        std::optional<size_t> hash;
+        Processor::NameDispatcherHandle identifierChange;
+    };
+
+    void updateUpstream();
+    void track(Processor* p);
+    void untrack(Processor* p);
+    void processorChanged(Processor* p);
+    void networkChanged();
+
+    virtual void onProcessorNetworkDidAddConnection(const PortConnection&) override;
+    virtual void onProcessorNetworkDidRemoveConnection(const PortConnection&) override;
+    virtual void onProcessorNetworkDidAddLink(const PropertyLink&) override;
+    virtual void onProcessorNetworkDidRemoveLink(const PropertyLink&) override;
+    virtual void onProcessorNetworkWillRemoveProcessor(Processor* p) override;
+
+    virtual void onAboutPropertyChange(Property* property) override;
+    virtual void onProcessorPortAdded(Processor* p, Port*) override;
+    virtual void onProcessorPortRemoved(Processor* p, Port*) override;
+
+    virtual void onDidAddProperty(Property* property, size_t index) override;
+    virtual void onDidRemoveProperty(PropertyOwner* owner, Property* property,
+                                     size_t index) override;
+
+    Processor* cache_;
+    ProcessorNetwork* network_ = nullptr;
+    std::filesystem::path refPath_;
+
+    bool upstreamChanged_ = true;
+    bool changed_ = true;
+    /// The upstream processors, excluding the cache, sorted by identifier
+    std::vector<Processor*> processors_;
+    std::unordered_map<Processor*, Fingerprint> fingerprints_;
+    size_t connectionsHash_ = 0;
+    std::string key_;
+};
 
 template <typename... Types>
 void updateFilenameFilters(const DataReaderFactory& rf, const DataWriterFactory& wf,
@@ -103,7 +173,9 @@ protected:
 
     bool isCached_ = false;
     std::string key_;
-    std::pmr::string xml_;
+
+private:
+    detail::CacheState state_;
 };
 
 template <typename DataType>
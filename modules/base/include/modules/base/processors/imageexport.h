@@ -65,7 +65,7 @@ public:
 protected:
     void sendResizeEvent();
 
-    virtual const Layer* getData() override;
+    virtual const Layer* getData() const override;
     virtual void onProcessorNetworkDidAddConnection(const PortConnection&) override;
     virtual void onProcessorNetworkDidRemoveConnection(const PortConnection&) override;
 
@@ -45,7 +45,7 @@ public:
     static const ProcessorInfo processorInfo_;
 
 protected:
-    virtual const Layer* getData() override;
+    virtual const Layer* getData() const override;
 };
 
 }  // namespace inviwo
@@ -56,6 +56,7 @@ public:
     virtual ~MeshConverterProcessor() = default;
 
     virtual void process() override;
+    virtual bool isThreadSafe() const override;
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
@@ -52,7 +52,7 @@ public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
 
-    virtual const Mesh* getData() override;
+    virtual const Mesh* getData() const override;
 };
 
 }  // namespace inviwo
@@ -64,6 +64,7 @@ public:
         MarchingCubes,
         MarchingCubesOpt,
         MarchingTetrahedron,
+        MarchingCubesParallel,
     };
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
@@ -45,6 +45,7 @@ public:
     virtual ~TrianglesToWireframe() = default;
 
     virtual void process() override;
+    virtual bool isThreadSafe() const override;
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
@@ -51,7 +51,7 @@ public:
     static const ProcessorInfo processorInfo_;
 
 protected:
-    virtual const Volume* getData() override;
+    virtual const Volume* getData() const override;
 };
 
 }  // namespace inviwo
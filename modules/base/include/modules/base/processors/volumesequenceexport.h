@@ -50,7 +50,7 @@ public:
     static const ProcessorInfo processorInfo_;
 
 protected:
-    virtual const VolumeSequence* getData() override;
+    virtual const VolumeSequence* getData() const override;
 };
 
 }  // namespace inviwo
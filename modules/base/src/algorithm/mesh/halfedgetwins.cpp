@@ -0,0 +1,205 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/mesh/halfedgetwins.h>
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <ranges>
+#include <utility>
+
+namespace inviwo {
+
+namespace meshutil {
+
+namespace {
+
+constexpr std::size_t minChunkSize = 1 << 16;
+constexpr int radixBits = 11;
+constexpr std::size_t radixSize = std::size_t{1} << radixBits;
+
+/**
+ * Stable parallel LSD radix sort of keys with `keyBits` significant bits, the ids are permuted
+ * along with the keys. Each chunk counts its digits, the counts are turned into per chunk offsets
+ * and each chunk then scatters its elements independently.
+ */
+void radixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& ids, int keyBits,
+               std::size_t nChunks) {
+    const auto size = keys.size();
+    std::vector<std::uint64_t> keysTmp(size);
+    std::vector<std::uint32_t> idsTmp(size);
+    std::vector<std::size_t> counts(nChunks * radixSize);
+
+    const auto chunkBegin = [&](std::size_t c) { return size * c / nChunks; };
+
+    for (int shift = 0; shift < keyBits; shift += radixBits) {
+        std::ranges::fill(counts, 0);
+        util::forEachChunk(
+            nChunks,
+            [&](std::size_t firstChunk, std::size_t lastChunk) {
+                for (auto c = firstChunk; c < lastChunk; ++c) {
+                    auto* count = counts.data() + c * radixSize;
+                    for (auto i = chunkBegin(c); i < chunkBegin(c + 1); ++i) {
+                        ++count[(keys[i] >> shift) & (radixSize - 1)];
+                    }
+                }
+            },
+            1);
+
+        // Turn the counts into the offset of each chunk within each digit bucket
+        std::size_t total = 0;
+        bool sorted = false;
+        for (std::size_t digit = 0; digit < radixSize; ++digit) {
+            const auto start = total;
+            for (std::size_t c = 0; c < nChunks; ++c) {
+                total += std::exchange(counts[c * radixSize + digit], total);
+            }
+            // All elements in one bucket, the pass would not change the order
+            if (total - start == size) sorted = true;
+        }
+        if (sorted) continue;
+
+        util::forEachChunk(
+            nChunks,
+            [&](std::size_t firstChunk, std::size_t lastChunk) {
+                for (auto c = firstChunk; c < lastChunk; ++c) {
+                    auto* offset = counts.data() + c * radixSize;
+                    for (auto i = chunkBegin(c); i < chunkBegin(c + 1); ++i) {
+                        const auto dst = offset[(keys[i] >> shift) & (radixSize - 1)]++;
+                        keysTmp[dst] = keys[i];
+                        idsTmp[dst] = ids[i];
+                    }
+                }
+            },
+            1);
+        std::swap(keys, keysTmp);
+        std::swap(ids, idsTmp);
+    }
+}
+
+}  // namespace
+
+HalfEdgeTwins findHalfEdgeTwins(std::span<const std::uint32_t> triangles) {
+    if (triangles.size() % 3 != 0) {
+        throw Exception("Number of triangle indices has to be a multiple of three");
+    }
+    if (triangles.size() >= HalfEdgeTwins::noTwin) {
+        throw Exception("Too many triangles, the number of half edges has to fit in 32 bits");
+    }
+
+    const auto size = triangles.size();
+    HalfEdgeTwins result;
+    result.twins.assign(size, HalfEdgeTwins::noTwin);
+    if (size == 0) return result;
+
+    const auto nChunks = util::numberOfChunks(size, minChunkSize);
+    const auto chunkBegin = [&](std::size_t c) { return size * c / nChunks; };
+    const auto next = [](std::size_t h) { return h - h % 3 + (h + 1) % 3; };
+
+    // Only sort on the significant bits of the vertex indices
+    const auto vertexBits = std::max(1, std::bit_width(std::ranges::max(triangles)));
+    const auto vertexMask = (std::uint64_t{1} << vertexBits) - 1;
+
+    std::vector<std::uint64_t> keys(size);
+    std::vector<std::uint32_t> ids(size);
+    util::forEachChunk(
+        nChunks,
+        [&](std::size_t firstChunk, std::size_t lastChunk) {
+            for (auto c = firstChunk; c < lastChunk; ++c) {
+                for (auto h = chunkBegin(c); h < chunkBegin(c + 1); ++h) {
+                    const auto [lo, hi] = std::minmax(triangles[h], triangles[next(h)]);
+                    keys[h] = (std::uint64_t{lo} << vertexBits) | hi;
+                    ids[h] = static_cast<std::uint32_t>(h);
+                }
+            }
+        },
+        1);
+
+    radixSort(keys, ids, 2 * vertexBits, nChunks);
+
+    // The sort is stable, so every run of equal keys holds the half edges of one edge in triangle
+    // order. Chunks are moved forward to the start of a run so that no run is split.
+    const auto runBegin = [&](std::size_t c) {
+        auto i = chunkBegin(c);
+        while (i > 0 && i < size && keys[i] == keys[i - 1]) ++i;
+        return i;
+    };
+    std::vector<std::array<std::size_t, 3>> stats(nChunks, {0, 0, 0});
+    util::forEachChunk(
+        nChunks,
+        [&](std::size_t firstChunk, std::size_t lastChunk) {
+            for (auto c = firstChunk; c < lastChunk; ++c) {
+                auto& [edges, boundary, nonManifold] = stats[c];
+                const auto end = runBegin(c + 1);
+                for (auto begin = runBegin(c); begin < end;) {
+                    const auto key = keys[begin];
+                    auto last = begin + 1;
+                    while (last < end && keys[last] == key) ++last;
+                    const auto run = std::span{ids}.subspan(begin, last - begin);
+                    begin = last;
+
+                    // Degenerate edges have no twins
+                    if ((key >> vertexBits) == (key & vertexMask)) continue;
+
+                    ++edges;
+                    const auto isForward = [&](std::uint32_t h) {
+                        return triangles[h] < triangles[next(h)];
+                    };
+                    const auto forward = std::ranges::find_if(run, isForward);
+                    const auto backward = std::ranges::find_if_not(run, isForward);
+                    if (run.size() == 1) {
+                        ++boundary;
+                    } else if (run.size() > 2 || forward == run.end() || backward == run.end()) {
+                        ++nonManifold;
+                    }
+                    for (const auto h : run) {
+                        const auto twin = isForward(h) ? backward : forward;
+                        if (twin != run.end()) result.twins[h] = *twin;
+                    }
+                }
+            }
+        },
+        1);
+
+    for (const auto& [edges, boundary, nonManifold] : stats) {
+        result.edges += edges;
+        result.boundaryEdges += boundary;
+        result.nonManifoldEdges += nonManifold;
+    }
+    return result;
+}
+
+}  // namespace meshutil
+
+}  // namespace inviwo
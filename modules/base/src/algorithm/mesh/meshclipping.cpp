@@ -38,6 +38,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>
 #include <inviwo/core/datastructures/representationconverterfactory.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/glmutils.h>
@@ -45,13 +46,15 @@
 #include <inviwo/core/util/logcentral.h>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <iterator>
 #include <numeric>
+#include <ranges>
 #include <string>
 #include <string_view>
-#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -60,7 +63,7 @@
 #include <glm/ext/vector_relational.hpp>
 #include <glm/fwd.hpp>
 #include <glm/geometric.hpp>
-#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/component_wise.hpp>
 #include <glm/gtx/scalar_relational.hpp>
 #include <glm/mat4x4.hpp>
@@ -94,39 +97,50 @@ std::optional<glm::u32vec2> sutherlandHodgman(glm::u32vec3 triangle, const Plane
                                               std::vector<std::uint32_t>& indices,
                                               const InterpolateFunctor& addInterpolatedVertex) {
 
-    std::vector<std::uint32_t> newIndices;
-    std::vector<std::uint32_t> newEdge;
+    const glm::bvec3 inside{plane.isInside(positions[triangle[0]]),
+                            plane.isInside(positions[triangle[1]]),
+                            plane.isInside(positions[triangle[2]])};
+    if (!glm::any(inside)) return std::nullopt;
+    if (glm::all(inside)) {  // Case 1 for all edges
+        indices.push_back(triangle[1]);
+        indices.push_back(triangle[2]);
+        indices.push_back(triangle[0]);
+        return std::nullopt;
+    }
+
+    std::array<std::uint32_t, 4> newIndices{};
+    std::array<std::uint32_t, 2> newEdge{};
+    size_t nIndices = 0;
+    size_t nEdge = 0;
 
     for (size_t i = 0; i < 3; ++i) {
         const auto i1 = triangle[i];
         const auto i2 = triangle[(i + 1) % 3];
-        const auto v1 = positions[i1];
-        const auto v2 = positions[i2];
 
-        if (plane.isInside(v1)) {
-            if (plane.isInside(v2)) {  // Case 1
-                newIndices.push_back(i2);
+        if (inside[i]) {
+            if (inside[(i + 1) % 3]) {  // Case 1
+                newIndices[nIndices++] = i2;
             } else {  // Case 2
-                const auto weight = *plane.getIntersectionWeight(v1, v2);
+                const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
                 const auto newIndex =
                     addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt);
-                newIndices.push_back(newIndex);
-                newEdge.push_back(newIndex);
+                newIndices[nIndices++] = newIndex;
+                newEdge[nEdge++] = newIndex;
             }
-        } else if (plane.isInside(v2)) {  // Case 3
-            const auto weight = *plane.getIntersectionWeight(v1, v2);
+        } else if (inside[(i + 1) % 3]) {  // Case 3
+            const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
             const auto newIndex =
                 addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt);
-            newIndices.push_back(newIndex);
-            newEdge.push_back(newIndex);
-            newIndices.push_back(i2);
+            newIndices[nIndices++] = newIndex;
+            newEdge[nEdge++] = newIndex;
+            newIndices[nIndices++] = i2;
         }
     }
-    if (newIndices.size() == 3) {
+    if (nIndices == 3) {
         indices.push_back(newIndices[0]);
         indices.push_back(newIndices[1]);
         indices.push_back(newIndices[2]);
-    } else if (newIndices.size() == 4) {
+    } else if (nIndices == 4) {
         indices.push_back(newIndices[0]);
         indices.push_back(newIndices[1]);
         indices.push_back(newIndices[2]);
@@ -135,99 +149,153 @@ std::optional<glm::u32vec2> sutherlandHodgman(glm::u32vec3 triangle, const Plane
         indices.push_back(newIndices[2]);
         indices.push_back(newIndices[3]);
     }
-    if (newEdge.size() == 2) {
+    if (nEdge == 2) {
         return glm::u32vec2{newEdge[0], newEdge[1]};
     } else {
         return std::nullopt;
     }
 }
 
-void removeDuplicateEdges(std::vector<glm::u32vec2>& cuts, const std::vector<vec3>& positions,
-                          float eps) {
+namespace {
 
-    cuts.erase(
-        std::remove_if(cuts.begin(), cuts.end(),
-                       [&](glm::u32vec2 edge) {
-                           return glm::all(glm::equal(positions[edge[0]], positions[edge[1]], eps));
-                       }),
-        cuts.end());
-
-    std::transform(cuts.begin(), cuts.end(), cuts.begin(), [&](glm::u32vec2 edge) {
-        const auto pa = glm::value_ptr(positions[edge[0]]);
-        const auto pb = glm::value_ptr(positions[edge[1]]);
-        return std::lexicographical_compare(pa, pa + 3, pb, pb + 3)
-                   ? edge
-                   : glm::u32vec2{edge[1], edge[0]};
-    });
-
-    std::sort(cuts.begin(), cuts.end(), [&](glm::u32vec2 a, glm::u32vec2 b) {
-        const auto pa0 = glm::value_ptr(positions[a[0]]);
-        const auto pb0 = glm::value_ptr(positions[b[0]]);
-        if (std::lexicographical_compare(pa0, pa0 + 3, pb0, pb0 + 3)) {
-            return true;
-        } else if (std::lexicographical_compare(pb0, pb0 + 3, pa0, pa0 + 3)) {
-            return false;
-        } else {
-            const auto pa1 = glm::value_ptr(positions[a[1]]);
-            const auto pb1 = glm::value_ptr(positions[b[1]]);
-            return std::lexicographical_compare(pa1, pa1 + 3, pb1, pb1 + 3);
+// Map the end points of the edges to ids shared by all vertices at the same position, within eps
+std::vector<glm::u32vec2> weldEdges(const std::vector<glm::u32vec2>& edges,
+                                    const std::vector<vec3>& positions, float eps) {
+    // Vertices are hashed by their position quantized to cells of size eps. Two vertices closer
+    // than eps can end up in neighboring cells, hence all 27 neighbors are searched.
+    const auto cellSize = eps > 0.0f ? eps : 1.0f;
+    const auto cellOf = [&](const vec3& p) {
+        return glm::i64vec3{glm::floor(dvec3{p} / static_cast<double>(cellSize))};
+    };
+    const auto hash = [](const glm::i64vec3& c) {
+        const glm::u64vec3 u{c};
+        return std::hash<std::uint64_t>{}((u.x * 73856093u) ^ (u.y * 19349663u) ^
+                                          (u.z * 83492791u));
+    };
+    std::unordered_multimap<glm::i64vec3, std::uint32_t, decltype(hash)> cells(
+        2 * edges.size(), hash);
+    std::unordered_map<std::uint32_t, std::uint32_t> welded;
+    std::vector<std::uint32_t> representatives;
+
+    const auto weld = [&](std::uint32_t vertex) -> std::uint32_t {
+        if (const auto it = welded.find(vertex); it != welded.end()) return it->second;
+
+        const auto& pos = positions[vertex];
+        const auto cell = cellOf(pos);
+        for (std::int64_t z = -1; z <= 1; ++z) {
+            for (std::int64_t y = -1; y <= 1; ++y) {
+                for (std::int64_t x = -1; x <= 1; ++x) {
+                    const auto [begin, end] = cells.equal_range(cell + glm::i64vec3{x, y, z});
+                    for (auto it = begin; it != end; ++it) {
+                        const auto id = it->second;
+                        if (glm::all(glm::equal(positions[representatives[id]], pos, eps))) {
+                            welded.emplace(vertex, id);
+                            return id;
+                        }
+                    }
+                }
+            }
         }
-    });
-    cuts.erase(std::unique(cuts.begin(), cuts.end(),
-                           [&](glm::u32vec2 a, glm::u32vec2 b) {
-                               return glm::all(glm::equal(positions[a[0]], positions[b[0]], eps)) &&
-                                      glm::all(glm::equal(positions[a[1]], positions[b[1]], eps));
-                           }),
-               cuts.end());
+        const auto id = static_cast<std::uint32_t>(representatives.size());
+        representatives.push_back(vertex);
+        cells.emplace(cell, id);
+        welded.emplace(vertex, id);
+        return id;
+    };
+
+    std::vector<glm::u32vec2> res;
+    res.reserve(edges.size());
+    for (const auto& edge : edges) res.emplace_back(weld(edge[0]), weld(edge[1]));
+    return res;
+}
+
+}  // namespace
+
+void removeDuplicateEdges(std::vector<glm::u32vec2>& cuts, const std::vector<vec3>& positions,
+                          float eps) {
+    const auto welded = weldEdges(cuts, positions, eps);
+
+    std::unordered_set<std::uint64_t> seen(2 * cuts.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < cuts.size(); ++i) {
+        const auto a = std::min(welded[i][0], welded[i][1]);
+        const auto b = std::max(welded[i][0], welded[i][1]);
+        // Skip degenerate edges and edges already seen, in either direction
+        if (a == b || !seen.insert((std::uint64_t{a} << 32) | b).second) continue;
+        cuts[kept++] = cuts[i];
+    }
+    cuts.resize(kept);
 }
 
 std::vector<std::vector<std::uint32_t>> gatherLoops(std::vector<glm::u32vec2>& edges,
                                                     const std::vector<vec3>& positions, float eps) {
     std::vector<std::vector<std::uint32_t>> loops;
 
-    auto findMatch = [eps, &positions](std::vector<glm::u32vec2>& edges, std::uint32_t index) {
-        const auto it1 = std::find_if(edges.begin(), edges.end(), [&](glm::u32vec2 edge) {
-            return glm::all(glm::equal(positions[edge[0]], positions[index], eps));
-        });
-
-        if (it1 != edges.end()) {
-            return std::make_tuple(it1, (*it1)[1]);
+    const auto welded = weldEdges(edges, positions, eps);
+    const auto nVertices =
+        welded.empty() ? size_t{0}
+                       : size_t{1} + std::ranges::max(welded | std::views::transform([](auto e) {
+                                                          return glm::compMax(e);
+                                                      }));
+
+    // The edges incident to each welded vertex, as a compressed adjacency list
+    std::vector<size_t> offsets(nVertices + 1, 0);
+    for (const auto& edge : welded) {
+        ++offsets[edge[0] + 1];
+        ++offsets[edge[1] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<std::uint32_t> incident(offsets.back());
+    {
+        auto fill = offsets;
+        for (std::uint32_t e = 0; e < welded.size(); ++e) {
+            incident[fill[welded[e][0]]++] = e;
+            incident[fill[welded[e][1]]++] = e;
         }
-        const auto it2 = std::find_if(edges.begin(), edges.end(), [&](glm::u32vec2 edge) {
-            return glm::all(glm::equal(positions[edge[1]], positions[index], eps));
-        });
-
-        if (it2 != edges.end()) {
-            return std::make_tuple(it2, (*it2)[0]);
+    }
+    std::vector<bool> used(edges.size(), false);
+    size_t remaining = edges.size();
+
+    // Find an unused edge at vertex and return it together with the position of its other end
+    const auto findMatch = [&](std::uint32_t vertex) -> std::optional<std::pair<size_t, size_t>> {
+        for (auto i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+            const size_t e = incident[i];
+            if (used[e]) continue;
+            used[e] = true;
+            --remaining;
+            return std::pair{e, welded[e][0] == vertex ? size_t{1} : size_t{0}};
         }
-
-        return std::make_tuple(edges.end(), uint32_t{0});
+        return std::nullopt;
     };
 
-    while (!edges.empty()) {
+    for (size_t start = edges.size(); start-- > 0;) {
+        if (used[start]) continue;
+        used[start] = true;
+        --remaining;
+
         auto& loop = loops.emplace_back();
-        loop.push_back(edges.back()[0]);
-        loop.push_back(edges.back()[1]);
-        edges.pop_back();
-
-        while (!edges.empty()) {
-            const auto [it, index] = findMatch(edges, loop.back());
-            if (it != edges.end()) {
-                if (glm::all(glm::equal(positions[index], positions[loop.front()], eps))) {
-                    edges.erase(it);
-                    break;
-                } else {
-                    loop.push_back(index);
-                    edges.erase(it);
+        loop.push_back(edges[start][0]);
+        loop.push_back(edges[start][1]);
+        const auto front = welded[start][0];
+        auto current = welded[start][1];
+
+        while (true) {
+            const auto match = findMatch(current);
+            if (!match) {
+                if (remaining > 0) {
+                    log::warn(
+                        "Found edge that is not connected to any other edge. This could mean "
+                        "the clipped mesh was not a manifold.");
                 }
-            } else {
-                log::warn(
-                    "Found edge that is not connected to any other edge. This could mean "
-                    "the clipped mesh was not a manifold.");
                 break;
             }
+            const auto [e, end] = *match;
+            current = welded[e][end];
+            if (current == front) break;
+            loop.push_back(edges[e][end]);
         }
     }
+    edges.clear();
     return loops;
 }
 
@@ -336,6 +404,71 @@ void capHoles(std::vector<glm::u32vec2>& edges, const Plane& plane,
     }
 }
 
+/**
+ * Clip triangles in parallel chunks. Each chunk clips its triangles into local buffers, where new
+ * vertices get placeholder indices counted from the current number of vertices. Then the new
+ * vertices are added and the placeholders are offset chunk by chunk, in order, which gives the same
+ * result as clipping all triangles sequentially.
+ */
+template <typename GetTriangle>
+void clipTriangles(size_t nTriangles, GetTriangle getTriangle, const Plane& plane,
+                   const std::vector<vec3>& positions, std::vector<std::uint32_t>& outIndices,
+                   std::vector<glm::u32vec2>& newEdges,
+                   const InterpolateFunctor& addInterpolatedVertex) {
+    struct Cut {
+        std::uint32_t i1;
+        std::uint32_t i2;
+        float weight;
+    };
+    struct Chunk {
+        std::vector<std::uint32_t> indices;
+        std::vector<glm::u32vec2> edges;
+        std::vector<Cut> cuts;
+    };
+
+    constexpr size_t minChunkSize = 1 << 14;
+    const auto nChunks = util::numberOfChunks(nTriangles, minChunkSize);
+    const auto base = static_cast<std::uint32_t>(positions.size());
+
+    // Each chunk of triangles collects its own output, which is concatenated in order afterwards
+    std::vector<Chunk> chunks(nChunks);
+    const auto clipChunk = [&](size_t c) {
+        auto& chunk = chunks[c];
+        const InterpolateFunctor addCut = [&chunk, base](const std::vector<uint32_t>& indices,
+                                                         const std::vector<float>& weights,
+                                                         std::optional<vec3>) {
+            chunk.cuts.push_back(Cut{indices[0], indices[1], weights[1]});
+            return static_cast<std::uint32_t>(base + chunk.cuts.size() - 1);
+        };
+
+        const auto begin = c * nTriangles / nChunks;
+        const auto end = (c + 1) * nTriangles / nChunks;
+        chunk.indices.reserve(3 * (end - begin));
+        for (auto t = begin; t < end; ++t) {
+            if (auto newEdge = detail::sutherlandHodgman(getTriangle(t), plane, positions,
+                                                         chunk.indices, addCut)) {
+                chunk.edges.push_back(*newEdge);
+            }
+        }
+    };
+    util::forEachChunk(
+        nChunks,
+        [&](size_t firstChunk, size_t lastChunk) {
+            for (auto c = firstChunk; c < lastChunk; ++c) clipChunk(c);
+        },
+        1);
+
+    for (const auto& chunk : chunks) {
+        const auto offset = static_cast<std::uint32_t>(positions.size()) - base;
+        for (const auto& cut : chunk.cuts) {
+            addInterpolatedVertex({cut.i1, cut.i2}, {1.0f - cut.weight, cut.weight}, std::nullopt);
+        }
+        const auto remap = [&](std::uint32_t i) { return i >= base ? i + offset : i; };
+        std::ranges::transform(chunk.indices, std::back_inserter(outIndices), remap);
+        for (const auto& edge : chunk.edges) newEdges.emplace_back(remap(edge[0]), remap(edge[1]));
+    }
+}
+
 std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                                       std::shared_ptr<Mesh>& clippedMesh,
                                       const std::vector<uint32_t>& indices, const Plane& plane,
@@ -464,22 +597,20 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
         auto outIndices = clippedMesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
 
         if (meshInfo.ct == ConnectivityType::Strip) {
-            for (unsigned int t = 0; t < indices.size() - 2; ++t) {
-                const glm::u32vec3 triangle{indices[t], indices[t & 1 ? t + 2 : t + 1],
-                                            indices[t & 1 ? t + 1 : t + 2]};
-                auto newEdge = detail::sutherlandHodgman(triangle, plane, positions,
-                                                         outIndices->getDataContainer(),
-                                                         addInterpolatedVertex);
-                if (newEdge) newEdges.push_back(*newEdge);
-            }
+            clipTriangles(
+                indices.size() - 2,
+                [&](size_t t) {
+                    return glm::u32vec3{indices[t], indices[t & 1 ? t + 2 : t + 1],
+                                        indices[t & 1 ? t + 1 : t + 2]};
+                },
+                plane, positions, outIndices->getDataContainer(), newEdges, addInterpolatedVertex);
         } else if (meshInfo.ct == ConnectivityType::None) {
-            for (unsigned int t = 0; t < indices.size() - 2; t += 3) {
-                const glm::u32vec3 triangle{indices[t], indices[t + 1], indices[t + 2]};
-                auto newEdge = detail::sutherlandHodgman(triangle, plane, positions,
-                                                         outIndices->getDataContainer(),
-                                                         addInterpolatedVertex);
-                if (newEdge) newEdges.push_back(*newEdge);
-            }
+            clipTriangles(
+                indices.size() / 3,
+                [&](size_t t) {
+                    return glm::u32vec3{indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+                },
+                plane, positions, outIndices->getDataContainer(), newEdges, addInterpolatedVertex);
         } else {
             throw Exception("Cannot clip, need triangle connectivity Strip or None");
         }
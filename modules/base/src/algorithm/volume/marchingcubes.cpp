@@ -41,16 +41,18 @@
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/glmvec.h>
 #include <modules/base/algorithm/volume/surfaceextraction.h>
-#include <modules/base/datastructures/kdtree.h>
+#include <modules/base/datastructures/flatkdtree.h>
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <type_traits>
 #include <unordered_set>
 #include <vector>
 
 #include <glm/detail/setup.hpp>
+#include <glm/ext/scalar_constants.hpp>
 #include <glm/fwd.hpp>
 #include <glm/geometric.hpp>
 #include <glm/vec3.hpp>
@@ -558,9 +560,12 @@ std::array<std::vector<Triangle>, 256> cases = {
     std::vector<Triangle>{Triangle{0, 1, 3, 0, 0, 4}},
     std::vector<Triangle>{}};
 
-void evaluateCube(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
-                  std::vector<vec3>& positions, std::vector<vec3>& normals,
-                  const std::array<vec3, 8>& pos, const std::array<double, 8>& values) {
+/**
+ * Appends the corners of the triangles of the cube to triangleCorners, the vertices are welded
+ * afterwards.
+ */
+void evaluateCube(std::vector<vec3>& triangleCorners, const std::array<vec3, 8>& pos,
+                  const std::array<double, 8>& values) {
     int index = 0;
 
     //  v7 ----- v6
@@ -586,11 +591,55 @@ void evaluateCube(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffe
             float t = static_cast<float>(v0 / (v0 - v1));
             return pos[a] + t * (pos[b] - pos[a]);
         };
-        vec3 p0 = interpolate(t.e0a, t.e0b);
-        vec3 p1 = interpolate(t.e1a, t.e1b);
-        vec3 p2 = interpolate(t.e2a, t.e2b);
+        triangleCorners.push_back(interpolate(t.e0a, t.e0b));
+        triangleCorners.push_back(interpolate(t.e1a, t.e1b));
+        triangleCorners.push_back(interpolate(t.e2a, t.e2b));
+    }
+}
+
+/**
+ * Merges triangle corners closer than the epsilon used by marching::addVertex, in order of
+ * appearance, and adds the resulting triangles. Triangles where two corners are merged are
+ * dropped.
+ */
+void weldTriangles(const std::vector<vec3>& triangleCorners, IndexBufferRAM* indexBuffer,
+                   std::vector<vec3>& positions, std::vector<vec3>& normals) {
+    using Tree = FlatKDTree<3, float>;
+    const Tree tree{triangleCorners};
+    const auto neighbors = tree.withinRadius(triangleCorners, std::sqrt(glm::epsilon<float>()));
+
+    std::vector<Tree::Index> vertexIds(triangleCorners.size(), Tree::npos);
+    for (size_t i = 0; i < triangleCorners.size(); ++i) {
+        if (vertexIds[i] != Tree::npos) continue;
+        const auto id = static_cast<Tree::Index>(positions.size());
+        positions.push_back(triangleCorners[i]);
+        normals.push_back(vec3(0, 0, 0));
+        for (const auto j : neighbors[i]) {
+            if (vertexIds[j] == Tree::npos) vertexIds[j] = id;
+        }
+    }
 
-        marching::addTriangle(vertexTree, indexBuffer, positions, normals, p0, p1, p2);
+    auto& indices = indexBuffer->getDataContainer();
+    indices.reserve(indices.size() + triangleCorners.size());
+    for (size_t t = 0; t + 2 < triangleCorners.size(); t += 3) {
+        const auto i0 = vertexIds[t];
+        const auto i1 = vertexIds[t + 1];
+        const auto i2 = vertexIds[t + 2];
+        if (i0 == i1 || i0 == i2 || i1 == i2) {
+            // triangle is so small so that the vertices are merged.
+            continue;
+        }
+        indices.push_back(i0);
+        indices.push_back(i1);
+        indices.push_back(i2);
+
+        const vec3 e0 = triangleCorners[t + 1] - triangleCorners[t];
+        const vec3 e1 = triangleCorners[t + 2] - triangleCorners[t];
+        const vec3 n = glm::normalize(glm::cross(e0, e1));
+
+        normals[i0] += n;
+        normals[i1] += n;
+        normals[i2] += n;
     }
 }
 
@@ -610,8 +659,6 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
             throw Exception("Masking callback not set");
         }
 
-        K3DTree<size_t, float> vertexTree;
-
         auto mesh = std::make_shared<BasicMesh>();
         auto indexBuffer = mesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
 
@@ -629,10 +676,7 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
         dy = 1.0 / static_cast<double>(std::max(size_t(1), (dim.y - 1)));
         dz = 1.0 / static_cast<double>(std::max(size_t(1), (dim.z - 1)));
 
-        const auto volSize = dim.x * dim.y * dim.z;
-        indexBuffer->getDataContainer().reserve(volSize * 6);
-        positions.reserve(volSize * 6);
-        normals.reserve(volSize * 6);
+        std::vector<vec3> triangleCorners;
 
         for (size_t k = 0; k < dim.z - 1; k++) {
             for (size_t j = 0; j < dim.y - 1; j++) {
@@ -651,8 +695,7 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
                         values[l] = marching::getValue(src, size3_t(i, j, k) + o, dim, iso, invert);
                     }
 
-                    marchingcubes::evaluateCube(vertexTree, indexBuffer.get(), positions, normals,
-                                                pos, values);
+                    marchingcubes::evaluateCube(triangleCorners, pos, values);
                 }
             }
             if (progressCallback) {
@@ -660,6 +703,8 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
             }
         }
 
+        marchingcubes::weldTriangles(triangleCorners, indexBuffer.get(), positions, normals);
+
         if (enclose) {
             marching::encloseSurfce(src, dim, indexBuffer.get(), positions, normals, iso, invert,
                                     dx, dy, dz);
@@ -43,13 +43,18 @@
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/indexmapper.h>
 #include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
 #include <modules/base/algorithm/volume/surfaceextraction.h>
 #include <modules/base/datastructures/disjointsets.h>
 
 #include <algorithm>
+#include <bit>
 #include <bitset>
 #include <cstdint>
+#include <future>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
@@ -270,7 +275,7 @@ class VCache {
 public:
     enum CacheName { xCacheCurr, xCacheNext, yCacheCurr, yCacheNext, zCacheCurr, zCacheNext };
     enum CachePosName { xCurr0, xCurr1, xNext0, xNext1, yCurr, yNext, zCurr, zNext };
-    VCache(const size2_t& dim) : cIm{dim} {
+    VCache(const size2_t& dim, size_t zBegin = 0) : cIm{dim}, zBegin_{zBegin} {
         cache[xCacheCurr].resize(dim.x * dim.y);
         cache[xCacheNext].resize(dim.x * dim.y);
         cache[yCacheCurr].resize(dim.x * dim.y);
@@ -282,28 +287,28 @@ public:
     std::pair<size_t, bool> find(const size3_t& ind, int edge, const size_t& val) {
         switch (edge) {
             case 0:
-                if (ind.z == 0 && ind.y == 0) {
+                if (ind.z == zBegin_ && ind.y == 0) {
                     cache[xCacheCurr][cIm(pos[xCurr0], ind.y)] = val;
                     return {val, true};
                 } else {
                     return {cache[xCacheCurr][cIm(pos[xCurr0], ind.y)], false};
                 }
             case 1:
-                if (ind.z == 0) {
+                if (ind.z == zBegin_) {
                     cache[yCacheCurr][cIm(pos[yCurr] + 1, ind.y)] = val;
                     return {val, true};
                 } else {
                     return {cache[yCacheCurr][cIm(pos[yCurr] + 1, ind.y)], false};
                 }
             case 2:
-                if (ind.z == 0) {
+                if (ind.z == zBegin_) {
                     cache[xCacheCurr][cIm(pos[xCurr1], ind.y + 1)] = val;
                     return {val, true};
                 } else {
                     return {cache[xCacheCurr][cIm(pos[xCurr1], ind.y + 1)], false};
                 }
             case 3:
-                if (ind.z == 0 && ind.x == 0) {
+                if (ind.z == zBegin_ && ind.x == 0) {
                     cache[yCacheCurr][cIm(pos[yCurr], ind.y)] = val;
                     return {val, true};
                 } else {
@@ -381,6 +386,7 @@ public:
 
 private:
     util::IndexMapper2D cIm;
+    size_t zBegin_;
     std::array<std::vector<size_t>, 6> cache;
     std::array<size_t, 8> pos;
 };
@@ -455,13 +461,223 @@ template <typename T, typename IsoTest>
 const std::array<OffsetIndexMasks, 4> Index<T, IsoTest>::oim_ = {
     {{0, 1, {0, 0, 0}}, {3, 2, {0, 1, 0}}, {4, 5, {0, 0, 1}}, {7, 6, {0, 1, 1}}}};
 
-}  // namespace
+const marching::Config& cubeConfig() {
+    static const marching::Config cube{};
+    return cube;
+}
 
-namespace util {
-std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, double iso,
-                                       const vec4& color, bool invert, bool enclose,
-                                       std::function<void(float)> progressCallback,
-                                       std::function<bool(const size3_t&)> maskingCallback) {
+/**
+ * The part of the surface extracted from the cells with z-index in [zBegin, zEnd). Vertices on
+ * the x and y edges of the first and last z-plane of the slab are recorded together with a key
+ * for the edge, such that they can be welded with the vertices of the neighboring slabs.
+ */
+struct Slab {
+    size_t zBegin;
+    size_t zEnd;
+    std::vector<vec3> positions;
+    std::vector<vec3> normals;
+    std::vector<std::uint32_t> indices;
+    std::vector<std::pair<size_t, std::uint32_t>> bottom;
+    std::vector<std::pair<size_t, std::uint32_t>> top;
+};
+
+/**
+ * Unique key of a x or y edge in a z-plane, edges 0 to 3 of the cube at ind are in the bottom
+ * plane and 8 to 11 in the top plane.
+ */
+size_t planeEdgeKey(const size3_t& ind, size_t dimX, marching::Config::EdgeId edge) {
+    switch (edge % 8) {
+        case 0:
+            return 2 * (ind.y * dimX + ind.x);
+        case 1:
+            return 2 * (ind.y * dimX + ind.x + 1) + 1;
+        case 2:
+            return 2 * ((ind.y + 1) * dimX + ind.x);
+        default:
+            return 2 * (ind.y * dimX + ind.x) + 1;
+    }
+}
+
+/**
+ * The edges of the cube that will get a new vertex in the VCache for the cell at ind, matches the
+ * conditions in VCache::find.
+ */
+std::uint32_t newEdgesMask(const size3_t& ind, size_t zBegin) {
+    std::uint32_t mask = (1u << 6) | (1u << 9) | (1u << 10);
+    if (ind.y == 0) mask |= (1u << 5) | (1u << 8);
+    if (ind.x == 0) mask |= (1u << 7) | (1u << 11);
+    if (ind.x == 0 && ind.y == 0) mask |= (1u << 4);
+    if (ind.z == zBegin) {
+        mask |= (1u << 1) | (1u << 2);
+        if (ind.y == 0) mask |= (1u << 0);
+        if (ind.x == 0) mask |= (1u << 3);
+    }
+    return mask;
+}
+
+/**
+ * Counts the number of vertices and triangles that the slab will produce, used to size the
+ * buffers before extracting the surface. The masking callback is not evaluated, hence the counts
+ * are upper bounds.
+ */
+template <typename T, typename IsoTest>
+std::pair<size_t, size_t> countSlab(const T* src, const size3_t& dim, const IsoTest& isoTest,
+                                    size_t zBegin, size_t zEnd) {
+    const auto& cube = cubeConfig();
+    static const auto caseEdgeMasks = util::make_array<256>([&](size_t i) {
+        std::uint32_t mask = 0;
+        for (const auto edge : cube.caseEdges[i]) mask |= 1u << edge;
+        return mask;
+    });
+
+    const util::IndexMapper3D im(dim);
+    Index<T, IsoTest> index(src, im, isoTest);
+    size_t vertices = 0;
+    size_t triangles = 0;
+    size3_t ind;
+    for (ind.z = zBegin; ind.z < zEnd; ++ind.z) {
+        for (ind.y = 0; ind.y < dim.y - 1; ++ind.y) {
+            ind.x = 0;
+            const auto cInd = im(ind);
+            index.init(cInd);
+            for (; ind.x < dim.x - 1; ++ind.x) {
+                index.update(cInd + ind.x);
+                if (index == 0 || index == 255) continue;
+                vertices += static_cast<size_t>(
+                    std::popcount(caseEdgeMasks[index] & newEdgesMask(ind, zBegin)));
+                triangles += cube.caseTriangles[index].size();
+            }
+        }
+    }
+    return {vertices, triangles};
+}
+
+template <typename T, typename IsoTest, typename MapValue>
+void extractSlab(Slab& slab, const T* src, const size3_t& dim, const IsoTest& isoTest,
+                 const MapValue& mapValue,
+                 const std::function<bool(const size3_t&)>& maskingCallback,
+                 const std::function<void(float)>& progressCallback) {
+    const auto& cube = cubeConfig();
+
+    const size3_t dim1 = dim - size3_t{1, 1, 1};
+    const util::IndexMapper3D im(dim);
+
+    const auto dr = dvec3(1.0) / dvec3{glm::max(size3_t{1}, (dim - size3_t{1}))};
+    const auto doffs = [&]() {
+        std::array<dvec3, 8> tmp;
+        std::transform(cube.vertices.begin(), cube.vertices.end(), tmp.begin(),
+                       [dr](auto& v) { return dr * dvec3{v}; });
+        return tmp;
+    }();
+
+    const auto interpolate = [src, im, &cube, &mapValue, &doffs](
+                                 const size3_t& ind, const dvec3& pos, marching::Config::EdgeId e) {
+        const auto a = cube.edges[e][0];
+        const auto b = cube.edges[e][1];
+        const auto tv0 = src[im(ind + cube.vertices[a])];
+        const auto v0 = mapValue(tv0);
+        const auto tv1 = src[im(ind + cube.vertices[b])];
+        const auto v1 = mapValue(tv1);
+
+        const auto t = v0 / (v0 - v1);
+        const auto r0 = pos + doffs[a];
+        const auto r1 = pos + doffs[b];
+        return r0 + t * (r1 - r0);
+    };
+
+    auto& positions = slab.positions;
+    auto& normals = slab.normals;
+    auto& indices = slab.indices;
+
+    // Only record the boundary vertices that are shared with another slab
+    const bool stitchBottom = slab.zBegin > 0;
+    const bool stitchTop = slab.zEnd < dim1.z;
+
+    VCache vcache(size2_t{dim.x, dim.y}, slab.zBegin);
+    Index<T, IsoTest> index(src, im, isoTest);
+    size3_t ind;
+    dvec3 pos;
+
+    const float err =
+        static_cast<float>(4.0 * glm::epsilon<double>() * glm::epsilon<double>() * dr.x * dr.y);
+
+    for (ind.z = slab.zBegin, pos.z = static_cast<double>(slab.zBegin) * dr.z; ind.z < slab.zEnd;
+         ++ind.z, pos.z += dr.z) {
+        vcache.incZ();
+        const bool bottom = stitchBottom && ind.z == slab.zBegin;
+        const bool top = stitchTop && ind.z + 1 == slab.zEnd;
+        for (ind.y = 0, pos.y = 0.0; ind.y < dim1.y; ++ind.y, pos.y += dr.y) {
+            ind.x = 0;
+            const auto cInd = im(ind);
+            vcache.incY();
+            index.init(cInd);
+            for (pos.x = 0.0; ind.x < dim1.x; ++ind.x, pos.x += dr.x) {
+                index.update(cInd + ind.x);
+                if (index == 0 || index == 255) continue;
+                if (maskingCallback && !maskingCallback(ind)) continue;
+
+                std::array<size_t, 12> inds;
+                for (const auto edge : cube.caseEdges[index]) {
+                    const auto c = vcache.find(ind, edge, positions.size());
+                    inds[edge] = c.first;
+                    if (c.second) {
+                        const auto vertex = interpolate(ind, pos, edge);
+                        if (bottom && edge < 4) {
+                            slab.bottom.emplace_back(planeEdgeKey(ind, dim.x, edge),
+                                                     static_cast<std::uint32_t>(c.first));
+                        } else if (top && edge >= 8) {
+                            slab.top.emplace_back(planeEdgeKey(ind, dim.x, edge),
+                                                  static_cast<std::uint32_t>(c.first));
+                        }
+                        positions.emplace_back(vertex);
+                        normals.emplace_back(0.0f, 0.0f, 0.0f);
+                    }
+                }
+                for (const auto& tri : cube.caseTriangles[index]) {
+                    const auto side0 = positions[inds[tri[1]]] - positions[inds[tri[0]]];
+                    const auto side1 = positions[inds[tri[2]]] - positions[inds[tri[0]]];
+                    auto n = glm::cross(side0, side1);
+                    if (glm::length2(n) < err) {
+                        continue;  // triangle is so small area is 0.
+                    }
+                    n = glm::normalize(n);
+                    for (int v = 0; v < 3; ++v) {
+                        indices.push_back(static_cast<std::uint32_t>(inds[tri[v]]));
+                        normals[inds[tri[v]]] += n;
+                    }
+                }
+                vcache.incX(cube.caseIncrements[index]);
+            }
+        }
+        if (progressCallback) {
+            progressCallback(static_cast<float>(ind.z + 1) / static_cast<float>(dim1.z));
+        }
+    }
+}
+
+/**
+ * Vertices of slab k that lie on the same edge as a vertex of slab k - 1, as pairs of
+ * {vertex in slab k, vertex in slab k - 1}. Both boundaries have to be sorted by edge key.
+ */
+std::vector<std::pair<std::uint32_t, std::uint32_t>> findWelds(const Slab& below,
+                                                               const Slab& slab) {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> welds;
+    welds.reserve(slab.bottom.size());
+    auto it = below.top.begin();
+    for (const auto& [key, vertex] : slab.bottom) {
+        it = std::lower_bound(it, below.top.end(), key,
+                              [](const auto& item, size_t k) { return item.first < k; });
+        if (it == below.top.end()) break;
+        if (it->first == key) welds.emplace_back(vertex, it->second);
+    }
+    return welds;
+}
+
+std::shared_ptr<Mesh> marchingCubesSlabs(const std::shared_ptr<const Volume>& volume, double iso,
+                                         const vec4& color, bool invert, bool enclose,
+                                         const std::function<void(float)>& progressCallback,
+                                         const std::function<bool(const size3_t&)>& maskingCallback,
+                                         size_t nSlabs) {
 
     auto indexBuffer = std::make_shared<IndexBuffer>();
     auto vertexBuffer = std::make_shared<Buffer<vec3>>();
@@ -480,84 +696,122 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
 
     const auto mc = [&](auto ram, auto isoTest, auto mapValue) {
         using T = util::PrecisionValueType<decltype(ram)>;
-        static const marching::Config cube{};
 
         const T* src = ram->getDataTyped();
         const size3_t dim{volume->getDimensions()};
-        const size3_t dim1 = dim - size3_t{1, 1, 1};
-        const util::IndexMapper3D im(dim);
-
+        const size_t cellsZ = dim.z > 0 ? dim.z - 1 : 0;
         const auto dr = dvec3(1.0) / dvec3{glm::max(size3_t{1}, (dim - size3_t{1}))};
-        const auto doffs = [&]() {
-            std::array<dvec3, 8> tmp;
-            std::transform(cube.vertices.begin(), cube.vertices.end(), tmp.begin(),
-                           [dr](auto& v) { return dr * dvec3{v}; });
-            return tmp;
-        }();
-
-        const auto interpolate = [src, im, &mapValue, &doffs](const size3_t& ind, const dvec3& pos,
-                                                              marching::Config::EdgeId e) {
-            const auto a = cube.edges[e][0];
-            const auto b = cube.edges[e][1];
-            const auto tv0 = src[im(ind + cube.vertices[a])];
-            const auto v0 = mapValue(tv0);
-            const auto tv1 = src[im(ind + cube.vertices[b])];
-            const auto v1 = mapValue(tv1);
-
-            const auto t = v0 / (v0 - v1);
-            const auto r0 = pos + doffs[a];
-            const auto r1 = pos + doffs[b];
-            return r0 + t * (r1 - r0);
-        };
 
-        VCache vcache(size2_t{dim.x, dim.y});
-        Index<T, decltype(isoTest)> index(src, im, isoTest);
-        size3_t ind;
-        dvec3 pos;
-
-        const float err =
-            static_cast<float>(4.0 * glm::epsilon<double>() * glm::epsilon<double>() * dr.x * dr.y);
-
-        for (ind.z = 0, pos.z = 0.0; ind.z < dim1.z; ++ind.z, pos.z += dr.z) {
-            vcache.incZ();
-            for (ind.y = 0, pos.y = 0.0; ind.y < dim1.y; ++ind.y, pos.y += dr.y) {
-                ind.x = 0;
-                const auto cInd = im(ind);
-                vcache.incY();
-                index.init(cInd);
-                for (pos.x = 0.0; ind.x < dim1.x; ++ind.x, pos.x += dr.x) {
-                    index.update(cInd + ind.x);
-                    if (index == 0 || index == 255) continue;
-                    if (maskingCallback && !maskingCallback(ind)) continue;
-
-                    std::array<size_t, 12> inds;
-                    for (const auto edge : cube.caseEdges[index]) {
-                        const auto c = vcache.find(ind, edge, positions.size());
-                        inds[edge] = c.first;
-                        if (c.second) {
-                            const auto vertex = interpolate(ind, pos, edge);
-                            positions.emplace_back(vertex);
-                            normals.emplace_back(0.0f, 0.0f, 0.0f);
-                        }
+        nSlabs = std::clamp<size_t>(nSlabs, 1, std::max<size_t>(cellsZ, 1));
+
+        if (nSlabs == 1) {
+            Slab slab{.zBegin = 0, .zEnd = cellsZ};
+            extractSlab(slab, src, dim, isoTest, mapValue, maskingCallback, progressCallback);
+            positions = std::move(slab.positions);
+            normals = std::move(slab.normals);
+            indices = std::move(slab.indices);
+        } else {
+            std::vector<Slab> slabs(nSlabs);
+            for (size_t i = 0; i < nSlabs; ++i) {
+                slabs[i].zBegin = i * cellsZ / nSlabs;
+                slabs[i].zEnd = (i + 1) * cellsZ / nSlabs;
+            }
+
+            // Without a thread pool the slabs are processed one by one on the calling thread
+            ThreadPool* pool = util::getPoolSize() > 0 ? &util::getThreadPool() : nullptr;
+            std::vector<std::future<void>> futures;
+            futures.reserve(nSlabs);
+            const auto dispatch = [&](auto&& task) {
+                if (pool) {
+                    futures.push_back(pool->enqueue(std::forward<decltype(task)>(task)));
+                } else {
+                    task();
+                }
+            };
+            const auto waitAll = [&]() {
+                for (auto& f : futures) pool->wait(f);
+                for (auto& f : futures) f.get();
+                futures.clear();
+            };
+
+            for (auto& slab : slabs) {
+                dispatch([&slab, src, dim, &isoTest, &mapValue, &maskingCallback]() {
+                    const auto [nVertices, nTriangles] =
+                        countSlab(src, dim, isoTest, slab.zBegin, slab.zEnd);
+                    slab.positions.reserve(nVertices);
+                    slab.normals.reserve(nVertices);
+                    slab.indices.reserve(3 * nTriangles);
+                    extractSlab(slab, src, dim, isoTest, mapValue, maskingCallback, nullptr);
+                    const auto byKey = [](const auto& a, const auto& b) {
+                        return a.first < b.first;
+                    };
+                    std::ranges::sort(slab.bottom, byKey);
+                    std::ranges::sort(slab.top, byKey);
+                });
+            }
+            for (size_t i = 0; i < futures.size(); ++i) {
+                pool->wait(futures[i]);
+                if (progressCallback) {
+                    progressCallback(0.9f * static_cast<float>(i + 1) /
+                                     static_cast<float>(nSlabs));
+                }
+            }
+            waitAll();
+
+            // Stitch the slabs, vertices on the shared planes are replaced by the vertex of the
+            // slab below.
+            std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> welds(nSlabs);
+            std::vector<size_t> vertexOffsets(nSlabs + 1, 0);
+            std::vector<size_t> indexOffsets(nSlabs + 1, 0);
+            for (size_t i = 0; i < nSlabs; ++i) {
+                if (i > 0) welds[i] = findWelds(slabs[i - 1], slabs[i]);
+                vertexOffsets[i + 1] =
+                    vertexOffsets[i] + slabs[i].positions.size() - welds[i].size();
+                indexOffsets[i + 1] = indexOffsets[i] + slabs[i].indices.size();
+            }
+
+            positions.resize(vertexOffsets.back());
+            normals.resize(vertexOffsets.back());
+            indices.resize(indexOffsets.back());
+
+            constexpr auto welded = std::numeric_limits<std::uint32_t>::max();
+            std::vector<std::vector<std::uint32_t>> remaps(nSlabs);
+            for (size_t i = 0; i < nSlabs; ++i) {
+                dispatch([&, i]() {
+                    const auto& slab = slabs[i];
+                    auto& remap = remaps[i];
+                    remap.assign(slab.positions.size(), 0);
+                    for (const auto& weld : welds[i]) remap[weld.first] = welded;
+
+                    auto next = static_cast<std::uint32_t>(vertexOffsets[i]);
+                    for (size_t v = 0; v < slab.positions.size(); ++v) {
+                        if (remap[v] == welded) continue;
+                        positions[next] = slab.positions[v];
+                        normals[next] = slab.normals[v];
+                        remap[v] = next++;
                     }
-                    for (const auto& tri : cube.caseTriangles[index]) {
-                        const auto side0 = positions[inds[tri[1]]] - positions[inds[tri[0]]];
-                        const auto side1 = positions[inds[tri[2]]] - positions[inds[tri[0]]];
-                        auto n = glm::cross(side0, side1);
-                        if (glm::length2(n) < err) {
-                            continue;  // triangle is so small area is 0.
-                        }
-                        n = glm::normalize(n);
-                        for (int v = 0; v < 3; ++v) {
-                            indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
-                            normals[inds[tri[v]]] += n;
-                        }
+                });
+            }
+            waitAll();
+            // The vertices of the slab below are compacted as well, the welds can only be
+            // resolved once all slabs have their remapping.
+            for (size_t i = 0; i < nSlabs; ++i) {
+                dispatch([&, i]() {
+                    auto& remap = remaps[i];
+                    for (const auto& [vertex, target] : welds[i]) {
+                        remap[vertex] = remaps[i - 1][target];
                     }
-                    vcache.incX(cube.caseIncrements[index]);
-                }
+                    std::ranges::transform(slabs[i].indices, indices.begin() + indexOffsets[i],
+                                           [&](std::uint32_t v) { return remap[v]; });
+                });
             }
-            if (progressCallback) {
-                progressCallback(static_cast<float>(ind.z + 1) / static_cast<float>(dim.z - 1));
+            waitAll();
+
+            // The welded vertices get the normal contributions from both sides
+            for (size_t i = 1; i < nSlabs; ++i) {
+                for (const auto& weld : welds[i]) {
+                    normals[remaps[i][weld.first]] += slabs[i].normals[weld.first];
+                }
             }
         }
 
@@ -607,6 +861,34 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
 
     return mesh;
 }
+
+}  // namespace
+
+namespace util {
+std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, double iso,
+                                       const vec4& color, bool invert, bool enclose,
+                                       std::function<void(float)> progressCallback,
+                                       std::function<bool(const size3_t&)> maskingCallback) {
+    return marchingCubesSlabs(volume, iso, color, invert, enclose, progressCallback,
+                              maskingCallback, 1);
+}
+
+std::shared_ptr<Mesh> marchingCubesParallel(std::shared_ptr<const Volume> volume, double iso,
+                                            const vec4& color, bool invert, bool enclose,
+                                            std::function<void(float)> progressCallback,
+                                            std::function<bool(const size3_t&)> maskingCallback,
+                                            size_t slabs) {
+    if (slabs == 0) {
+        // A few slabs per thread to even out the load, but keep the slabs thick enough that the
+        // duplicated boundary planes are a small fraction of the work.
+        const size_t cellsZ = volume->getDimensions().z > 0 ? volume->getDimensions().z - 1 : 0;
+        slabs = std::min(4 * util::getPoolSize(), cellsZ / 8);
+    }
+
+    return marchingCubesSlabs(volume, iso, color, invert, enclose, progressCallback,
+                              maskingCallback, slabs);
+}
+
 }  // namespace util
 
 }  // namespace inviwo
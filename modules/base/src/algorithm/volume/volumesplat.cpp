@@ -33,19 +33,27 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
 #include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/threadpool.h>
 #include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/glm.h>
 
 #include <glm/common.hpp>
+#include <glm/vector_relational.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 #include <glm/mat3x3.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <future>
+#include <limits>
+#include <optional>
+#include <utility>
 #include <vector>
 #include <numbers>
 
@@ -117,12 +125,139 @@ inline float kernelNormFactor(float s) {
     }
 }
 
+// Number of points between each progress and stop check
+constexpr std::size_t checkInterval = 4096;
+
+// A point transformed to world space, and its footprint in index space clamped to the volume
+struct Footprint {
+    vec3 pos;
+    float size;
+    float weight;
+    float support;
+    ivec3 lo;  //!< first voxel of the footprint
+    ivec3 hi;  //!< one past the last voxel of the footprint
+};
+
+template <SplatKernel K>
+struct Footprints {
+    std::span<const vec3> positions;
+    std::span<const float> sizes;
+    std::span<const float> weights;
+    mat4 pointTransform;
+    mat4 worldToIndex;
+    vec3 voxelSizeWorld;
+    ivec3 dims;
+    float size;
+    float weight;
+    float error;
+
+    std::optional<Footprint> operator()(std::size_t p) const {
+        const vec3 pw = util::transformPos(pointTransform, positions[p]);
+        const float s = (sizes.empty() ? 1.0f : sizes[p]) * size;
+        const float w = (weights.empty() ? 1.0f : weights[p]) * weight;
+        if (s <= 0.0f || w <= 0.0f) return std::nullopt;
+
+        const float support = [&]() {
+            if constexpr (K == SplatKernel::Gaussian) {
+                return static_cast<float>(gaussian_support(s, error));
+            } else {
+                return s;
+            }
+        }();
+
+        // Conservative footprint in index space
+        const vec3 footprintIndex = vec3{support} / voxelSizeWorld;
+        const vec3 centerIndex = vec3{worldToIndex * vec4{pw, 1.0f}};
+
+        const auto lo = glm::max(ivec3{glm::floor(centerIndex - footprintIndex)}, ivec3{0});
+        const auto hi = glm::min(ivec3{glm::ceil(centerIndex + footprintIndex)} + ivec3{1}, dims);
+        if (glm::any(glm::greaterThanEqual(lo, hi))) return std::nullopt;
+
+        return Footprint{.pos = pw, .size = s, .weight = w, .support = support, .lo = lo, .hi = hi};
+    }
+};
+
+/**
+ * The indices of the points overlapping each slab, stored contiguously per slab. Within a slab the
+ * points keep their input order, hence the accumulation order does not depend on the binning.
+ */
+struct SlabBins {
+    std::vector<std::uint32_t> indices;
+    std::vector<std::size_t> offsets;  //!< the points of slab i are [offsets[i], offsets[i + 1])
+};
+
+/**
+ * Bin the points by the slabs their footprints overlap using a parallel counting sort. The points
+ * are split into chunks that are first counted and then scattered independently.
+ * @param slabs the slab index of each z slice of the volume
+ */
+template <SplatKernel K>
+SlabBins binPoints(const Footprints<K>& footprints, const std::vector<std::size_t>& slabs,
+                   std::size_t nSlabs) {
+    constexpr std::size_t minChunkSize = 1 << 16;
+    const auto nPoints = footprints.positions.size();
+    const auto nChunks = util::numberOfChunks(nPoints, minChunkSize);
+
+    const auto forEachOverlap = [&](std::size_t c, auto&& f) {
+        const auto end = (c + 1) * nPoints / nChunks;
+        for (auto p = c * nPoints / nChunks; p < end; ++p) {
+            if (const auto fp = footprints(p)) {
+                const auto last = slabs[static_cast<std::size_t>(fp->hi.z - 1)];
+                for (auto slab = slabs[static_cast<std::size_t>(fp->lo.z)]; slab <= last; ++slab) {
+                    f(p, slab);
+                }
+            }
+        }
+    };
+
+    // counts[c * nSlabs + slab] is the number of points in chunk c overlapping slab
+    std::vector<std::size_t> counts(nChunks * nSlabs, 0);
+    util::forEachChunk(
+        nChunks,
+        [&](std::size_t firstChunk, std::size_t lastChunk) {
+            for (auto c = firstChunk; c < lastChunk; ++c) {
+                auto* count = counts.data() + c * nSlabs;
+                forEachOverlap(c, [&](std::size_t, std::size_t slab) { ++count[slab]; });
+            }
+        },
+        1);
+
+    // Turn the counts into the offset of each chunk within each slab
+    SlabBins bins{.indices = {}, .offsets = std::vector<std::size_t>(nSlabs + 1, 0)};
+    std::size_t total = 0;
+    for (std::size_t slab = 0; slab < nSlabs; ++slab) {
+        bins.offsets[slab] = total;
+        for (std::size_t c = 0; c < nChunks; ++c) {
+            total += std::exchange(counts[c * nSlabs + slab], total);
+        }
+    }
+    bins.offsets[nSlabs] = total;
+
+    bins.indices.resize(total);
+    util::forEachChunk(
+        nChunks,
+        [&](std::size_t firstChunk, std::size_t lastChunk) {
+            for (auto c = firstChunk; c < lastChunk; ++c) {
+                auto* offset = counts.data() + c * nSlabs;
+                forEachOverlap(c, [&](std::size_t p, std::size_t slab) {
+                    bins.indices[offset[slab]++] = static_cast<std::uint32_t>(p);
+                });
+            }
+        },
+        1);
+    return bins;
+}
+
 template <SplatKernel K>
 std::vector<std::function<vec2(const std::function<void(double)>&, const std::function<bool()>&)>>
 splatImpl(std::span<const vec3> positions, std::span<const float> sizes,
           std::span<const float> weights, const SplatSettings& settings, mat4 indexToWorld,
           mat4 worldToIndex, float* data) {
 
+    if (positions.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw Exception("Too many points to splat");
+    }
+
     const auto dims = settings.dimensions;
 
     // basis matrix in world space: columns are the volume-axis vectors in world units
@@ -135,13 +270,27 @@ splatImpl(std::span<const vec3> positions, std::span<const float> sizes,
         vec3{glm::length(basisWorld[0]), glm::length(basisWorld[1]), glm::length(basisWorld[2])} /
         vec3{dims};
 
-    const mat4 pointTransform{settings.pointTransform};
-
-    const float size = settings.size;
-    const float weight = settings.weight;
-    const float error = settings.error;
-    const bool perPointSize = !sizes.empty();
-    const bool perPointWeight = !weights.empty();
+    const Footprints<K> footprints{.positions = positions,
+                                   .sizes = sizes,
+                                   .weights = weights,
+                                   .pointTransform = settings.pointTransform,
+                                   .worldToIndex = worldToIndex,
+                                   .voxelSizeWorld = voxelSizeWorld,
+                                   .dims = ivec3{dims},
+                                   .size = settings.size,
+                                   .weight = settings.weight,
+                                   .error = settings.error};
+
+    // For an axis aligned grid the voxel coordinates, and hence the squared distances, are
+    // separable and can be computed once per axis and point instead of once per voxel.
+    const bool axisAligned = [&]() {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                if (i != j && indexToWorld[i][j] != 0.0f) return false;
+            }
+        }
+        return true;
+    }();
 
     const std::size_t poolSize = util::getPoolSize();
     std::size_t nJobs = settings.jobs;
@@ -151,67 +300,98 @@ splatImpl(std::span<const vec3> positions, std::span<const float> sizes,
     nJobs = std::min(nJobs, dims.z);
     if (nJobs == 0) nJobs = 1;
 
-    auto processSlab = [&](std::size_t zStart, std::size_t zStop) {
-        return [zStart, zStop, positions, sizes, weights, indexToWorld, worldToIndex, data, dims,
-                size, weight, error, perPointSize, perPointWeight, voxelSizeWorld, pointTransform](
+    // With a single slab every point is visited anyway, no need to bin them
+    std::shared_ptr<const SlabBins> bins;
+    if (nJobs > 1) {
+        std::vector<std::size_t> slabs(dims.z);
+        for (std::size_t j = 0; j < nJobs; ++j) {
+            std::fill(slabs.begin() + j * dims.z / nJobs, slabs.begin() + (j + 1) * dims.z / nJobs,
+                      j);
+        }
+        bins = std::make_shared<const SlabBins>(binPoints(footprints, slabs, nJobs));
+    }
+
+    auto processSlab = [&](std::size_t slab, std::size_t zStart, std::size_t zStop) {
+        return [slab, zStart, zStop, footprints, bins, indexToWorld, data, dims, axisAligned](
                    const std::function<void(double)>& progress, const std::function<bool()>& stop) {
             const util::IndexMapper3D idx(dims);
-            const auto dimsI = ivec3{dims};
 
             auto minMax =
                 vec2{std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
 
-            for (std::size_t p = 0; p < positions.size(); ++p) {
-                if (stop && stop()) return minMax;
-                if (progress) {
-                    progress(static_cast<double>(p) / static_cast<double>(positions.size()));
-                }
-                const vec3 pw = util::transformPos(pointTransform, positions[p]);
-                const float s = (perPointSize ? sizes[p] : 1.0f) * size;
-                const float w = (perPointWeight ? weights[p] : 1.0f) * weight;
-                if (s <= 0.0f || w <= 0.0f) continue;
-
-                const float support = [&]() {
-                    if constexpr (K == SplatKernel::Gaussian) {
-                        return static_cast<float>(gaussian_support(s, error));
-                    } else {
-                        (void)error;
-                        return s;
-                    }
-                }();
+            // Squared distances and kernel values along each axis for the axis aligned case
+            std::array<std::vector<float>, 3> dist2;
+            std::array<std::vector<float>, 3> kernel;
 
-                // Conservative footprint in index space
-                const vec3 footprintWorld{support, support, support};
-                const vec3 footprintIndex = footprintWorld / voxelSizeWorld;
-                const vec3 centerIndex = vec3{worldToIndex * vec4{pw, 1.0f}};
+            const auto first = bins ? bins->offsets[slab] : 0;
+            const auto count =
+                bins ? bins->offsets[slab + 1] - first : footprints.positions.size();
 
-                const auto lo = ivec3{glm::floor(centerIndex - footprintIndex)};
-                const auto hi = ivec3{glm::ceil(centerIndex + footprintIndex)} + ivec3{1};
+            for (std::size_t i = 0; i < count; ++i) {
+                if (i % checkInterval == 0) {
+                    if (stop && stop()) return minMax;
+                    if (progress) {
+                        progress(static_cast<double>(i) / static_cast<double>(count));
+                    }
+                }
+                const auto fp = footprints(bins ? bins->indices[first + i] : i);
+                if (!fp) continue;
 
-                const int z0 = std::max(lo.z, static_cast<int>(zStart));
-                const int z1 = std::min(hi.z, static_cast<int>(zStop));
+                const int z0 = std::max(fp->lo.z, static_cast<int>(zStart));
+                const int z1 = std::min(fp->hi.z, static_cast<int>(zStop));
                 if (z0 >= z1) continue;
 
-                const int y0 = std::max(lo.y, 0);
-                const int y1 = std::min(hi.y, dimsI.y);
-                if (y0 >= y1) continue;
-
-                const int x0 = std::max(lo.x, 0);
-                const int x1 = std::min(hi.x, dimsI.x);
-                if (x0 >= x1) continue;
-
-                const float support2 = support * support;
-
-                const auto f = w * kernelNormFactor<K>(s);
-                for (int z = z0; z < z1; ++z) {
-                    for (int y = y0; y < y1; ++y) {
-                        for (int x = x0; x < x1; ++x) {
-                            const auto voxelWorld = vec3{indexToWorld * vec4{ivec3{x, y, z}, 1.0f}};
-                            const vec3 d = voxelWorld - pw;
-                            const float d2 = glm::dot(d, d);
-                            if (d2 > support2) continue;
-                            const float contrib = f * evalKernel<K>(d2, s);
-                            data[idx(size3_t{x, y, z})] += contrib;
+                const float s = fp->size;
+                const float support2 = fp->support * fp->support;
+                const auto f = fp->weight * kernelNormFactor<K>(s);
+
+                if (axisAligned) {
+                    const ivec3 lo{fp->lo.x, fp->lo.y, z0};
+                    const ivec3 hi{fp->hi.x, fp->hi.y, z1};
+                    for (int a = 0; a < 3; ++a) {
+                        dist2[a].resize(static_cast<std::size_t>(hi[a] - lo[a]));
+                        kernel[a].resize(dist2[a].size());
+                        for (int v = lo[a]; v < hi[a]; ++v) {
+                            const float d = indexToWorld[a][a] * static_cast<float>(v) +
+                                            indexToWorld[3][a] - fp->pos[a];
+                            const auto k = static_cast<std::size_t>(v - lo[a]);
+                            dist2[a][k] = d * d;
+                            if constexpr (K == SplatKernel::Gaussian) {
+                                kernel[a][k] = evalKernel<K>(d * d, s);
+                            }
+                        }
+                    }
+                    for (int z = lo.z; z < hi.z; ++z) {
+                        const auto kz = static_cast<std::size_t>(z - lo.z);
+                        for (int y = lo.y; y < hi.y; ++y) {
+                            const auto ky = static_cast<std::size_t>(y - lo.y);
+                            const float d2yz = dist2[2][kz] + dist2[1][ky];
+                            if (d2yz > support2) continue;
+                            float* row = data + idx(size3_t{0, y, z});
+                            for (int x = lo.x; x < hi.x; ++x) {
+                                const auto kx = static_cast<std::size_t>(x - lo.x);
+                                const float d2 = d2yz + dist2[0][kx];
+                                if (d2 > support2) continue;
+                                if constexpr (K == SplatKernel::Gaussian) {
+                                    // The Gaussian is separable as well
+                                    row[x] += f * kernel[2][kz] * kernel[1][ky] * kernel[0][kx];
+                                } else {
+                                    row[x] += f * evalKernel<K>(d2, s);
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    for (int z = z0; z < z1; ++z) {
+                        for (int y = fp->lo.y; y < fp->hi.y; ++y) {
+                            for (int x = fp->lo.x; x < fp->hi.x; ++x) {
+                                const auto voxelWorld =
+                                    vec3{indexToWorld * vec4{ivec3{x, y, z}, 1.0f}};
+                                const vec3 d = voxelWorld - fp->pos;
+                                const float d2 = glm::dot(d, d);
+                                if (d2 > support2) continue;
+                                data[idx(size3_t{x, y, z})] += f * evalKernel<K>(d2, s);
+                            }
                         }
                     }
                 }
@@ -234,13 +414,13 @@ splatImpl(std::span<const vec3> positions, std::span<const float> sizes,
         std::function<vec2(const std::function<void(double)>&, const std::function<bool()>&)>>
         jobs;
     if (nJobs == 1) {
-        jobs.emplace_back(processSlab(0, dims.z));
+        jobs.emplace_back(processSlab(0, 0, dims.z));
     } else {
         for (std::size_t j = 0; j < nJobs; ++j) {
             const std::size_t zStart = j * dims.z / nJobs;
             const std::size_t zStop = (j + 1) * dims.z / nJobs;
             if (zStart >= zStop) continue;
-            jobs.emplace_back(processSlab(zStart, zStop));
+            jobs.emplace_back(processSlab(j, zStart, zStop));
         }
     }
     return jobs;
@@ -29,7 +29,6 @@
 
 #include <modules/base/algorithm/volume/volumevoronoi.h>
 
-#include <inviwo/core/algorithm/buildarray.h>
 #include <inviwo/core/datastructures/datamapper.h>
 #include <inviwo/core/datastructures/image/imagetypes.h>
 #include <inviwo/core/datastructures/volume/volume.h>
@@ -39,18 +38,18 @@
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/indexmapper.h>
 #include <inviwo/core/util/volumeramutils.h>
-#include <inviwo/core/util/zip.h>
+#include <modules/base/datastructures/flatkdtree.h>
 
 #include <algorithm>
-#include <array>
+#include <cmath>
 #include <cstddef>
-#include <functional>
-#include <string>
-#include <string_view>
-#include <type_traits>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include <glm/geometric.hpp>
-#include <glm/gtx/norm.hpp>
+#include <glm/mat3x3.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
@@ -58,82 +57,112 @@
 namespace inviwo {
 namespace util {
 
-namespace detail {
-template <Wrapping X, Wrapping Y, Wrapping Z>
-auto distance2(const vec3& a, const vec3& b, const mat3& dataToModelMatrix) {
-    auto delta = b - a;
-
-    if constexpr (X == Wrapping::Repeat) {
-        if (delta.x > 0.5f) delta.x -= 1.0f;
-        if (delta.x < -0.5f) delta.x += 1.0f;
-    }
-
-    if constexpr (Y == Wrapping::Repeat) {
-        if (delta.y > 0.5f) delta.y -= 1.0f;
-        if (delta.y < -0.5f) delta.y += 1.0f;
+namespace {
+
+/**
+ * Seed positions in model space, repeated by the volume size along each axis with repeat
+ * wrapping. The periodic distance to a seed is then the distance to the closest of its images.
+ * Returns the positions and the index of the seed of each position. The images are ordered by
+ * seed, so that the KD-tree, which resolves ties to the lowest index, resolves ties to the first
+ * seed.
+ */
+std::pair<std::vector<dvec3>, std::vector<size_t>> periodicImages(
+    const std::vector<std::pair<unsigned short, vec3>>& dataSeedPoints, const dmat3& d2m,
+    const Wrapping3D& wrapping) {
+
+    const auto shifts = [&](size_t axis) -> std::vector<double> {
+        if (wrapping[axis] == Wrapping::Repeat) return {0.0, -1.0, 1.0};
+        return {0.0};
+    };
+
+    std::vector<dvec3> positions;
+    std::vector<size_t> seeds;
+    for (size_t i = 0; i < dataSeedPoints.size(); ++i) {
+        for (const auto dz : shifts(2)) {
+            for (const auto dy : shifts(1)) {
+                for (const auto dx : shifts(0)) {
+                    const dvec3 shift{dx, dy, dz};
+                    positions.push_back(d2m * (dvec3{dataSeedPoints[i].second} + shift));
+                    seeds.push_back(i);
+                }
+            }
+        }
     }
+    return {std::move(positions), std::move(seeds)};
+}
 
-    if constexpr (Z == Wrapping::Repeat) {
-        if (delta.z > 0.5f) delta.z -= 1.0f;
-        if (delta.z < -0.5f) delta.z += 1.0f;
+/**
+ * The periodic distance is the minimum image distance in data space, i.e. the data space
+ * difference is wrapped into [-0.5, 0.5] along each repeating axis before it is transformed to
+ * model space. The closest image in model space only matches that when the basis vector of each
+ * repeating axis is orthogonal to the other basis vectors.
+ */
+bool imagesMatchMinimumImage(const dmat3& d2m, const Wrapping3D& wrapping) {
+    constexpr double tolerance = 1e-6;
+    for (int i = 0; i < 3; ++i) {
+        if (wrapping[i] != Wrapping::Repeat) continue;
+        for (int j = 0; j < 3; ++j) {
+            if (i == j) continue;
+            const auto limit = tolerance * glm::length(d2m[i]) * glm::length(d2m[j]);
+            if (std::abs(glm::dot(d2m[i], d2m[j])) > limit) return false;
+        }
     }
-
-    return glm::length2(dataToModelMatrix * delta);
+    return true;
 }
 
-}  // namespace detail
-
-template <Wrapping X, Wrapping Y, Wrapping Z>
-void voronoiSegmentationImpl(
-    const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
-    const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
-    VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
-
+/**
+ * Brute force search using the minimum image distance, used for repeat wrapping with a skewed
+ * basis. Ties are resolved to the first seed.
+ */
+void assignMinimumImageSeed(const size3_t volumeDimensions, const mat4& indexToDataMatrix,
+                            const dmat3& d2m,
+                            const std::vector<std::pair<unsigned short, vec3>>& dataSeedPoints,
+                            const std::optional<std::vector<float>>& weights,
+                            const Wrapping3D& wrapping,
+                            VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
     auto volumeIndices = voronoiVolumeRep.getDataTyped();
-    util::IndexMapper3D index(volumeDimensions);
-
-    // We can ignore any translations
-    const auto d2m = mat3{dataToModelMatrix};
+    const util::IndexMapper3D index(volumeDimensions);
 
     util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
-        const auto dataVoxelPos = vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
-        const auto it =
-            std::min_element(seedPointsWithIndices.cbegin(), seedPointsWithIndices.cend(),
-                             [&](const auto& p1, const auto& p2) {
-                                 return detail::distance2<X, Y, Z>(p1.second, dataVoxelPos, d2m) <
-                                        detail::distance2<X, Y, Z>(p2.second, dataVoxelPos, d2m);
-                             });
-        volumeIndices[index(voxelPos)] = it->first;
+        const auto dataVoxelPos = dvec3{vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}}};
+        size_t best = 0;
+        double bestDist = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < dataSeedPoints.size(); ++i) {
+            auto delta = dataVoxelPos - dvec3{dataSeedPoints[i].second};
+            for (int axis = 0; axis < 3; ++axis) {
+                if (wrapping[axis] != Wrapping::Repeat) continue;
+                if (delta[axis] > 0.5) delta[axis] -= 1.0;
+                if (delta[axis] < -0.5) delta[axis] += 1.0;
+            }
+            const auto w = weights ? static_cast<double>((*weights)[i]) : 0.0;
+            const auto dist = glm::dot(d2m * delta, d2m * delta) - w * w;
+            if (dist < bestDist) {
+                bestDist = dist;
+                best = i;
+            }
+        }
+        volumeIndices[index(voxelPos)] = dataSeedPoints[best].first;
     });
 }
 
-template <Wrapping X, Wrapping Y, Wrapping Z>
-void weightedVoronoiSegmentationImpl(
-    const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
-    const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
-    const std::vector<float>& weights, VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
-
+template <typename Tree, typename ToTreeSpace>
+void assignNearestSeed(const size3_t volumeDimensions, const mat4& indexToDataMatrix,
+                       const dmat3& d2m, const Tree& tree, const std::vector<size_t>& seeds,
+                       const std::vector<std::pair<unsigned short, vec3>>& dataSeedPoints,
+                       ToTreeSpace toTreeSpace,
+                       VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
     auto volumeIndices = voronoiVolumeRep.getDataTyped();
-    util::IndexMapper3D index(volumeDimensions);
-
-    // We can ignore any translations
-    const auto d2m = mat3{dataToModelMatrix};
+    const util::IndexMapper3D index(volumeDimensions);
 
     util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
-        const auto dataVoxelPos = vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
-        auto zipped = util::zip(seedPointsWithIndices, weights);
-
-        const auto&& [posWithIndex, weight] =
-            *std::min_element(zipped.begin(), zipped.end(), [&](auto&& i1, auto&& i2) {
-                auto&& [p1, w1] = i1;
-                auto&& [p2, w2] = i2;
-                return detail::distance2<X, Y, Z>(p1.second, dataVoxelPos, d2m) - w1 * w1 <
-                       detail::distance2<X, Y, Z>(p2.second, dataVoxelPos, d2m) - w2 * w2;
-            });
-        volumeIndices[index(voxelPos)] = posWithIndex.first;
+        const auto dataVoxelPos = dvec3{vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}}};
+        const auto nearest = tree.nearest(toTreeSpace(d2m * dataVoxelPos));
+        volumeIndices[index(voxelPos)] = dataSeedPoints[seeds[nearest]].first;
     });
 }
 
+}  // namespace
+
 std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
@@ -184,62 +213,36 @@ std::shared_ptr<Volume> voronoiSegmentation(
                            vec3{modelToDataMatrix * vec4{pair.second, 1.0f}}};
                    });
 
-    if (weights.has_value()) {
-        using Functor = void (*)(const size3_t, const mat4&, const mat4&,
-                                 const std::vector<std::pair<unsigned short, vec3>>&,
-                                 const std::vector<float>&, VolumeRAMPrecision<unsigned short>&);
-
-        constexpr auto table = util::build_array<3>([&](auto x) constexpr {
-            return util::build_array<3>([&](auto y) constexpr {
-                return util::build_array<3>([&](auto z) constexpr -> Functor {
-                    return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
-                              const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              const std::vector<float>& w,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
-                        using XT = decltype(x);
-                        using YT = decltype(y);
-                        using ZT = decltype(z);
-                        constexpr auto X = static_cast<Wrapping>(XT::value);
-                        constexpr auto Y = static_cast<Wrapping>(YT::value);
-                        constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        weightedVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, w, volRep);
-                    };
-                });
-            });
-        });
-
-        table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
-             [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
-                                                dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *weights, *voronoiVolumeRep);
+    // We can ignore any translations, the nearest seed is found in model space to respect the
+    // metric of the basis.
+    const auto d2m = dmat3{dataToModelMatrix};
+    if (!imagesMatchMinimumImage(d2m, wrapping)) {
+        assignMinimumImageSeed(volumeDimensions, indexToDataMatrix, d2m, dataSeedPointsWithIndices,
+                               weights, wrapping, *voronoiVolumeRep);
+        return voronoiVolume;
+    }
+    const auto [positions, seeds] = periodicImages(dataSeedPointsWithIndices, d2m, wrapping);
 
+    if (weights.has_value()) {
+        // The power distance |x - p|^2 - w^2 is lifted to a euclidean distance in 4D by adding
+        // sqrt(maxW2 - w^2) as a fourth coordinate to each seed and 0 to the voxel positions.
+        // This only adds the constant maxW2 to all distances.
+        double maxW2 = 0.0;
+        for (const auto w : *weights) maxW2 = std::max(maxW2, static_cast<double>(w) * w);
+        std::vector<dvec4> lifted(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            const auto w = static_cast<double>((*weights)[seeds[i]]);
+            lifted[i] = dvec4{positions[i], std::sqrt(std::max(0.0, maxW2 - w * w))};
+        }
+        const FlatKDTree<4, double> tree{lifted};
+        assignNearestSeed(volumeDimensions, indexToDataMatrix, d2m, tree, seeds,
+                          dataSeedPointsWithIndices,
+                          [](const dvec3& pos) { return dvec4{pos, 0.0}; }, *voronoiVolumeRep);
     } else {
-        using Functor = void (*)(const size3_t, const mat4&, const mat4&,
-                                 const std::vector<std::pair<unsigned short, vec3>>&,
-                                 VolumeRAMPrecision<unsigned short>&);
-
-        constexpr auto table = util::build_array<3>([&](auto x) constexpr {
-            return util::build_array<3>([&](auto y) constexpr {
-                return util::build_array<3>([&](auto z) constexpr -> Functor {
-                    return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
-                              const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
-                        using XT = decltype(x);
-                        using YT = decltype(y);
-                        using ZT = decltype(z);
-                        constexpr auto X = static_cast<Wrapping>(XT::value);
-                        constexpr auto Y = static_cast<Wrapping>(YT::value);
-                        constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        voronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, volRep);
-                    };
-                });
-            });
-        });
-
-        table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
-             [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
-                                                dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *voronoiVolumeRep);
+        const FlatKDTree<3, double> tree{positions};
+        assignNearestSeed(volumeDimensions, indexToDataMatrix, d2m, tree, seeds,
+                          dataSeedPointsWithIndices, [](const dvec3& pos) { return pos; },
+                          *voronoiVolumeRep);
     }
 
     return voronoiVolume;
@@ -151,6 +151,7 @@
 #include <modules/base/processors/volumesequenceexport.h>
 #include <modules/base/processors/volumesequencesingletimestepsampler.h>
 #include <modules/base/processors/volumesequencesource.h>
+#include <modules/base/processors/volumesequencestreamselect.h>
 #include <modules/base/processors/volumesequencetospatial4dsampler.h>
 #include <modules/base/processors/volumeshifter.h>
 #include <modules/base/processors/volumesliceextractor.h>
@@ -292,6 +293,7 @@ BaseModule::BaseModule(InviwoApplication* app) : InviwoModule(app, "Base") {
     registerProcessor<VolumeSequenceExport>();
     registerProcessor<VolumeSequenceSingleTimestepSamplerProcessor>();
     registerProcessor<VolumeSequenceSource>();
+    registerProcessor<VolumeSequenceStreamSelect>();
     registerProcessor<VolumeSequenceToSpatial4DSampler>();
     registerProcessor<VolumeShifter>();
     registerProcessor<VolumeSliceExtractor>();
@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/io/datareader.h>
 #include <inviwo/core/io/datareaderexception.h>
@@ -49,14 +50,21 @@
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/hashcombine.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/zip.h>
+#include <inviwo/core/algorithm/histogram1d.h>
 #include <modules/base/algorithm/algorithmoptions.h>
 #include <modules/base/algorithm/dataminmax.h>
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <future>
 #include <iterator>
+#include <limits>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -141,6 +149,8 @@ std::unordered_map<std::string_view, parser> getParsers() {
                   state.compression = Compression::Enabled;
               } else if (val == toLower(format_as(Compression::Disabled))) {
                   state.compression = Compression::Disabled;
+              } else if (val == toLower(format_as(Compression::Chunked))) {
+                  state.compression = Compression::Chunked;
               } else {
                   ss.setstate(std::ios_base::failbit);
               }
@@ -380,10 +390,9 @@ std::shared_ptr<Volume> createVolume(const State& state) {
     return volume;
 }
 
-std::shared_ptr<VolumeDisk> createDiskRepWithLoader(const State& state,
-                                                    const std::filesystem::path& datPath,
-                                                    const std::filesystem::path& rawPath,
-                                                    size_t offset) {
+std::shared_ptr<VolumeDisk> createDiskRepWithLoader(
+    const State& state, const std::filesystem::path& datPath, const std::filesystem::path& rawPath,
+    size_t offset, MemoryMapping memoryMapping = MemoryMapping::Disabled) {
 
     auto diskRepr =
         std::make_shared<VolumeDisk>(datPath, state.dimensions, state.format, state.swizzleMask,
@@ -391,22 +400,27 @@ std::shared_ptr<VolumeDisk> createDiskRepWithLoader(const State& state,
 
     const auto filePos = offset + state.byteOffset;
 
-    auto loader =
-        std::make_unique<RawVolumeRAMLoader>(rawPath, filePos, state.byteOrder, state.compression);
+    auto loader = std::make_unique<RawVolumeRAMLoader>(rawPath, filePos, state.byteOrder,
+                                                       state.compression, memoryMapping);
     diskRepr->setLoader(loader.release());
 
     return diskRepr;
 }
 
-void updateDataRange(Volume& volume, const State& state) {
+dvec2 computeDataRange(const VolumeRAM& volume) {
     auto minmax = util::volumeMinMax(&volume, IgnoreSpecialValues::No);
     // minmax always have four components, unused components are set to zero.
     // Hence, only consider components used by the data format
     dvec2 computedRange(minmax.first[0], minmax.second[0]);
-    for (size_t component = 1; component < state.format->getComponents(); ++component) {
+    for (size_t component = 1; component < volume.getDataFormat()->getComponents(); ++component) {
         computedRange = dvec2(glm::min(computedRange[0], minmax.first[component]),
                               glm::max(computedRange[1], minmax.second[component]));
     }
+    return computedRange;
+}
+
+void updateDataRange(Volume& volume, const State& state) {
+    const auto computedRange = computeDataRange(*volume.getRepresentation<VolumeRAM>());
     // Set value range
     volume.dataMap.dataRange = computedRange;
     // Also set value range if not specified
@@ -430,6 +444,270 @@ void perfWarning(Volume& volume, const std::filesystem::path& filePath) {
         computedRange[0], computedRange[1], computedRange[0], computedRange[1], filePath);
 }
 
+
+/**
+ * A volume of a sequence together with where its data is stored
+ */
+struct Step {
+    std::shared_ptr<Volume> volume;
+    std::filesystem::path rawFile;
+    size_t offset = 0;
+    bool computeDataRange = false;   ///< No DataRange was given
+    bool computeValueRange = false;  ///< No ValueRange was given
+    bool first = false;              ///< The first volume of its .dat file
+};
+
+void appendSteps(const std::filesystem::path& filePath, MemoryMapping memoryMapping,
+                 std::vector<Step>& steps) {
+    const auto file = DataReader::downloadAndCacheIfUrl(filePath);
+    auto f = DataReader::open(file);
+    auto state = parseDatFile(f, filePath);
+
+    // Check if other dat files where specified, and then only consider them as a sequence
+    if (!state.datFiles.empty()) {
+        const auto fileDirectory = filePath.parent_path();
+        for (const auto& datFile : state.datFiles) {
+            appendSteps(datFile.is_absolute() ? datFile : fileDirectory / datFile, memoryMapping,
+                        steps);
+        }
+        return;
+    }
+
+    validateDatFile(state, filePath);
+    resolve(state);
+    auto volume = createVolume(state);
+
+    const auto bytes = glm::compMul(state.dimensions) * (state.format->getSizeInBytes());
+    const auto rawFile = filePath.parent_path() / state.rawFile;
+    for (size_t t = 0; t < state.sequences; ++t) {
+        auto step = t + 1 == state.sequences ? std::move(volume)
+                                             : std::shared_ptr<Volume>(volume->clone());
+        step->addRepresentation(
+            createDiskRepWithLoader(state, filePath, rawFile, t * bytes, memoryMapping));
+        steps.push_back({.volume = std::move(step),
+                         .rawFile = rawFile,
+                         .offset = t * bytes + state.byteOffset,
+                         .computeDataRange = !state.dataRange,
+                         .computeValueRange = !state.valueRange,
+                         .first = t == 0});
+    }
+}
+
+struct StepStats {
+    dvec2 dataRange{0.0};
+    std::vector<Histogram1D> histograms;
+    bool valid = false;
+};
+
+/**
+ * Loads the data of the volume to calculate the data range and optionally the histograms. The
+ * loaded data is released afterwards to not keep the whole sequence in memory.
+ */
+StepStats computeStats(const Step& step, bool histograms) {
+    StepStats stats;
+    {
+        const auto ram = step.volume->getRepresentationShared<VolumeRAM>();
+        stats.dataRange = computeDataRange(*ram);
+        if (histograms) {
+            auto dataMap = step.volume->dataMap;
+            dataMap.dataRange = stats.dataRange;
+            if (step.computeValueRange) dataMap.valueRange = stats.dataRange;
+            stats.histograms = ram->dispatch<std::vector<Histogram1D>>(
+                [&]<typename T>(const VolumeRAMPrecision<T>* rp) {
+                    return util::calculateHistograms(rp->getView(), dataMap, 2048);
+                });
+        }
+    }
+    step.volume->releaseOtherRepresentations<VolumeDisk>();
+    stats.valid = true;
+    return stats;
+}
+
+void applyStats(const Step& step, const StepStats& stats) {
+    if (!stats.valid) return;
+    step.volume->dataMap.dataRange = stats.dataRange;
+    if (step.computeValueRange) {
+        step.volume->dataMap.valueRange = stats.dataRange;
+    }
+    if (!stats.histograms.empty()) {
+        step.volume->setHistograms(stats.histograms);
+    }
+}
+
+/**
+ * Calculates the stats of the given steps in parallel, one step per job.
+ */
+std::vector<StepStats> computeStats(const std::vector<Step>& steps,
+                                    const std::vector<size_t>& indices, bool histograms) {
+    std::vector<StepStats> stats(indices.size());
+    const auto compute = [&](size_t i) {
+        try {
+            stats[i] = computeStats(steps[indices[i]], histograms);
+        } catch (const Exception& e) {
+            log::exception(e);
+        }
+    };
+
+    if (util::getPoolSize() == 0 || indices.size() == 1) {
+        for (size_t i = 0; i < indices.size(); ++i) compute(i);
+        return stats;
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        futures.push_back(util::dispatchPool(compute, i));
+    }
+    auto& pool = util::getThreadPool();
+    for (const auto& future : futures) pool.wait(future);
+    return stats;
+}
+
+/**
+ * Identifies the data of the steps, changes if any of the raw files are modified.
+ */
+size_t statsKey(const std::vector<Step>& steps, const std::vector<size_t>& indices) {
+    size_t key = 0;
+    std::error_code ec;
+    for (const auto i : indices) {
+        const auto& step = steps[i];
+        util::hash_combine(key, step.rawFile.generic_string());
+        util::hash_combine(key, step.offset);
+        util::hash_combine(key, static_cast<int>(step.volume->getDataFormat()->getId()));
+        util::hash_combine(key, glm::compMul(step.volume->getDimensions()));
+        util::hash_combine(key, static_cast<size_t>(std::filesystem::file_size(step.rawFile, ec)));
+        util::hash_combine(
+            key, std::filesystem::last_write_time(step.rawFile, ec).time_since_epoch().count());
+    }
+    return key;
+}
+
+constexpr std::array<char, 8> statsMagic{'i', 'v', 'w', 's', 't', 'a', 't', 's'};
+constexpr std::uint32_t statsVersion = 1;
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+void write(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+template <typename T>
+void write(std::ostream& os, const std::vector<T>& values) {
+    write(os, static_cast<std::uint64_t>(values.size()));
+    os.write(reinterpret_cast<const char*>(values.data()),
+             static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+void write(std::ostream& os, const Statistics& stats) {
+    write(os, stats.min);
+    write(os, stats.max);
+    write(os, stats.mean);
+    write(os, stats.standardDeviation);
+    write(os, stats.percentiles);
+}
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+void read(std::istream& is, T& value) {
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+template <typename T>
+void read(std::istream& is, std::vector<T>& values) {
+    std::uint64_t size = 0;
+    read(is, size);
+    // Guard against allocating for corrupt files
+    if (!is || size > (std::uint64_t{1} << 32)) {
+        is.setstate(std::ios::failbit);
+        return;
+    }
+    values.resize(size);
+    is.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)));
+}
+void read(std::istream& is, Statistics& stats) {
+    read(is, stats.min);
+    read(is, stats.max);
+    read(is, stats.mean);
+    read(is, stats.standardDeviation);
+    read(is, stats.percentiles);
+}
+
+std::filesystem::path statsFile(const std::filesystem::path& datFile) {
+    return std::filesystem::path{datFile}.concat(".stats");
+}
+
+void writeStats(const std::filesystem::path& path, size_t key,
+                const std::vector<StepStats>& stats) {
+    std::ofstream os(path, std::ios::binary);
+    if (!os) return;
+
+    os.write(statsMagic.data(), statsMagic.size());
+    write(os, statsVersion);
+    write(os, static_cast<std::uint64_t>(key));
+    write(os, static_cast<std::uint64_t>(stats.size()));
+    for (const auto& step : stats) {
+        write(os, step.dataRange);
+        write(os, static_cast<std::uint64_t>(step.histograms.size()));
+        for (const auto& hist : step.histograms) {
+            write(os, hist.counts);
+            write(os, hist.totalCounts);
+            write(os, hist.maxCount);
+            write(os, hist.underflow);
+            write(os, hist.overflow);
+            write(os, hist.dataMap.dataRange);
+            write(os, hist.dataMap.valueRange);
+            write(os, hist.dataStats);
+            write(os, hist.histStats);
+        }
+    }
+    if (!os) {
+        log::warn("Unable to write data range cache file: {}", path);
+    }
+}
+
+std::optional<std::vector<StepStats>> readStats(const std::filesystem::path& path, size_t key,
+                                                const std::vector<Step>& steps,
+                                                const std::vector<size_t>& indices) {
+    std::ifstream is(path, std::ios::binary);
+    if (!is) return std::nullopt;
+
+    std::array<char, 8> magic{};
+    is.read(magic.data(), magic.size());
+    std::uint32_t version = 0;
+    read(is, version);
+    std::uint64_t fileKey = 0;
+    read(is, fileKey);
+    std::uint64_t size = 0;
+    read(is, size);
+    if (!is || magic != statsMagic || version != statsVersion || fileKey != key ||
+        size != indices.size()) {
+        return std::nullopt;
+    }
+
+    std::vector<StepStats> stats(indices.size());
+    for (auto&& [step, index] : util::zip(stats, indices)) {
+        step.valid = true;
+        read(is, step.dataRange);
+        std::uint64_t histograms = 0;
+        read(is, histograms);
+        if (!is || histograms > 4) return std::nullopt;
+        step.histograms.resize(histograms);
+        for (auto& hist : step.histograms) {
+            read(is, hist.counts);
+            read(is, hist.totalCounts);
+            read(is, hist.maxCount);
+            read(is, hist.underflow);
+            read(is, hist.overflow);
+            dvec2 dataRange{};
+            dvec2 valueRange{};
+            read(is, dataRange);
+            read(is, valueRange);
+            hist.dataMap =
+                DataMapper{dataRange, valueRange, steps[index].volume->dataMap.valueAxis};
+            read(is, hist.dataStats);
+            read(is, hist.histStats);
+        }
+    }
+    if (!is) return std::nullopt;
+    return stats;
+}
+
 }  // namespace
 
 DatVolumeSequenceReader::DatVolumeSequenceReader()
@@ -444,75 +722,160 @@ DatVolumeSequenceReader* DatVolumeSequenceReader::clone() const {
 std::shared_ptr<VolumeSequence> DatVolumeSequenceReader::readData(
     const std::filesystem::path& filePath) {
 
-    const auto fileDirectory = filePath.parent_path();
+    std::vector<Step> steps;
+    appendSteps(filePath, memoryMapping_, steps);
 
-    const auto file = downloadAndCacheIfUrl(filePath);
-    // Read the dat file content
-    auto f = open(file);
-
-    auto state = parseDatFile(f, filePath);
-
-    // Check if other dat files where specified, and then only consider them as a sequence
-    auto volumes = std::make_shared<VolumeSequence>();
-
-    if (!state.datFiles.empty()) {
-        for (size_t t = 0; t < state.datFiles.size(); ++t) {
-            auto datVolReader = std::make_unique<DatVolumeSequenceReader>();
-            datVolReader->enableLogOutput_ = false;
-            auto path = state.datFiles[t].is_absolute() ? state.datFiles[t]
-                                                        : fileDirectory / state.datFiles[t];
-            auto v = datVolReader->readData(path);
-
-            std::copy(v->begin(), v->end(), std::back_inserter(*volumes));
-        }
-        if (enableLogOutput_) {
-            log::info("Loaded multiple volumes: {} volumes: ", filePath, state.datFiles.size());
-        }
+    std::vector<size_t> missing;
+    for (auto&& [i, step] : util::enumerate(steps)) {
+        if (step.computeDataRange) missing.push_back(i);
+    }
 
-    } else {
-        validateDatFile(state, filePath);
-        resolve(state);
-        auto volume = createVolume(state);
+    if (!missing.empty() && dataRangeMode_ != DataRangeMode::Defer) {
+        const auto cacheFile = statsFile(downloadAndCacheIfUrl(filePath));
+        const auto key = statsKey(steps, missing);
 
-        const auto bytes = glm::compMul(state.dimensions) * (state.format->getSizeInBytes());
+        std::optional<std::vector<StepStats>> stats;
+        if (dataRangeCache_) stats = readStats(cacheFile, key, steps, missing);
+        const bool cached = stats.has_value();
 
-        for (size_t t = 0; t < state.sequences; ++t) {
-            if (t == 0) {
-                volumes->push_back(std::move(volume));
-            } else {
-                volumes->push_back(std::shared_ptr<Volume>(volumes->front()->clone()));
+        if (cached) {
+            for (auto&& [index, step] : util::zip(missing, *stats)) {
+                applyStats(steps[index], step);
             }
-            auto diskRepr =
-                createDiskRepWithLoader(state, filePath, fileDirectory / state.rawFile, t * bytes);
-            volumes->back()->addRepresentation(diskRepr);
-
-            if (t == 0 && !state.dataRange) {
-                // Use min/max value in data as data range if none is given
-                // Only consider first time step since it can be time consuming
-                // to compute for all time steps
-                updateDataRange(*volumes->front(), state);
-                if (bytes > 128 * 128 * 128 || state.sequences > 1) {
-                    // Performance warning for larger volumes (roughly > 2MB)
-                    perfWarning(*volumes->front(), filePath);
+        } else if (dataRangeMode_ == DataRangeMode::First) {
+            // Use the range of the first volume of each .dat file for all volumes of that file
+            std::vector<size_t> firsts;
+            std::ranges::copy_if(missing, std::back_inserter(firsts),
+                                 [&](size_t index) { return steps[index].first; });
+            const auto firstStats = computeStats(steps, firsts, false);
+            for (auto&& [index, step] : util::zip(firsts, firstStats)) {
+                for (auto i = index; i < steps.size() && (i == index || !steps[i].first); ++i) {
+                    applyStats(steps[i], step);
                 }
-                if (state.sequences > 1) {
-                    log::warn(
-                        "Multiple volumes in file but we only computed DataRange of the first "
-                        "volume sequence due to performance consideration. \nWe strongly recommend "
-                        "setting the DataRange, for example to min(Volume sequence), max(Volume "
-                        "sequence).");
+            }
+            if (enableLogOutput_ && firsts.size() < missing.size()) {
+                log::warn(
+                    "Multiple volumes in file but we only computed DataRange of the first "
+                    "volume sequence due to performance consideration. \nWe strongly recommend "
+                    "setting the DataRange, for example to min(Volume sequence), max(Volume "
+                    "sequence).");
+            }
+        } else if (dataRangeMode_ == DataRangeMode::Compute) {
+            stats = computeStats(steps, missing, true);
+            for (auto&& [index, step] : util::zip(missing, *stats)) {
+                applyStats(steps[index], step);
+            }
+            if (dataRangeCache_ && std::ranges::all_of(*stats, &StepStats::valid)) {
+                writeStats(cacheFile, key, *stats);
+            }
+        } else {
+            // Use the union of the ranges of a few evenly spaced volumes for all of them
+            const auto samples = std::clamp(dataRangeSamples_, size_t{1}, missing.size());
+            std::vector<size_t> sampled;
+            for (size_t i = 0; i < samples; ++i) {
+                const auto pos = samples == 1 ? 0 : i * (missing.size() - 1) / (samples - 1);
+                if (sampled.empty() || sampled.back() != missing[pos]) {
+                    sampled.push_back(missing[pos]);
                 }
             }
+            StepStats estimate{.dataRange = dvec2{std::numeric_limits<double>::max(),
+                                                  std::numeric_limits<double>::lowest()}};
+            for (const auto& step : computeStats(steps, sampled, false)) {
+                if (!step.valid) continue;
+                estimate.valid = true;
+                estimate.dataRange = dvec2{glm::min(estimate.dataRange.x, step.dataRange.x),
+                                           glm::max(estimate.dataRange.y, step.dataRange.y)};
+            }
+            for (const auto index : missing) {
+                applyStats(steps[index], estimate);
+            }
+            if (enableLogOutput_ && estimate.valid) {
+                log::info("Estimated DataRange of {} volumes from {} volumes: [{}, {}]",
+                          missing.size(), sampled.size(), estimate.dataRange.x,
+                          estimate.dataRange.y);
+            }
         }
 
-        if (enableLogOutput_) {
-            log::info("Loaded volume sequence: {} size: {}", filePath,
-                      ByteSize{bytes * state.sequences});
+        auto& front = *steps[missing.front()].volume;
+        const auto frontBytes =
+            glm::compMul(front.getDimensions()) * front.getDataFormat()->getSizeInBytes();
+        if (!cached && enableLogOutput_ && (frontBytes > 128 * 128 * 128 || missing.size() > 1)) {
+            // Performance warning for larger volumes (roughly > 2MB) or sequences
+            perfWarning(front, filePath);
         }
     }
+
+    auto volumes = std::make_shared<VolumeSequence>();
+    size_t bytes = 0;
+    for (auto& step : steps) {
+        bytes += glm::compMul(step.volume->getDimensions()) *
+                 step.volume->getDataFormat()->getSizeInBytes();
+        volumes->push_back(std::move(step.volume));
+    }
+
+    if (enableLogOutput_) {
+        log::info("Loaded volume sequence: {} volumes: {} size: {}", filePath, volumes->size(),
+                  ByteSize{bytes});
+    }
     return volumes;
 }
 
+bool DatVolumeSequenceReader::setOption(std::string_view key, std::any value) {
+    if (auto* mode = std::any_cast<DataRangeMode>(&value); mode && key == "DataRangeMode") {
+        setDataRangeMode(*mode);
+        return true;
+    } else if (auto* samples = std::any_cast<size_t>(&value);
+               samples && key == "DataRangeSamples") {
+        setDataRangeSamples(*samples);
+        return true;
+    } else if (auto* cache = std::any_cast<bool>(&value); cache && key == "DataRangeCache") {
+        setDataRangeCache(*cache);
+        return true;
+    } else if (auto* mapping = std::any_cast<MemoryMapping>(&value);
+               mapping && key == "MemoryMapping") {
+        setMemoryMapping(*mapping);
+        return true;
+    }
+    return false;
+}
+
+std::any DatVolumeSequenceReader::getOption(std::string_view key) {
+    if (key == "DataRangeMode") {
+        return dataRangeMode_;
+    } else if (key == "DataRangeSamples") {
+        return dataRangeSamples_;
+    } else if (key == "DataRangeCache") {
+        return dataRangeCache_;
+    } else if (key == "MemoryMapping") {
+        return memoryMapping_;
+    }
+    return {};
+}
+
+DatVolumeSequenceReader& DatVolumeSequenceReader::setDataRangeMode(DataRangeMode mode) {
+    dataRangeMode_ = mode;
+    return *this;
+}
+auto DatVolumeSequenceReader::getDataRangeMode() const -> DataRangeMode { return dataRangeMode_; }
+
+DatVolumeSequenceReader& DatVolumeSequenceReader::setDataRangeSamples(size_t samples) {
+    dataRangeSamples_ = samples;
+    return *this;
+}
+size_t DatVolumeSequenceReader::getDataRangeSamples() const { return dataRangeSamples_; }
+
+DatVolumeSequenceReader& DatVolumeSequenceReader::setDataRangeCache(bool enable) {
+    dataRangeCache_ = enable;
+    return *this;
+}
+bool DatVolumeSequenceReader::getDataRangeCache() const { return dataRangeCache_; }
+
+DatVolumeSequenceReader& DatVolumeSequenceReader::setMemoryMapping(MemoryMapping memoryMapping) {
+    memoryMapping_ = memoryMapping;
+    return *this;
+}
+MemoryMapping DatVolumeSequenceReader::getMemoryMapping() const { return memoryMapping_; }
+
 DatVolumeReader::DatVolumeReader() : DataReaderType<Volume>() {
     addExtension(FileExtension("dat", "Inviwo dat Volume file format"));
 }
@@ -541,8 +904,8 @@ std::shared_ptr<Volume> DatVolumeReader::readData(const std::filesystem::path& f
     validateDatFile(state, filePath);
     resolve(state);
     auto volume = createVolume(state);
-    auto diskRepr =
-        createDiskRepWithLoader(state, filePath, filePath.parent_path() / state.rawFile, 0);
+    auto diskRepr = createDiskRepWithLoader(state, filePath, filePath.parent_path() / state.rawFile,
+                                            0, memoryMapping_);
     volume->addRepresentation(diskRepr);
 
     const auto bytes = glm::compMul(state.dimensions) * (state.format->getSizeInBytes());
@@ -558,4 +921,25 @@ std::shared_ptr<Volume> DatVolumeReader::readData(const std::filesystem::path& f
     return volume;
 }
 
+bool DatVolumeReader::setOption(std::string_view key, std::any value) {
+    if (auto* mapping = std::any_cast<MemoryMapping>(&value); mapping && key == "MemoryMapping") {
+        setMemoryMapping(*mapping);
+        return true;
+    }
+    return false;
+}
+
+std::any DatVolumeReader::getOption(std::string_view key) {
+    if (key == "MemoryMapping") {
+        return memoryMapping_;
+    }
+    return {};
+}
+
+DatVolumeReader& DatVolumeReader::setMemoryMapping(MemoryMapping memoryMapping) {
+    memoryMapping_ = memoryMapping;
+    return *this;
+}
+MemoryMapping DatVolumeReader::getMemoryMapping() const { return memoryMapping_; }
+
 }  // namespace inviwo
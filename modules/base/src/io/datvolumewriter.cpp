@@ -36,6 +36,7 @@
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/bytewriterutil.h>
 #include <inviwo/core/io/datawriter.h>
 #include <inviwo/core/io/datawriterexception.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
@@ -73,15 +74,47 @@ DatVolumeWriter::DatVolumeWriter() : DataWriterType<Volume>() {
 DatVolumeWriter* DatVolumeWriter::clone() const { return new DatVolumeWriter(*this); }
 
 void DatVolumeWriter::writeData(const Volume* data, const std::filesystem::path& filePath) const {
-    util::writeDatVolume(*data, filePath, getOverwrite());
+    util::writeDatVolume(*data, filePath, getOverwrite(), compression_);
 }
 
+bool DatVolumeWriter::setOption(std::string_view key, std::any value) {
+    if (auto* compression = std::any_cast<Compression>(&value);
+        compression && key == "Compression") {
+        setCompression(*compression);
+        return true;
+    }
+    return false;
+}
+
+std::any DatVolumeWriter::getOption(std::string_view key) const {
+    if (key == "Compression") {
+        return compression_;
+    }
+    return {};
+}
+
+DatVolumeWriter& DatVolumeWriter::setCompression(Compression compression) {
+    compression_ = compression;
+    return *this;
+}
+Compression DatVolumeWriter::getCompression() const { return compression_; }
+
 namespace util {
 
-void writeDatVolume(const Volume& data, const std::filesystem::path& filePath,
-                    Overwrite overwrite) {
-    auto rawPath = filePath;
-    rawPath.replace_extension("raw");
+void writeDatVolume(const Volume& data, const std::filesystem::path& filePath, Overwrite overwrite,
+                    Compression compression) {
+    const std::string_view extension = [&]() {
+        switch (compression) {
+            case Compression::Enabled:
+                return "raw.gz";
+            case Compression::Chunked:
+                return "raw.zc";
+            case Compression::Disabled:
+            default:
+                return "raw";
+        }
+    }();
+    const auto rawPath = filesystem::replaceFileExtension(filePath, extension);
 
     DataWriter::checkOverwrite(filePath, overwrite);
     DataWriter::checkOverwrite(rawPath, overwrite);
@@ -119,12 +152,12 @@ void writeDatVolume(const Volume& data, const std::filesystem::path& filePath,
             fmt::print(ss, "{}: {}\n", key, fmt::join(begin(vec), end(vec), " "));
         }};
 
-    print("RawFile", fmt::format("{}.raw", fileName));
+    print("RawFile", fmt::format("{}.{}", fileName, extension));
     print("Resolution", vr->getDimensions());
     print("Format", vr->getDataFormatString());
     print("ByteOrder", ByteOrder::LittleEndian);
     print("ByteOffset", std::string("0"));
-    print("Compression", Compression::Disabled);
+    print("Compression", compression);
     print("BasisVector1", basis[0]);
     print("BasisVector2", basis[1]);
     print("BasisVector3", basis[2]);
@@ -161,11 +194,7 @@ void writeDatVolume(const Volume& data, const std::filesystem::path& filePath,
         throw DataWriterException(SourceContext{}, "Could not write to dat file: {}", filePath);
     }
 
-    if (auto f = std::ofstream(rawPath, std::ios::out | std::ios::binary)) {
-        f.write(static_cast<const char*>(vr->getData()), vr->getNumberOfBytes());
-    } else {
-        throw DataWriterException(SourceContext{}, "Could not write to raw file: {}", rawPath);
-    }
+    util::writeBytes(rawPath, vr->getData(), vr->getNumberOfBytes(), compression);
 }
 
 }  // namespace util
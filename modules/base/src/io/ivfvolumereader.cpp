@@ -178,7 +178,8 @@ struct VolumeMetaData {
     MetaDataMap metaData;
 };
 
-std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePath) {
+std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePath,
+                                            MemoryMapping memoryMapping) {
     const auto fileDirectory = filePath.parent_path();
 
     std::pmr::monotonic_buffer_resource mbr{1024 * 4};
@@ -243,7 +244,7 @@ std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePat
         auto volumeDisk = std::make_shared<VolumeDisk>(fileDirectory / path, dimensions, format,
                                                        swizzleMask, interpolation, wrapping);
         auto loader = std::make_unique<RawVolumeRAMLoader>(fileDirectory / path, byteOffset,
-                                                           byteOrder, compression);
+                                                           byteOrder, compression, memoryMapping);
         volumeDisk->setLoader(loader.release());
         volume->addRepresentation(volumeDisk);
     }
@@ -264,7 +265,7 @@ std::shared_ptr<Volume> IvfVolumeReader::readData(const std::filesystem::path& f
     const auto localPath = downloadAndCacheIfUrl(filePath);
     checkExists(localPath);
 
-    auto sequence = readIvfFile(localPath);
+    auto sequence = readIvfFile(localPath, memoryMapping_);
     if (sequence->size() != 1) {
         throw DataReaderException{
             SourceContext{},
@@ -275,6 +276,27 @@ std::shared_ptr<Volume> IvfVolumeReader::readData(const std::filesystem::path& f
     return sequence->front();
 }
 
+bool IvfVolumeReader::setOption(std::string_view key, std::any value) {
+    if (auto* mapping = std::any_cast<MemoryMapping>(&value); mapping && key == "MemoryMapping") {
+        setMemoryMapping(*mapping);
+        return true;
+    }
+    return false;
+}
+
+std::any IvfVolumeReader::getOption(std::string_view key) {
+    if (key == "MemoryMapping") {
+        return memoryMapping_;
+    }
+    return {};
+}
+
+IvfVolumeReader& IvfVolumeReader::setMemoryMapping(MemoryMapping memoryMapping) {
+    memoryMapping_ = memoryMapping;
+    return *this;
+}
+MemoryMapping IvfVolumeReader::getMemoryMapping() const { return memoryMapping_; }
+
 IvfVolumeSequenceReader::IvfVolumeSequenceReader() : DataReaderType<VolumeSequence>{} {
     addExtension(FileExtension("ivfs", "Inviwo Volume Sequence"));
 }
@@ -289,7 +311,28 @@ std::shared_ptr<VolumeSequence> IvfVolumeSequenceReader::readData(
     const auto localPath = downloadAndCacheIfUrl(filePath);
     checkExists(localPath);
 
-    return readIvfFile(localPath);
+    return readIvfFile(localPath, memoryMapping_);
+}
+
+bool IvfVolumeSequenceReader::setOption(std::string_view key, std::any value) {
+    if (auto* mapping = std::any_cast<MemoryMapping>(&value); mapping && key == "MemoryMapping") {
+        setMemoryMapping(*mapping);
+        return true;
+    }
+    return false;
+}
+
+std::any IvfVolumeSequenceReader::getOption(std::string_view key) {
+    if (key == "MemoryMapping") {
+        return memoryMapping_;
+    }
+    return {};
+}
+
+IvfVolumeSequenceReader& IvfVolumeSequenceReader::setMemoryMapping(MemoryMapping memoryMapping) {
+    memoryMapping_ = memoryMapping;
+    return *this;
 }
+MemoryMapping IvfVolumeSequenceReader::getMemoryMapping() const { return memoryMapping_; }
 
 }  // namespace inviwo
@@ -80,9 +80,31 @@ IvfVolumeWriter& IvfVolumeWriter::operator=(IvfVolumeWriter&& that) noexcept = d
 IvfVolumeWriter* IvfVolumeWriter::clone() const { return new IvfVolumeWriter(*this); }
 
 void IvfVolumeWriter::writeData(const Volume* volume, const std::filesystem::path& filePath) const {
-    util::writeIvfVolume(*volume, filePath, getOverwrite());
+    util::writeIvfVolume(*volume, filePath, getOverwrite(), compression_);
 }
 
+bool IvfVolumeWriter::setOption(std::string_view key, std::any value) {
+    if (auto* compression = std::any_cast<Compression>(&value);
+        compression && key == "Compression") {
+        setCompression(*compression);
+        return true;
+    }
+    return false;
+}
+
+std::any IvfVolumeWriter::getOption(std::string_view key) const {
+    if (key == "Compression") {
+        return compression_;
+    }
+    return {};
+}
+
+IvfVolumeWriter& IvfVolumeWriter::setCompression(Compression compression) {
+    compression_ = compression;
+    return *this;
+}
+Compression IvfVolumeWriter::getCompression() const { return compression_; }
+
 IvfVolumeSequenceWriter::IvfVolumeSequenceWriter() : DataWriterType<VolumeSequence>() {
     addExtension(FileExtension("ivfs", "Inviwo Volume Sequence"));
 }
@@ -104,15 +126,52 @@ IvfVolumeSequenceWriter* IvfVolumeSequenceWriter::clone() const {
 void IvfVolumeSequenceWriter::writeData(const VolumeSequence* volumes,
                                         const std::filesystem::path& filePath) const {
     util::writeIvfVolumeSequence(*volumes, filePath.stem().generic_string(), filePath.parent_path(),
-                                 {}, getOverwrite());
+                                 {}, getOverwrite(), compression_);
+}
+
+bool IvfVolumeSequenceWriter::setOption(std::string_view key, std::any value) {
+    if (auto* compression = std::any_cast<Compression>(&value);
+        compression && key == "Compression") {
+        setCompression(*compression);
+        return true;
+    }
+    return false;
 }
 
+std::any IvfVolumeSequenceWriter::getOption(std::string_view key) const {
+    if (key == "Compression") {
+        return compression_;
+    }
+    return {};
+}
+
+IvfVolumeSequenceWriter& IvfVolumeSequenceWriter::setCompression(Compression compression) {
+    compression_ = compression;
+    return *this;
+}
+Compression IvfVolumeSequenceWriter::getCompression() const { return compression_; }
+
 namespace util {
 
-void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
-                    Overwrite overwrite) {
-    const Compression compression = Compression::Enabled;
-    const std::string_view extension = compression == Compression::Enabled ? "raw.gz" : "raw";
+namespace {
+
+std::string_view rawExtension(Compression compression) {
+    switch (compression) {
+        case Compression::Enabled:
+            return "raw.gz";
+        case Compression::Chunked:
+            return "raw.zc";
+        case Compression::Disabled:
+        default:
+            return "raw";
+    }
+}
+
+}  // namespace
+
+void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath, Overwrite overwrite,
+                    Compression compression) {
+    const std::string_view extension = rawExtension(compression);
     const auto rawPath = filesystem::replaceFileExtension(filePath, extension);
 
     DataWriter::checkOverwrite(filePath, overwrite);
@@ -235,7 +294,7 @@ struct VolumeMetaData {
 std::filesystem::path writeIvfVolumeSequence(const VolumeSequence& data, std::string_view name,
                                              const std::filesystem::path& parentFolder,
                                              const std::filesystem::path& relativePathToElements,
-                                             Overwrite overwrite) {
+                                             Overwrite overwrite, Compression compression) {
     if (data.empty()) {
         throw DataWriterException(SourceContext{}, "Expected non-empty volume sequence");
     }
@@ -247,8 +306,7 @@ std::filesystem::path writeIvfVolumeSequence(const VolumeSequence& data, std::st
     DataWriter::checkOverwrite(filePath, overwrite);
 
     const auto rawBaseName = name.ends_with(".ivfs") ? name.substr(0, name.size() - 5) : name;
-    const Compression compression = Compression::Enabled;
-    const std::string_view extension = compression == Compression::Enabled ? "raw.gz" : "raw";
+    const std::string_view extension = rawExtension(compression);
 
     const util::SharedSequenceData sharedData{data};
 
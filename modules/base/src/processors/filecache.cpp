@@ -34,7 +34,9 @@
 #include <inviwo/core/links/propertylink.h>
 
 #include <inviwo/core/io/serialization/ticpp.h>
+#include <inviwo/core/util/hashcombine.h>
 
+#include <span>
 #include <unordered_set>
 #include <memory_resource>
 
@@ -42,18 +44,103 @@ namespace inviwo {
 
 namespace detail {
 
-std::string cacheState(Processor* processor, ProcessorNetwork& net,
-                       const std::filesystem::path& refPath, std::pmr::string& xml) {
-    std::pmr::monotonic_buffer_resource mbr{1024 * 32};
+namespace {
 
-    std::pmr::vector<Processor*> processors(&mbr);
-    std::pmr::unordered_set<Processor*> state(&mbr);
+template <typename Check>
+void removeElements(TiXmlElement* elem, const Check& check) {
+    TiXmlElement* child = elem->FirstChildElement();
+    while (child) {
+        auto* curr = child;
+        child = child->NextSiblingElement();
+
+        if (check(curr, elem)) {
+            elem->RemoveChild(curr);
+        } else {
+            removeElements(curr, check);
+        }
+    }
+}
+
+/**
+ * Remove all parts of the serialized state that do not affect the cached data, i.e. processor
+ * meta data and paths that are not relative to the reference path.
+ */
+void removeNonStateElements(TiXmlElement* root, bool hasRefPath) {
+    removeElements(root, [](TiXmlElement* current, TiXmlElement*) -> bool {
+        return current->Value() == "MetaDataItem" &&
+               current->Attribute("type")
+                   .transform([](std::string_view value) {
+                       return value == "org.inviwo.ProcessorMetaData";
+                   })
+                   .value_or(false);
+    });
+
+    // remove all ivwdataRelativePath paths
+    removeElements(root, [](TiXmlElement* current, TiXmlElement*) -> bool {
+        return current->Value() == "ivwdataRelativePath";
+    });
+
+    if (hasRefPath) {
+        // remove absolutePath if we have workspaceRelativePaths
+        removeElements(root, [](TiXmlElement* current, TiXmlElement* parent) -> bool {
+            if (current->Value() == "absolutePath") {
+                if (auto* rp = parent->FirstChildElement("workspaceRelativePath")) {
+                    return rp->Attribute("content")
+                        .transform([](std::string_view value) { return !value.empty(); })
+                        .value_or(false);
+                }
+            }
+            return false;
+        });
+    }
+}
+
+void serializeProcessors(Serializer& s, std::span<Processor* const> processors) {
+    s.serializeRange("Processors", "Processor", processors,
+                     [](Serializer& nested, const Processor* item) { item->serialize(nested); });
+}
+
+/**
+ * The processors upstream of \p processor, including \p processor itself.
+ */
+template <typename Alloc>
+void upstreamProcessors(
+    Processor* processor,
+    std::unordered_set<Processor*, std::hash<Processor*>, std::equal_to<Processor*>, Alloc>& state,
+    auto& processors) {
     util::traverseNetwork<util::TraversalDirection::Up, util::VisitPattern::Post>(
         state, processor, [&processors](Processor* p) { processors.push_back(p); });
 
     // ensure a consistent order
     std::ranges::sort(processors, std::less<>{},
                       [](const Processor* p) { return p->getIdentifier(); });
+}
+
+auto connectionsWithin(ProcessorNetwork& net, const auto& processors) {
+    return net.connectionVecRange() |
+           std::views::filter([ps = &processors](const PortConnection& connection) {
+               auto* in = connection.getInport()->getProcessor();
+               auto* out = connection.getOutport()->getProcessor();
+               return ps->contains(in) && ps->contains(out);
+           });
+}
+
+auto linksWithin(ProcessorNetwork& net, const auto& processors) {
+    return net.linkRange() | std::views::filter([ps = &processors](const PropertyLink& link) {
+               return ps->contains(link.getDestination()->getOwner()->getProcessor()) &&
+                      ps->contains(link.getSource()->getOwner()->getProcessor());
+           });
+}
+
+}  // namespace
+
+void cacheStateXML(Processor* processor, ProcessorNetwork& net,
+                   const std::filesystem::path& refPath, std::pmr::string& xml) {
+    std::pmr::monotonic_buffer_resource mbr{1024 * 32};
+
+    std::pmr::vector<Processor*> processors(&mbr);
+    std::pmr::unordered_set<Processor*> state(&mbr);
+    upstreamProcessors(processor, state, processors);
 
     // Skip the caching processor it self.
     std::erase(processors, processor);
@@ -63,91 +150,187 @@ std::string cacheState(Processor* processor, ProcessorNetwork& net,
     const auto ns = s.switchToNewNode("ProcessorNetwork");
     s.serialize("ProcessorNetworkVersion", ProcessorNetwork::processorNetworkVersion());
 
-    s.serializeRange("Processors", "Processor", processors,
-                     [](Serializer& nested, const Processor* item) { item->serialize(nested); });
+    serializeProcessors(s, processors);
 
-    // We want to serialize the connection to the cacheProcessor;
-    processors.push_back(processor);
-
-    s.serializeRange(
-        "Connections", "Connection",
-        net.connectionVecRange() | std::views::filter([&](const PortConnection& connection) {
-            auto* in = connection.getInport()->getProcessor();
-            auto* out = connection.getOutport()->getProcessor();
-            return util::contains(processors, in) && util::contains(processors, out);
-        }),
-        [](Serializer& nested, const PortConnection& connection) {
-            connection.getOutport()->getPath(nested.addAttribute("src"));
-            connection.getInport()->getPath(nested.addAttribute("dst"));
-        });
+    // We want to serialize the connection to the cacheProcessor, it is still in state;
+    s.serializeRange("Connections", "Connection", connectionsWithin(net, state),
+                     [](Serializer& nested, const PortConnection& connection) {
+                         connection.getOutport()->getPath(nested.addAttribute("src"));
+                         connection.getInport()->getPath(nested.addAttribute("dst"));
+                     });
 
-    s.serializeRange(
-        "PropertyLinks", "PropertyLink",
-        net.linkRange() | std::views::filter([&](const PropertyLink& link) {
-            return util::contains(
-                       processors,
-                       link.getDestination()->getOwner()->getProcessor()->getProcessor()) &&
-                   util::contains(processors, link.getSource()->getOwner()->getProcessor());
-        }),
-        [](Serializer& nested, const PropertyLink& link) {
-            link.getSource()->getPath(nested.addAttribute("src"));
-            link.getDestination()->getPath(nested.addAttribute("dst"));
-        });
+    s.serializeRange("PropertyLinks", "PropertyLink", linksWithin(net, state),
+                     [](Serializer& nested, const PropertyLink& link) {
+                         link.getSource()->getPath(nested.addAttribute("src"));
+                         link.getDestination()->getPath(nested.addAttribute("dst"));
+                     });
 
-    const auto remove = [](TiXmlElement* elem, const auto& check, const auto& self) -> void {
-        TiXmlElement* child = elem->FirstChildElement();
-        while (child) {
-            auto* curr = child;
-            child = child->NextSiblingElement();
+    removeNonStateElements(s.doc().RootElement(), !refPath.empty());
 
-            if (check(curr, elem)) {
-                elem->RemoveChild(curr);
-            } else {
-                self(curr, check, self);
-            }
+    xml.clear();
+    s.write(xml);
+}
+
+CacheState::CacheState(Processor* cache) : cache_{cache} {}
+
+void CacheState::setNetwork(ProcessorNetwork* network) {
+    if (network_ == network) return;
+
+    while (!fingerprints_.empty()) {
+        untrack(fingerprints_.begin()->first);
+    }
+    processors_.clear();
+    ProcessorNetworkObserver::removeObservations();
+
+    network_ = network;
+    if (network_) {
+        network_->addObserver(this);
+    }
+    networkChanged();
+}
+
+const std::string& CacheState::key(const std::filesystem::path& refPath) {
+    if (refPath != refPath_) {
+        refPath_ = refPath;
+        for (auto& item : fingerprints_) {
+            item.second.hash.reset();
         }
-    };
-    remove(
-        s.doc().RootElement(),
-        [](TiXmlElement* current, TiXmlElement*) -> bool {
-            return current->Value() == "MetaDataItem" &&
-                   current->Attribute("type")
-                       .transform([](std::string_view value) {
-                           return value == "org.inviwo.ProcessorMetaData";
-                       })
-                       .value_or(false);
-        },
-        remove);
+        changed_ = true;
+    }
+    if (!changed_) return key_;
 
-    // remove all ivwdataRelativePath paths
-    remove(
-        s.doc().RootElement(),
-        [](TiXmlElement* current, TiXmlElement*) -> bool {
-            return current->Value() == "ivwdataRelativePath";
-        },
-        remove);
-
-    if (!refPath.empty()) {
-        // remove absolutePath if we have workspaceRelativePaths
-        remove(
-            s.doc().RootElement(),
-            [](TiXmlElement* current, TiXmlElement* parent) -> bool {
-                if (current->Value() == "absolutePath") {
-                    if (auto* rp = parent->FirstChildElement("workspaceRelativePath")) {
-                        return rp->Attribute("content")
-                            .transform([](std::string_view value) { return !value.empty(); })
-                            .value_or(false);
-                    }
-                }
-                return false;
-            },
-            remove);
+    if (upstreamChanged_) {
+        updateUpstream();
     }
 
-    xml.clear();
-    s.write(xml);
+    size_t seed = 0;
+    util::hash_combine(seed, ProcessorNetwork::processorNetworkVersion());
+    for (auto* processor : processors_) {
+        auto& fingerprint = fingerprints_[processor];
+        if (!fingerprint.hash) {
+            std::pmr::monotonic_buffer_resource mbr{1024 * 4};
+            Serializer s{refPath_, SerializeConstants::InviwoWorkspace, &mbr};
+            s.setWorkspaceSaveMode(WorkspaceSaveMode::Undo);
+            serializeProcessors(s, std::span{&processor, 1});
+            removeNonStateElements(s.doc().RootElement(), !refPath_.empty());
+
+            std::pmr::string xml{&mbr};
+            s.write(xml);
+            fingerprint.hash = std::hash<std::string_view>{}(xml);
+        }
+        util::hash_combine(seed, *fingerprint.hash);
+    }
+    util::hash_combine(seed, connectionsHash_);
+
+    key_ = fmt::format("{:016X}", seed);
+    changed_ = false;
+    return key_;
+}
+
+void CacheState::updateUpstream() {
+    std::vector<Processor*> processors;
+    std::unordered_set<Processor*> state;
+    if (network_) {
+        upstreamProcessors(cache_, state, processors);
+        std::erase(processors, cache_);
+    }
+
+    for (auto it = fingerprints_.begin(); it != fingerprints_.end();) {
+        auto* processor = (it++)->first;
+        if (!state.contains(processor)) untrack(processor);
+    }
+    for (auto* processor : processors) {
+        if (!fingerprints_.contains(processor)) track(processor);
+    }
+    processors_ = std::move(processors);
+
+    connectionsHash_ = 0;
+    if (network_) {
+        // The connection to the cache processor is included, it is still in state
+        for (const auto& connection : connectionsWithin(*network_, state)) {
+            util::hash_combine(connectionsHash_, connection.getOutport()->getPath());
+            util::hash_combine(connectionsHash_, connection.getInport()->getPath());
+        }
+        for (const auto& link : linksWithin(*network_, state)) {
+            util::hash_combine(connectionsHash_, link.getSource()->getPath());
+            util::hash_combine(connectionsHash_, link.getDestination()->getPath());
+        }
+    }
+    upstreamChanged_ = false;
+}
+
+void CacheState::track(Processor* p) {
+    p->ProcessorObservable::addObserver(this);
+    p->PropertyOwnerObservable::addObserver(this);
+    fingerprints_[p].identifierChange =
+        p->onIdentifierChange([this, p](std::string_view, std::string_view) {
+            processorChanged(p);
+            networkChanged();  // identifiers are part of the paths and the order
+        });
+}
+
+void CacheState::untrack(Processor* p) {
+    p->ProcessorObservable::removeObserver(this);
+    p->PropertyOwnerObservable::removeObserver(this);
+    fingerprints_.erase(p);
+}
+
+void CacheState::processorChanged(Processor* p) {
+    if (auto it = fingerprints_.find(p); it != fingerprints_.end()) {
+        it->second.hash.reset();
+        changed_ = true;
+    }
+}
+
+void CacheState::networkChanged() {
+    upstreamChanged_ = true;
+    changed_ = true;
+}
+
+void CacheState::onProcessorNetworkDidAddConnection(const PortConnection&) { networkChanged(); }
+void CacheState::onProcessorNetworkDidRemoveConnection(const PortConnection&) {
+    networkChanged();
+}
+void CacheState::onProcessorNetworkDidAddLink(const PropertyLink&) { networkChanged(); }
+void CacheState::onProcessorNetworkDidRemoveLink(const PropertyLink&) { networkChanged(); }
+void CacheState::onProcessorNetworkWillRemoveProcessor(Processor* p) {
+    if (fingerprints_.contains(p)) {
+        untrack(p);
+        networkChanged();
+    }
+}
+
+void CacheState::onAboutPropertyChange(Property* property) {
+    // Semantic, visibility, read only, and display name changes are notified without a property.
+    // They are still part of the serialized state, and we do not know which processor changed,
+    // rehash all of them. Hashing is lazy so a burst of such changes only rehashes once.
+    if (!property) {
+        for (auto& item : fingerprints_) {
+            item.second.hash.reset();
+        }
+        changed_ = true;
+        return;
+    }
+    if (auto* owner = property->getOwner()) {
+        processorChanged(owner->getProcessor());
+    }
+}
+void CacheState::onProcessorPortAdded(Processor* p, Port*) {
+    processorChanged(p);
+    networkChanged();
+}
+void CacheState::onProcessorPortRemoved(Processor* p, Port*) {
+    processorChanged(p);
+    networkChanged();
+}
 
-    return {fmt::format("{:016X}", std::hash<std::string_view>{}(xml))};
+void CacheState::onDidAddProperty(Property* property, size_t) {
+    if (auto* owner = property->getOwner()) {
+        processorChanged(owner->getProcessor());
+    }
+}
+void CacheState::onDidRemoveProperty(PropertyOwner* owner, Property*, size_t) {
+    processorChanged(owner->getProcessor());
 }
 
 }  // namespace detail
@@ -162,7 +345,8 @@ CacheBase::CacheBase()
     , refDir_{"refDir", "Reference Dir",
               "Any paths are hashed relative to this path, "
               "instead of the absolute path, if set"_help}
-    , currentKey_{"key", "Hashed State", "", InvalidationLevel::Valid} {
+    , currentKey_{"key", "Hashed State", "", InvalidationLevel::Valid}
+    , state_{this} {
 
     isReady_.setUpdate([this]() {
         if (getInports().empty()) return true;
@@ -179,6 +363,7 @@ CacheBase::CacheBase()
 
 void CacheBase::setNetwork(ProcessorNetwork* network) {
     Processor::setNetwork(network);
+    state_.setNetwork(network);
     ProcessorNetworkEvaluationObserver::removeObservations();
     if (network) {
         network->getEvaluator()->addObserver(this);
@@ -191,7 +376,7 @@ void CacheBase::onProcessorNetworkEvaluationBegin() {
     auto* net = getNetwork();
     if (!net) return;
 
-    key_ = detail::cacheState(this, *net, refDir_.get(), xml_);
+    key_ = state_.key(refDir_.get());
     currentKey_.set(key_);
 
     const auto isCached = hasCache(key_) && enabled_;
@@ -212,20 +397,20 @@ bool CacheBase::isConnectionActive(Inport* inport, Outport*) const {
 }
 
 void CacheBase::invalidate(InvalidationLevel invalidationLevel, Property* modifiedProperty) {
-    if (auto* net = getNetwork()) {
-        auto key = detail::cacheState(this, *net, refDir_.get(), xml_);
-        if (modifiedProperty == nullptr && key == loadedKey()) {
-            return;
-        }
+    if (modifiedProperty == nullptr && getNetwork() && state_.key(refDir_.get()) == loadedKey()) {
+        return;
     }
 
     Processor::invalidate(invalidationLevel, modifiedProperty);
 }
 
 void CacheBase::writeXML() const {
-    if (!cacheDir_.get().empty()) {
+    auto* net = getNetwork();
+    if (!cacheDir_.get().empty() && net) {
+        std::pmr::string xml;
+        detail::cacheStateXML(const_cast<CacheBase*>(this), *net, refDir_.get(), xml);
         if (auto f = std::ofstream(cacheDir_.get() / fmt::format("{}.inv", key_))) {
-            f << xml_;
+            f << xml;
         } else {
             throw Exception(SourceContext{}, "Could not write to xml file: {}/{}.inv",
                             cacheDir_.get(), key_);
@@ -110,7 +110,7 @@ void ImageExport::sendResizeEvent() {
     }
 }
 
-const Layer* ImageExport::getData() {
+const Layer* ImageExport::getData() const {
     if (auto img = port_.getData()) {
         return img->getColorLayer();
     }
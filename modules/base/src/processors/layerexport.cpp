@@ -47,7 +47,7 @@ LayerExport::LayerExport(InviwoApplication* app)
     : DataExport<Layer, LayerInport>{util::getDataWriterFactory(app), "", "image"} {
 }
 
-const Layer* LayerExport::getData() {
+const Layer* LayerExport::getData() const {
     if (auto layer = port_.getData()) {
         return layer.get();
     }
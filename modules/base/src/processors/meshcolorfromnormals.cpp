@@ -84,6 +84,8 @@ MeshColorFromNormals::MeshColorFromNormals()
     addProperties(transform_);
 }
 
+bool MeshColorFromNormals::isThreadSafe() const { return true; }
+
 void MeshColorFromNormals::process() {
     auto inMesh = inport_.getData();
 
@@ -75,6 +75,8 @@ MeshConverterProcessor::MeshConverterProcessor()
     addProperty(type_);
 }
 
+bool MeshConverterProcessor::isThreadSafe() const { return true; }
+
 void MeshConverterProcessor::process() {
     auto meshes = std::make_shared<std::vector<std::shared_ptr<Mesh>>>();
     for (auto mesh : inport_) {
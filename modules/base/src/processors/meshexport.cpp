@@ -55,6 +55,6 @@ MeshExport::MeshExport(InviwoApplication* app)
 
 const ProcessorInfo& MeshExport::getProcessorInfo() const { return processorInfo_; }
 
-const Mesh* MeshExport::getData() { return port_.getData().get(); }
+const Mesh* MeshExport::getData() const { return port_.getData().get(); }
 
 }  // namespace inviwo
@@ -97,8 +97,10 @@ SurfaceExtraction::SurfaceExtraction()
     , method_("method", "Method",
               {{"marchingtetrahedron", "Marching Tetrahedron", Method::MarchingTetrahedron},
                {"marchingcubes", "Marching Cubes", Method::MarchingCubes},
-               {"marchingCubesOpt", "Marching Cubes Optimized", Method::MarchingCubesOpt}},
-              2)
+               {"marchingCubesOpt", "Marching Cubes Optimized", Method::MarchingCubesOpt},
+               {"marchingCubesParallel", "Marching Cubes Parallel",
+                Method::MarchingCubesParallel}},
+              3)
     , isoValue_("iso", "ISO Value", 0.5f, 0.0f, 1.0f, 0.01f)
     , invertIso_("invert", "Invert ISO", false)
     , encloseSurface_("enclose", "Enclose Surface", true)
@@ -141,6 +143,9 @@ void SurfaceExtraction::process() {
                     return util::marchingcubes(vol, iso, color, invert, enclose, progress);
                 case Method::MarchingCubesOpt:
                     return util::marchingCubesOpt(vol, iso, color, invert, enclose, progress);
+                case Method::MarchingCubesParallel:
+                    return util::marchingCubesParallel(vol, iso, color, invert, enclose,
+                                                       progress);
                 case Method::MarchingTetrahedron:
                 default:
                     return util::marchingtetrahedron(vol, iso, color, invert, enclose, progress);
@@ -67,6 +67,8 @@ TrianglesToWireframe::TrianglesToWireframe() : Processor(), mesh_{"mesh"}, wiref
     addPort(wireframe_);
 }
 
+bool TrianglesToWireframe::isThreadSafe() const { return true; }
+
 void TrianglesToWireframe::process() {
     auto mesh = mesh_.getData();
     auto wireframe = std::make_shared<Mesh>();
@@ -47,6 +47,6 @@ VolumeExport::VolumeExport(InviwoApplication* app)
 
 const ProcessorInfo& VolumeExport::getProcessorInfo() const { return processorInfo_; }
 
-const Volume* VolumeExport::getData() { return port_.getData().get(); }
+const Volume* VolumeExport::getData() const { return port_.getData().get(); }
 
 }  // namespace inviwo
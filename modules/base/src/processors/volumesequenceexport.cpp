@@ -48,6 +48,6 @@ VolumeSequenceExport::VolumeSequenceExport(InviwoApplication* app)
 
 const ProcessorInfo& VolumeSequenceExport::getProcessorInfo() const { return processorInfo_; }
 
-const VolumeSequence* VolumeSequenceExport::getData() { return port_.getData().get(); }
+const VolumeSequence* VolumeSequenceExport::getData() const { return port_.getData().get(); }
 
 }  // namespace inviwo
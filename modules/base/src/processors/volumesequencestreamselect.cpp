@@ -0,0 +1,124 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/processors/volumesequencestreamselect.h>
+
+#include <inviwo/core/processors/processorstate.h>
+#include <inviwo/core/processors/processortags.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t megaByte = size_t{1} << 20;
+
+OrdinalPropertyState<size_t> statState(Document help) {
+    return util::ordinalCount(size_t{0}, size_t{1000})
+        .set(std::move(help))
+        .set(InvalidationLevel::Valid)
+        .set(ReadOnly::Yes);
+}
+
+}  // namespace
+
+const ProcessorInfo VolumeSequenceStreamSelect::processorInfo_{
+    "org.inviwo.VolumeSequenceStreamSelect",  // Class identifier
+    "Volume Sequence Stream Select",          // Display name
+    "Data Selector",                          // Category
+    CodeState::Experimental,                  // Code state
+    Tags::CPU,                                // Tags
+    R"(Select a specific volume out of a sequence while streaming the volumes from disk.
+    Only the RAM representations of the most recently selected volumes are kept, within the
+    memory budget, the rest are released and reloaded from disk when selected again.
+    The next volumes in the current playback direction are loaded in the background.
+    Volumes that are not backed by a file are passed through untouched.)"_unindentHelp};
+
+const ProcessorInfo& VolumeSequenceStreamSelect::getProcessorInfo() const { return processorInfo_; }
+
+VolumeSequenceStreamSelect::VolumeSequenceStreamSelect()
+    : SequenceSelect<Volume>()
+    , budget_{"budget", "Memory Budget (MB)",
+              util::ordinalCount(size_t{1024}, size_t{65536})
+                  .setMin(size_t{1})
+                  .set("Max size of the loaded volumes, the least recently used volumes are "
+                       "released when exceeded"_help)}
+    , prefetch_{"prefetch", "Prefetch",
+                util::ordinalCount(size_t{2}, size_t{16})
+                    .set("Number of volumes to load ahead in the playback direction"_help)}
+    , stats_{"stats", "Statistics", "Cache statistics"_help}
+    , hits_{"hits", "Hits", statState("Selections of already loaded volumes"_help)}
+    , misses_{"misses", "Misses", statState("Selections that had to load the volume"_help)}
+    , prefetched_{"prefetched", "Prefetched", statState("Volumes loaded in the background"_help)}
+    , evictions_{"evictions", "Evictions",
+                 statState("Volumes released to stay within the budget"_help)}
+    , loaded_{"loaded", "Loaded", statState("Number of currently loaded volumes"_help)}
+    , memory_{"memory", "Memory (MB)", statState("Size of the currently loaded volumes"_help)}
+    , cache_{budget_.get() * megaByte, prefetch_.get()} {
+
+    for (auto* prop : {&hits_, &misses_, &prefetched_, &evictions_, &loaded_, &memory_}) {
+        prop->setSerializationMode(PropertySerializationMode::None);
+        stats_.addProperty(prop, false);
+    }
+    stats_.setCollapsed(true);
+    addProperties(budget_, prefetch_, stats_);
+
+    budget_.onChange([this]() { cache_.setByteBudget(budget_.get() * megaByte); });
+    prefetch_.onChange([this]() { cache_.setPrefetchCount(prefetch_.get()); });
+}
+
+void VolumeSequenceStreamSelect::process() {
+    if (!inport_.isReady()) return;
+
+    auto data = inport_.getData();
+    if (inport_.isChanged() && data) {
+        index_.setMaxValue(std::max(data->size(), size_t{1}) - size_t{1});
+    }
+    cache_.setSequence(data);
+
+    if (!data || data->empty()) {
+        outport_.detachData();
+    } else {
+        outport_.setData(cache_.get(std::min(index_.get(), data->size() - 1)));
+    }
+    updateStats();
+}
+
+void VolumeSequenceStreamSelect::updateStats() {
+    const auto stats = cache_.getStats();
+    hits_.set(stats.hits);
+    misses_.set(stats.misses);
+    prefetched_.set(stats.prefetched);
+    evictions_.set(stats.evictions);
+    loaded_.set(stats.loaded);
+    memory_.set(stats.bytes / megaByte);
+}
+
+}  // namespace inviwo
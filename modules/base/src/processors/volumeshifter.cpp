@@ -83,6 +83,8 @@ VolumeShifter::VolumeShifter()
     addProperties(enabled_, offset_);
 }
 
+bool VolumeShifter::isThreadSafe() const { return true; }
+
 void VolumeShifter::process() {
     if (!enabled_ || (offset_.get() == vec3(0.0f))) {
         outport_.setData(inport_.getData());
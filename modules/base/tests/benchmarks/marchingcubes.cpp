@@ -31,7 +31,9 @@
 #pragma comment(linker, "/SUBSYSTEM:CONSOLE")
 #endif
 
+#include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/logcentral.h>
 #include <modules/base/algorithm/volume/volumegeneration.h>
 
 #include <modules/base/algorithm/volume/marchingcubes.h>
@@ -39,7 +41,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <thread>
 
 #include <warn/push>
 #include <warn/ignore/unused-function>
@@ -136,6 +141,52 @@ static void MiniNew(benchmark::State& state) {
         static_cast<double>(state.range(0) * state.range(0) * state.range(0));
 }
 
+/**
+ * util::marchingCubesParallel of a state.range(0) sized volume using state.range(1) threads, 0
+ * means no thread pool, i.e. the same as util::marchingCubesOpt.
+ */
+static void SphereParallel(benchmark::State& state) {
+    auto v = std::shared_ptr<Volume>(
+        util::makeSphericalVolume(size3_t{static_cast<size_t>(state.range(0))}));
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        auto mesh = util::marchingCubesParallel(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+        state.counters["Vertices"] = static_cast<double>(mesh->getBuffer(0)->getSize());
+        state.counters["Indices"] =
+            static_cast<double>(mesh->getIndexBuffers().front().second->getSize());
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] =
+        static_cast<double>(state.range(0) * state.range(0) * state.range(0));
+}
+
+static void RippleParallel(benchmark::State& state) {
+    auto v = std::shared_ptr<Volume>(
+        util::makeRippleVolume(size3_t{static_cast<size_t>(state.range(0))}));
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        auto mesh = util::marchingCubesParallel(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+        state.counters["Vertices"] = static_cast<double>(mesh->getBuffer(0)->getSize());
+        state.counters["Indices"] =
+            static_cast<double>(mesh->getIndexBuffers().front().second->getSize());
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] =
+        static_cast<double>(state.range(0) * state.range(0) * state.range(0));
+}
+
+static void threadScaling(benchmark::internal::Benchmark* b) {
+    const auto maxThreads = static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int64_t size : {128, 256, 512}) {
+        b->Args({size, 0});
+        for (int64_t threads = 1; threads <= maxThreads; threads *= 2) {
+            b->Args({size, threads});
+        }
+    }
+}
+
 BENCHMARK(SphereOld)->RangeMultiplier(2)->Range(8, 8 << 5);
 BENCHMARK(SphereNew)->RangeMultiplier(2)->Range(8, 8 << 6);
 
@@ -150,6 +201,18 @@ BENCHMARK(RippleNew)->RangeMultiplier(2)->Range(8, 8 << 5);
 
 // BENCHMARK(SphereNew)->Arg(5);
 
-BENCHMARK_MAIN();
+BENCHMARK(SphereParallel)->Apply(threadScaling)->UseRealTime();
+BENCHMARK(RippleParallel)->Apply(threadScaling)->UseRealTime();
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-MarchingCubes");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
 
 #include <warn/pop>
@@ -0,0 +1,85 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/geometry/plane.h>
+#include <inviwo/core/util/logcentral.h>
+#include <modules/base/algorithm/mesh/meshclipping.h>
+#include <modules/base/algorithm/volume/marchingcubes.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+using namespace inviwo;
+
+/**
+ * Clips the isosurface of a spherical volume through its center.
+ * Arguments: the size of the volume, and whether the hole should be capped.
+ */
+void ClipIsosurface(benchmark::State& state) {
+    const auto volume = std::shared_ptr<Volume>(
+        util::makeSphericalVolume(size3_t{static_cast<size_t>(state.range(0))}));
+    const auto mesh = util::marchingcubes(volume, 0.5, vec4{1.0f}, false, false);
+
+    const auto center = vec3{mesh->getCoordinateTransformer().getDataToWorldMatrix() *
+                             vec4{0.5f, 0.5f, 0.5f, 1.0f}};
+    const Plane plane{center, glm::normalize(vec3{1.0f, 2.0f, 3.0f})};
+    const auto cap = state.range(1) != 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meshutil::clipMeshAgainstPlane(*mesh, plane, cap));
+    }
+    const auto triangles = mesh->getIndices(0)->getSize() / 3;
+    state.counters["Triangles"] = static_cast<double>(triangles);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(triangles));
+}
+
+}  // namespace
+
+BENCHMARK(ClipIsosurface)
+    ->ArgsProduct({{64, 128, 256, 512}, {0, 1}})
+    ->ArgNames({"size", "cap"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-MeshClipping");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
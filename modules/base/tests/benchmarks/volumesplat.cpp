@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/logcentral.h>
+#include <modules/base/algorithm/volume/volumesplat.h>
+
+#include <benchmark/benchmark.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace inviwo;
+
+std::vector<vec3> randomPoints(size_t count) {
+    std::mt19937 rand{42};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<vec3> points(count);
+    for (auto& p : points) p = vec3{dist(rand), dist(rand), dist(rand)};
+    return points;
+}
+
+/**
+ * Splats random points in the unit cube into a 128^3 volume.
+ * Arguments: number of points, kernel size in voxels, and whether the volume is axis aligned.
+ */
+template <util::SplatKernel Kernel>
+void Splat(benchmark::State& state) {
+    const auto points = randomPoints(static_cast<size_t>(state.range(0)));
+    const size3_t dims{128};
+    // rotate the volume around the center of the points for the general case
+    const auto rotated = glm::translate(glm::rotate(glm::translate(mat4{1.0f}, vec3{0.5f}), 0.5f,
+                                                    vec3{1.0f, 2.0f, 3.0f}),
+                                        vec3{-0.5f});
+    const auto basis = state.range(2) != 0 ? mat4{1.0f} : rotated;
+
+    const util::SplatSettings settings{
+        .dimensions = dims,
+        .modelMatrix = basis,
+        .kernel = Kernel,
+        .size = static_cast<float>(state.range(1)) / static_cast<float>(dims.x),
+    };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::splat(points, {}, {}, settings));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void arguments(benchmark::internal::Benchmark* b) {
+    b->ArgsProduct({{100'000, 1'000'000, 10'000'000}, {1, 2, 4}, {0, 1}})
+        ->ArgNames({"points", "size", "aligned"})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK(Splat<util::SplatKernel::Gaussian>)->Apply(arguments);
+BENCHMARK(Splat<util::SplatKernel::Epanechnikov>)->Apply(arguments);
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-VolumeSplat");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
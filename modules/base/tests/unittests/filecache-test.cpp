@@ -0,0 +1,118 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/processors/filecache.h>
+
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+#include <memory>
+#include <string>
+
+namespace inviwo {
+
+namespace {
+
+struct TestProcessor : Processor {
+    explicit TestProcessor(std::string_view id)
+        : Processor(id, id)
+        , inport{"in"}
+        , outport{"out"}
+        , prop{"prop", "Int Property", util::ordinalSymmetricVector(0)} {
+        inport.setOptional(true);
+        addPorts(inport, outport);
+        addProperty(prop);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    DataInport<int> inport;
+    DataOutport<int> outport;
+    IntProperty prop;
+};
+
+const ProcessorInfo TestProcessor::processorInfo_{
+    "org.inviwo.FileCacheTestProcessor",  // Class identifier
+    "FileCacheTestProcessor",             // Display name
+    "Testing",                            // Category
+    CodeState::Stable,                    // Code state
+    Tags::CPU,                            // Tags
+};
+
+}  // namespace
+
+TEST(FileCache, PropertyNotificationsWithoutProperty) {
+    ProcessorNetwork network{nullptr};
+    auto* source = static_cast<TestProcessor*>(
+        network.addProcessor(std::make_shared<TestProcessor>("source")));
+    auto* cache = static_cast<TestProcessor*>(
+        network.addProcessor(std::make_shared<TestProcessor>("cache")));
+    network.addConnection(&source->outport, &cache->inport);
+
+    detail::CacheState state{cache};
+    state.setNetwork(&network);
+    const std::string key = state.key({});
+
+    // These notify observers about a change with a null property, the attributes are still part
+    // of the serialized state and have to give the same key as a fresh state
+    source->prop.setVisible(false);
+    source->prop.setReadOnly(true);
+    source->prop.setDisplayName("Renamed");
+    const std::string toggledKey = state.key({});
+    {
+        detail::CacheState fresh{cache};
+        fresh.setNetwork(&network);
+        EXPECT_EQ(fresh.key({}), toggledKey);
+        fresh.setNetwork(nullptr);
+    }
+
+    // The key does not depend on the order of the edits
+    source->prop.set(5);
+    const std::string changedKey = state.key({});
+    EXPECT_NE(changedKey, toggledKey);
+    EXPECT_NE(changedKey, key);
+    source->prop.setVisible(true);
+    source->prop.setReadOnly(false);
+    source->prop.setDisplayName("Int Property");
+    source->prop.set(0);
+    EXPECT_EQ(state.key({}), key);
+
+    state.setNetwork(nullptr);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,190 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/datastructures/flatkdtree.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <glm/gtx/norm.hpp>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<vec3> randomPoints(size_t count, unsigned int seed) {
+    std::mt19937 rand{seed};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<vec3> points(count);
+    std::ranges::generate(points, [&]() { return vec3{dist(rand), dist(rand), dist(rand)}; });
+    return points;
+}
+
+std::vector<std::pair<float, FlatK3DTree<float>::Index>> sortedByDistance(
+    const std::vector<vec3>& points, const vec3& query) {
+    std::vector<std::pair<float, FlatK3DTree<float>::Index>> res;
+    for (size_t i = 0; i < points.size(); ++i) {
+        res.emplace_back(glm::distance2(points[i], query),
+                         static_cast<FlatK3DTree<float>::Index>(i));
+    }
+    std::ranges::sort(res);
+    return res;
+}
+
+/**
+ * Sets the size of the thread pool for the duration of a test
+ */
+struct PoolSize {
+    explicit PoolSize(size_t newSize) : size{util::getPoolSize()} {
+        InviwoApplication::getPtr()->resizePool(newSize);
+    }
+    ~PoolSize() { InviwoApplication::getPtr()->resizePool(size); }
+    size_t size;
+};
+
+}  // namespace
+
+TEST(FlatKDTreeTests, empty) {
+    const FlatK3DTree<float> tree{std::vector<vec3>{}};
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.nearest(vec3{0.5f}), FlatK3DTree<float>::npos);
+
+    const std::vector<vec3> queries{vec3{0.0f}, vec3{1.0f}};
+    const auto res = tree.kNearest(queries, 4);
+    ASSERT_EQ(res.size(), 2);
+    EXPECT_TRUE(res[0].empty());
+    EXPECT_TRUE(res[1].empty());
+}
+
+TEST(FlatKDTreeTests, kNearest) {
+    const auto points = randomPoints(5000, 0);
+    const auto queries = randomPoints(100, 1);
+    const FlatK3DTree<float> tree{points};
+    EXPECT_EQ(tree.size(), points.size());
+
+    const size_t k = 10;
+    const auto res = tree.kNearest(queries, k);
+    ASSERT_EQ(res.size(), queries.size());
+    for (size_t q = 0; q < queries.size(); ++q) {
+        const auto expected = sortedByDistance(points, queries[q]);
+        ASSERT_EQ(res[q].size(), k);
+        for (size_t i = 0; i < k; ++i) {
+            EXPECT_EQ(glm::distance2(points[res[q][i]], queries[q]), expected[i].first);
+        }
+        EXPECT_EQ(glm::distance2(points[tree.nearest(queries[q])], queries[q]),
+                  expected[0].first);
+    }
+}
+
+TEST(FlatKDTreeTests, kLargerThanSize) {
+    const auto points = randomPoints(5, 0);
+    const FlatK3DTree<float> tree{points};
+
+    std::vector<FlatK3DTree<float>::Index> res(8);
+    EXPECT_EQ(tree.kNearest(vec3{0.5f}, res), 5);
+    std::ranges::sort(res.begin(), res.begin() + 5);
+    EXPECT_EQ(res[0], 0);
+    EXPECT_EQ(res[4], 4);
+}
+
+TEST(FlatKDTreeTests, withinRadius) {
+    const auto points = randomPoints(5000, 0);
+    const auto queries = randomPoints(100, 1);
+    const FlatK3DTree<float> tree{points};
+
+    const float radius = 0.1f;
+    const auto res = tree.withinRadius(queries, radius);
+    ASSERT_EQ(res.size(), queries.size());
+    for (size_t q = 0; q < queries.size(); ++q) {
+        std::vector<FlatK3DTree<float>::Index> expected;
+        for (const auto& [dist2, i] : sortedByDistance(points, queries[q])) {
+            if (dist2 <= radius * radius) expected.push_back(i);
+        }
+        std::vector<FlatK3DTree<float>::Index> found(res[q].begin(), res[q].end());
+        std::ranges::sort(expected);
+        std::ranges::sort(found);
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(FlatKDTreeTests, duplicates) {
+    const std::vector<vec3> points(100, vec3{0.25f});
+    const FlatK3DTree<float> tree{points};
+
+    std::vector<FlatK3DTree<float>::Index> found;
+    tree.withinRadius(vec3{0.25f}, 0.0f, found);
+    EXPECT_EQ(found.size(), points.size());
+}
+
+TEST(FlatKDTreeTests, parallelMatchesSequential) {
+    // Large enough to build subtrees and run batched queries concurrently
+    const auto points = randomPoints(100000, 0);
+    const auto queries = randomPoints(10000, 1);
+    const size_t k = 8;
+    const float radius = 0.02f;
+
+    const auto [sequentialKNearest, sequentialWithinRadius] = [&]() {
+        const PoolSize pool{0};
+        const FlatK3DTree<float> tree{points};
+        return std::pair{tree.kNearest(queries, k), tree.withinRadius(queries, radius)};
+    }();
+
+    const PoolSize pool{4};
+    ASSERT_GT(util::getPoolSize(), 0);
+    const FlatK3DTree<float> tree{points};
+    const auto kNearest = tree.kNearest(queries, k);
+    const auto withinRadius = tree.withinRadius(queries, radius);
+
+    ASSERT_EQ(kNearest.size(), queries.size());
+    ASSERT_EQ(withinRadius.size(), queries.size());
+    for (size_t q = 0; q < queries.size(); ++q) {
+        EXPECT_TRUE(std::ranges::equal(kNearest[q], sequentialKNearest[q])) << "query " << q;
+        EXPECT_TRUE(std::ranges::equal(withinRadius[q], sequentialWithinRadius[q]))
+            << "query " << q;
+
+        std::vector<FlatK3DTree<float>::Index> single(k);
+        ASSERT_EQ(tree.kNearest(queries[q], single), k);
+        EXPECT_TRUE(std::ranges::equal(kNearest[q], single)) << "query " << q;
+
+        single.clear();
+        tree.withinRadius(queries[q], radius, single);
+        EXPECT_TRUE(std::ranges::equal(withinRadius[q], single)) << "query " << q;
+    }
+}
+
+}  // namespace inviwo
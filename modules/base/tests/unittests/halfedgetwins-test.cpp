@@ -0,0 +1,141 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/mesh/halfedgetwins.h>
+
+#include <inviwo/core/util/exception.h>
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr auto noTwin = meshutil::HalfEdgeTwins::noTwin;
+
+/**
+ * Reference implementation, the twin of a half edge a-b is the first half edge b-a.
+ */
+std::vector<std::uint32_t> mapTwins(const std::vector<std::uint32_t>& triangles) {
+    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
+    const auto next = [](std::uint32_t h) { return h - h % 3 + (h + 1) % 3; };
+    for (std::uint32_t h = 0; h < triangles.size(); ++h) {
+        edgeMap.try_emplace({triangles[h], triangles[next(h)]}, h);
+    }
+    std::vector<std::uint32_t> twins(triangles.size(), noTwin);
+    for (std::uint32_t h = 0; h < triangles.size(); ++h) {
+        if (triangles[h] == triangles[next(h)]) continue;
+        if (auto it = edgeMap.find({triangles[next(h)], triangles[h]}); it != edgeMap.end()) {
+            twins[h] = it->second;
+        }
+    }
+    return twins;
+}
+
+std::vector<std::uint32_t> createGrid(std::uint32_t width, std::uint32_t height) {
+    std::vector<std::uint32_t> triangles;
+    const auto index = [&](std::uint32_t x, std::uint32_t y) { return x + y * (width + 1); };
+    for (std::uint32_t y = 0; y < height; ++y) {
+        for (std::uint32_t x = 0; x < width; ++x) {
+            triangles.insert(triangles.end(),
+                             {index(x, y), index(x + 1, y), index(x, y + 1), index(x + 1, y),
+                              index(x + 1, y + 1), index(x, y + 1)});
+        }
+    }
+    return triangles;
+}
+
+}  // namespace
+
+TEST(HalfEdgeTwins, Empty) {
+    const auto res = meshutil::findHalfEdgeTwins({});
+    EXPECT_TRUE(res.twins.empty());
+    EXPECT_EQ(res.edges, 0);
+    EXPECT_TRUE(res.isClosed());
+    EXPECT_TRUE(res.isManifold());
+
+    const std::vector<std::uint32_t> invalid{0, 1};
+    EXPECT_THROW(meshutil::findHalfEdgeTwins(invalid), Exception);
+}
+
+TEST(HalfEdgeTwins, Tetrahedron) {
+    const std::vector<std::uint32_t> triangles{0, 2, 1, 0, 1, 3, 1, 2, 3, 2, 0, 3};
+    const auto res = meshutil::findHalfEdgeTwins(triangles);
+
+    EXPECT_EQ(res.twins, mapTwins(triangles));
+    EXPECT_EQ(res.edges, 6);
+    EXPECT_TRUE(res.isClosed());
+    EXPECT_TRUE(res.isManifold());
+    for (std::uint32_t h = 0; h < triangles.size(); ++h) {
+        ASSERT_NE(res.twins[h], noTwin);
+        EXPECT_EQ(res.twins[res.twins[h]], h);
+    }
+}
+
+TEST(HalfEdgeTwins, Grid) {
+    // Large enough to be split into several chunks and to need more than one radix pass
+    constexpr std::uint32_t width = 300;
+    constexpr std::uint32_t height = 200;
+    const auto triangles = createGrid(width, height);
+    const auto res = meshutil::findHalfEdgeTwins(triangles);
+
+    EXPECT_EQ(res.twins, mapTwins(triangles));
+    EXPECT_EQ(res.edges, width * (height + 1) + height * (width + 1) + width * height);
+    EXPECT_EQ(res.boundaryEdges, 2 * (width + height));
+    EXPECT_TRUE(res.isManifold());
+}
+
+TEST(HalfEdgeTwins, NonManifold) {
+    // Three triangles sharing the edge 0-1, one triangle with flipped orientation next to 1-2,
+    // and a degenerate triangle
+    const std::vector<std::uint32_t> triangles{0, 1, 2, 1, 0, 3, 1, 0, 4, 1, 2, 5, 6, 6, 7};
+    const auto res = meshutil::findHalfEdgeTwins(triangles);
+
+    EXPECT_EQ(res.twins, mapTwins(triangles));
+    EXPECT_EQ(res.twins[0], 3);
+    EXPECT_EQ(res.twins[3], 0);
+    EXPECT_EQ(res.twins[6], 0);
+    EXPECT_EQ(res.twins[12], noTwin);
+    EXPECT_EQ(res.twins[13], 14);
+
+    // 0-1 and 1-2 are non-manifold, 6-6 is degenerate and ignored
+    EXPECT_EQ(res.nonManifoldEdges, 2);
+    EXPECT_EQ(res.edges, 10);
+    EXPECT_EQ(res.boundaryEdges, 7);
+}
+
+}  // namespace inviwo
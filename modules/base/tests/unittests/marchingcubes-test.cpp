@@ -41,6 +41,7 @@
 #include <modules/base/algorithm/volume/marchingcubes.h>
 #include <modules/base/algorithm/volume/marchingcubesopt.h>
 
+#include <glm/geometric.hpp>
 #include <glm/gtx/normal.hpp>
 
 namespace inviwo {
@@ -336,4 +337,28 @@ TEST(Marchingcubes, sphere) {
     */
 }
 
+TEST(Marchingcubes, slabs) {
+    auto v = std::shared_ptr<Volume>(util::makeRippleVolume(size3_t{17, 13, 29}));
+
+    auto mesh1 = util::marchingCubesOpt(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+    auto& pos1 = getBufferData<vec3>(*mesh1, 0);
+    auto& ind1 = getBufferIndexData(*mesh1, 0);
+    ASSERT_FALSE(ind1.empty());
+
+    for (size_t slabs : {2, 3, 7, 28}) {
+        // The slabs are stitched such that the vertex order matches the serial version.
+        auto mesh2 =
+            util::marchingCubesParallel(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false, nullptr,
+                                        nullptr, slabs);
+        auto& pos2 = getBufferData<vec3>(*mesh2, 0);
+        auto& ind2 = getBufferIndexData(*mesh2, 0);
+
+        ASSERT_EQ(pos1.size(), pos2.size()) << "slabs: " << slabs;
+        EXPECT_EQ(ind1, ind2) << "slabs: " << slabs;
+        for (size_t i = 0; i < pos1.size(); ++i) {
+            EXPECT_NEAR(glm::distance(pos1[i], pos2[i]), 0.0f, 1.0e-5f) << "slabs: " << slabs;
+        }
+    }
+}
+
 }  // namespace inviwo
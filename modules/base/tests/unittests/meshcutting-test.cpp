@@ -126,6 +126,64 @@ TEST(MeshCutting, GatherLoops) {
     ASSERT_EQ(loops[0].size(), 3);
 }
 
+TEST(MeshCutting, GatherLoopsWelded) {
+    // Two squares where each edge has its own copies of the corners, slightly perturbed, as they
+    // are when created by clipping neighboring triangles
+    const float d = 1e-7f;
+    const std::vector<vec3> positions{
+        {0, 0, 0}, {1, 0, 0}, {1 + d, 0, 0}, {1, 1, 0}, {1, 1 - d, 0}, {0, 1, 0}, {0, 1, 0},
+        {0, d, 0}, {5, 0, 0}, {6, 0, 0}, {6, 0, 0}, {5.5, 1, 0}, {5.5, 1, 0}, {5, 0, 0}};
+    std::vector<glm::u32vec2> edges{{0, 1}, {2, 3}, {5, 4}, {6, 7}, {8, 9}, {11, 10}, {12, 13}};
+
+    const auto loops = meshutil::detail::gatherLoops(edges, positions, 0.000001f);
+
+    ASSERT_EQ(loops.size(), 2);
+    EXPECT_EQ(loops[0].size(), 3);
+    EXPECT_EQ(loops[1].size(), 4);
+    EXPECT_TRUE(edges.empty());
+}
+
+TEST(MeshCutting, RemoveDuplicateEdges) {
+    const float d = 1e-7f;
+    const std::vector<vec3> positions{{0, 0, 0}, {1, 0, 0}, {1, d, 0}, {d, 0, 0}, {0, 1, 0}};
+    // {3, 2} duplicates {0, 1} reversed, {0, 3} is degenerate
+    std::vector<glm::u32vec2> edges{{0, 1}, {3, 2}, {0, 3}, {1, 4}, {4, 1}};
+
+    meshutil::detail::removeDuplicateEdges(edges, positions, 0.000001f);
+
+    ASSERT_EQ(edges.size(), 2);
+    EXPECT_EQ(edges[0], glm::u32vec2(0, 1));
+    EXPECT_EQ(edges[1], glm::u32vec2(1, 4));
+}
+
+TEST(MeshCutting, ClipOctahedron) {
+    Mesh mesh;
+    mesh.addBuffer(BufferType::PositionAttrib,
+                   util::makeBuffer(std::vector<vec3>{
+                       {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}}));
+    mesh.addIndices({DrawType::Triangles, ConnectivityType::None},
+                    util::makeIndexBuffer({0, 1, 4, 1, 2, 4, 2, 3, 4, 3, 0, 4,
+                                           1, 0, 5, 2, 1, 5, 3, 2, 5, 0, 3, 5}));
+
+    const Plane plane{vec3{0.0f, 0.0f, 0.25f}, vec3{0.0f, 0.0f, 1.0f}};
+    const auto clipped = meshutil::clipMeshAgainstPlane(mesh, plane, true);
+
+    // The top pyramid is clipped into four triangles, and the square cut is capped by a fan of
+    // four triangles around its center
+    ASSERT_EQ(clipped->getNumberOfIndices(), 2);
+    EXPECT_EQ(clipped->getIndices(0)->getSize(), 12);
+    EXPECT_EQ(clipped->getIndices(1)->getSize(), 12);
+
+    const auto& positions = static_cast<const Buffer<vec3>*>(clipped->getBuffer(0))
+                                ->getRAMRepresentation()
+                                ->getDataContainer();
+    for (size_t i = 0; i < clipped->getNumberOfIndices(); ++i) {
+        for (auto index : clipped->getIndices(i)->getRAMRepresentation()->getDataContainer()) {
+            EXPECT_GE(plane.distance(positions[index]), -1e-5f);
+        }
+    }
+}
+
 TEST(MeshCutting, PolygonCentroid) {
 
     const auto expected = vec2{0.5f, 0.5f};
@@ -4,8 +4,15 @@
 #include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <gtest/gtest.h>
 
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/norm.hpp>
+
+#include <cmath>
+#include <vector>
+
 namespace inviwo {
 
 TEST(SplatTest, SinglePointCenter) {
@@ -53,4 +60,64 @@ TEST(SplatTest, SinglePointCenter) {
     EXPECT_GT(center, 0.0);
 }
 
+namespace {
+
+std::vector<float> splatData(std::span<const vec3> positions, std::span<const float> radii,
+                             const util::SplatSettings& settings) {
+    auto volume = util::splat(positions, radii, {}, settings);
+    const auto* ram = static_cast<const VolumeRAMPrecision<float>*>(
+        volume->getRepresentation<VolumeRAM>());
+    const auto dims = volume->getDimensions();
+    return {ram->getDataTyped(), ram->getDataTyped() + dims.x * dims.y * dims.z};
+}
+
+}  // namespace
+
+TEST(SplatTest, SlabsMatchSingleJob) {
+    std::vector<vec3> positions;
+    std::vector<float> radii;
+    for (int i = 0; i < 500; ++i) {
+        const auto t = static_cast<float>(i);
+        positions.emplace_back(std::fmod(t * 0.37f, 1.0f), std::fmod(t * 0.61f, 1.0f),
+                               std::fmod(t * 0.13f, 1.0f));
+        radii.push_back(0.5f + std::fmod(t * 0.29f, 1.0f));
+    }
+
+    for (auto kernel : {util::SplatKernel::Gaussian, util::SplatKernel::Epanechnikov}) {
+        for (auto modelMatrix : {mat4(1.0f), glm::rotate(mat4(1.0f), 0.3f, vec3(1, 1, 0))}) {
+            SCOPED_TRACE(util::enumToStr(kernel));
+            util::SplatSettings settings{.dimensions = size3_t(16, 12, 20),
+                                         .modelMatrix = modelMatrix,
+                                         .kernel = kernel,
+                                         .size = 0.1f,
+                                         .jobs = 1};
+
+            const auto reference = splatData(positions, radii, settings);
+            settings.jobs = 7;
+            EXPECT_EQ(splatData(positions, radii, settings), reference);
+        }
+    }
+}
+
+TEST(SplatTest, AxisAlignedKernel) {
+    const std::vector<vec3> positions{vec3(0.43f, 0.52f, 0.61f)};
+    const util::SplatSettings settings{
+        .dimensions = size3_t(10),
+        .modelMatrix = mat4(1.0f),
+        .kernel = util::SplatKernel::Epanechnikov,
+        .size = 0.3f,
+    };
+
+    auto volume = util::splat(positions, {}, {}, settings);
+    const auto indexToWorld = volume->getCoordinateTransformer().getIndexToWorldMatrix();
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    for (const auto& index : {size3_t(4, 5, 6), size3_t(3, 5, 7), size3_t(5, 4, 5)}) {
+        const auto voxel = vec3{indexToWorld * vec4{vec3{index}, 1.0f}};
+        const auto d2 = glm::distance2(voxel, positions.front());
+        const auto s = settings.size;
+        const auto expected = d2 > s * s ? 0.0f : 3.0f / (4.0f * s) * (1.0f - d2 / (s * s));
+        EXPECT_NEAR(ram->getAsDouble(index), expected, 1e-5);
+    }
+}
+
 }
@@ -37,6 +37,14 @@
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/indexmapper.h>
 
+#include <limits>
+#include <random>
+
+#include <glm/gtx/component_wise.hpp>
+#include <glm/gtx/norm.hpp>
+#include <glm/gtx/transform.hpp>
+#include <glm/mat3x3.hpp>
+
 namespace inviwo {
 
 constexpr auto clamp3D = Wrapping3D{Wrapping::Clamp, Wrapping::Clamp, Wrapping::Clamp};
@@ -246,4 +254,147 @@ TEST(VolumeVoronoi, Voronoi_ThreeSeedPoints_PartitionsVolumeInThree) {
     }
 }
 
+namespace {
+
+/**
+ * Brute force reference using the minimum image distance, ties are resolved to the first seed
+ */
+std::vector<unsigned short> bruteForceVoronoi(
+    const size3_t dim, const mat4& i2d, const mat4& d2m,
+    const std::vector<std::pair<uint32_t, vec3>>& seedPoints, const Wrapping3D& wrapping) {
+    const auto m2d = glm::inverse(d2m);
+    std::vector<unsigned short> result;
+    for (size_t z = 0; z < dim.z; z++) {
+        for (size_t y = 0; y < dim.y; y++) {
+            for (size_t x = 0; x < dim.x; x++) {
+                const auto pos = dvec3{vec3{i2d * vec4{x, y, z, 1.0f}}};
+                size_t best = 0;
+                double bestDist = std::numeric_limits<double>::max();
+                for (size_t i = 0; i < seedPoints.size(); ++i) {
+                    auto delta = pos - dvec3{vec3{m2d * vec4{seedPoints[i].second, 1.0f}}};
+                    for (int axis = 0; axis < 3; ++axis) {
+                        if (wrapping[axis] != Wrapping::Repeat) continue;
+                        if (delta[axis] > 0.5) delta[axis] -= 1.0;
+                        if (delta[axis] < -0.5) delta[axis] += 1.0;
+                    }
+                    const auto d = glm::length2(dmat3{d2m} * delta);
+                    if (d < bestDist) {
+                        bestDist = d;
+                        best = i;
+                    }
+                }
+                result.push_back(static_cast<unsigned short>(seedPoints[best].first));
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<unsigned short> voxels(const Volume& volume) {
+    const auto* ram = static_cast<const VolumeRAMPrecision<unsigned short>*>(
+        volume.getRepresentation<VolumeRAM>());
+    return {ram->getDataTyped(), ram->getDataTyped() + glm::compMul(volume.getDimensions())};
+}
+
+}  // namespace
+
+TEST(VolumeVoronoi, Voronoi_PeriodicTie_ResolvesToFirstSeed) {
+    // Voxel positions and seeds are exact binary fractions. At x = 0.125 both seeds are at a
+    // distance of 0.25, the first seed only through its periodic image.
+    const size3_t dim{8, 2, 2};
+    const mat4 i2d = glm::scale(vec3{0.125f});
+    const mat4 d2m{1.0f};
+    const std::vector<std::pair<uint32_t, vec3>> seedPoints = {{7, vec3{0.875f, 0.0f, 0.0f}},
+                                                               {3, vec3{0.375f, 0.0f, 0.0f}}};
+    const Wrapping3D wrapping{Wrapping::Repeat, Wrapping::Clamp, Wrapping::Clamp};
+
+    const auto volume =
+        util::voronoiSegmentation(dim, i2d, d2m, seedPoints, wrapping, std::nullopt);
+    const auto data = voxels(*volume);
+    EXPECT_EQ(data[1], 7);
+    EXPECT_EQ(data, bruteForceVoronoi(dim, i2d, d2m, seedPoints, wrapping));
+}
+
+TEST(VolumeVoronoi, Voronoi_PeriodicSkewedBasis_MatchesBruteForce) {
+    const size3_t dim{9, 8, 7};
+    const mat4 i2d = glm::scale(1.0f / vec3{dim});
+    const mat4 d2m{vec4{2.0f, 0.0f, 0.0f, 0.0f}, vec4{1.2f, 1.0f, 0.0f, 0.0f},
+                   vec4{0.3f, -0.4f, 1.5f, 0.0f}, vec4{0.0f, 0.0f, 0.0f, 1.0f}};
+
+    std::mt19937 rand{1};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<std::pair<uint32_t, vec3>> seedPoints;
+    for (uint32_t i = 0; i < 30; ++i) {
+        const vec3 dataPos{dist(rand), dist(rand), dist(rand)};
+        seedPoints.emplace_back(i + 1, vec3{d2m * vec4{dataPos, 1.0f}});
+    }
+
+    for (const auto& wrapping : {Wrapping3D{Wrapping::Repeat, Wrapping::Repeat, Wrapping::Clamp},
+                                 Wrapping3D{Wrapping::Clamp, Wrapping::Clamp, Wrapping::Repeat}}) {
+        const auto volume =
+            util::voronoiSegmentation(dim, i2d, d2m, seedPoints, wrapping, std::nullopt);
+        EXPECT_EQ(voxels(*volume), bruteForceVoronoi(dim, i2d, d2m, seedPoints, wrapping));
+    }
+}
+
+TEST(VolumeVoronoi, Voronoi_RandomSeedPoints_MatchesBruteForce) {
+    const size3_t dim{9, 8, 7};
+    Entity entity{dim};
+    const auto i2d = entity.getCoordinateTransformer().getIndexToDataMatrix();
+    const auto d2m = entity.getCoordinateTransformer().getDataToModelMatrix();
+
+    std::mt19937 rand{0};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<vec3> dataSeedPoints;
+    std::vector<std::pair<uint32_t, vec3>> seedPoints;
+    std::vector<float> weights;
+    for (uint32_t i = 0; i < 40; ++i) {
+        dataSeedPoints.emplace_back(dist(rand), dist(rand), dist(rand));
+        seedPoints.emplace_back(i + 1, vec3{d2m * vec4{dataSeedPoints.back(), 1.0f}});
+        weights.push_back(0.1f * dist(rand));
+    }
+
+    const Wrapping3D wrapping{Wrapping::Repeat, Wrapping::Clamp, Wrapping::Repeat};
+
+    for (const bool weighted : {false, true}) {
+        auto volumeVoronoi = util::voronoiSegmentation(
+            dim, i2d, d2m, seedPoints, wrapping,
+            weighted ? std::optional<std::vector<float>>{weights} : std::nullopt);
+        const auto data = static_cast<const VolumeRAMPrecision<unsigned short>*>(
+                              volumeVoronoi->getRepresentation<VolumeRAM>())
+                              ->getDataTyped();
+        const util::IndexMapper3D im(dim);
+
+        // periodic distance in data space, measured in model space
+        const auto distance2 = [&](vec3 a, vec3 b) {
+            auto delta = b - a;
+            for (const size_t i : {size_t{0}, size_t{2}}) {
+                if (delta[i] > 0.5f) delta[i] -= 1.0f;
+                if (delta[i] < -0.5f) delta[i] += 1.0f;
+            }
+            return glm::length2(mat3{d2m} * delta);
+        };
+
+        for (size_t z = 0; z < dim.z; z++) {
+            for (size_t y = 0; y < dim.y; y++) {
+                for (size_t x = 0; x < dim.x; x++) {
+                    const auto pos = vec3{i2d * vec4{x, y, z, 1.0f}};
+                    size_t best = 0;
+                    float bestDist = std::numeric_limits<float>::max();
+                    for (size_t i = 0; i < seedPoints.size(); ++i) {
+                        const auto w = weighted ? weights[i] : 0.0f;
+                        const auto d = distance2(dataSeedPoints[i], pos) - w * w;
+                        if (d < bestDist) {
+                            bestDist = d;
+                            best = i;
+                        }
+                    }
+                    EXPECT_EQ(data[im(x, y, z)], seedPoints[best].first)
+                        << "pos " << x << ", " << y << ", " << z << " weighted " << weighted;
+                }
+            }
+        }
+    }
+}
+
 }  // namespace inviwo
@@ -347,6 +347,9 @@ public:
     CategoricalColumn(std::string_view header, std::vector<type> data,
                       std::vector<std::string> lookup, Unit unit = Unit{},
                       std::optional<dvec2> range = std::nullopt);
+    CategoricalColumn(std::string_view header, std::shared_ptr<Buffer<type>> buffer,
+                      std::vector<std::string> lookup, Unit unit = Unit{},
+                      std::optional<dvec2> range = std::nullopt);
 
     CategoricalColumn(const CategoricalColumn& rhs);
     CategoricalColumn(const CategoricalColumn& rhs, std::span<const std::uint32_t> rowSelection);
@@ -0,0 +1,74 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>
+#include <inviwo/core/io/datareader.h>
+
+#include <memory>
+
+namespace inviwo {
+class DataFrame;
+
+/**
+ * @ingroup dataio
+ * Reads a DataFrame from the binary columnar .ivdf format written by BinaryDataFrameWriter.
+ *
+ * File layout:
+ *   - 8 byte magic "ivwdataf"
+ *   - uint64 format version
+ *   - uint64 size of the header in bytes
+ *   - the header, a JSON object with the number of rows, the byte order, and for each column
+ *     its header, column type, data format, unit, custom range, categories, and the offset and
+ *     size of its data block
+ *   - the column data blocks, each aligned to 64 bytes. Offsets are relative to the first block.
+ *
+ * Only the header is parsed while reading. The file is memory mapped and each column gets a
+ * BufferDisk representation that is loaded straight from the mapping the first time the column
+ * data is accessed.
+ */
+class IVW_MODULE_DATAFRAME_API BinaryDataFrameReader : public DataReaderType<DataFrame> {
+public:
+    BinaryDataFrameReader();
+    BinaryDataFrameReader(const BinaryDataFrameReader&) = default;
+    BinaryDataFrameReader(BinaryDataFrameReader&&) noexcept = default;
+    BinaryDataFrameReader& operator=(const BinaryDataFrameReader&) = default;
+    BinaryDataFrameReader& operator=(BinaryDataFrameReader&&) noexcept = default;
+    virtual BinaryDataFrameReader* clone() const override;
+    virtual ~BinaryDataFrameReader() = default;
+    using DataReaderType<DataFrame>::readData;
+
+    /**
+     * Read the header of @p fileName and create a DataFrame with lazily loaded columns.
+     * @throws DataReaderException if the file cannot be accessed or is not a valid .ivdf file
+     */
+    virtual std::shared_ptr<DataFrame> readData(const std::filesystem::path& fileName) override;
+};
+
+}  // namespace inviwo
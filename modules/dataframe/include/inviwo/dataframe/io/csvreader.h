@@ -53,6 +53,9 @@ class DataFrame;
  * @brief A reader for comma separated value (CSV) files with customizable delimiters and filters.
  * The default delimiter is ',' and headers are included. Floating point values are stored as
  * float32 unless double precision is enabled.
+ *
+ * Files are memory mapped and parsed in parallel on the thread pool in chunks split at row
+ * boundaries. Column types are determined from the first rows, see setNumberOfExampleRows.
  */
 class IVW_MODULE_DATAFRAME_API CSVReader : public DataReaderType<DataFrame> {
 public:
@@ -214,13 +217,19 @@ private:
         bool index = false;
     };
 
-    std::vector<TypeCounts> findCellTypes(
-        size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
-        size_t sampleRows) const;
+    struct ColumnTarget;
+
+    /**
+     * Parse the CSV data in @p content. The data is split into chunks at row boundaries which are
+     * parsed in parallel into typed buffers, one per column, and then concatenated.
+     */
+    std::shared_ptr<DataFrame> readContent(std::string_view content) const;
+
+    std::vector<TypeCounts> findCellTypes(size_t nCol, std::string_view data, size_t firstLine,
+                                          size_t sampleRows) const;
 
-    std::vector<std::function<void(std::string_view, size_t, size_t)>> addColumns(
-        DataFrame& df, const std::vector<TypeCounts>& types,
-        const std::vector<std::string>& headers) const;
+    std::vector<ColumnTarget> addColumns(DataFrame& df, const std::vector<TypeCounts>& types,
+                                         const std::vector<std::string>& headers) const;
 
     bool skipRow(std::string_view row, size_t lineNumber, bool filterOnHeader) const;
 
@@ -46,6 +46,8 @@
 #include <modules/base/processors/inputselector.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/dataframe/io/json/dataframepropertyjsonconverter.h>  // IWYU pragma: keep
+#include <inviwo/dataframe/io/binarydataframereader.h>
+#include <inviwo/dataframe/io/binarydataframewriter.h>
 #include <inviwo/dataframe/io/csvreader.h>
 #include <inviwo/dataframe/io/csvwriter.h>
 #include <inviwo/dataframe/io/jsondataframereader.h>
@@ -136,10 +138,12 @@ DataFrameModule::DataFrameModule(InviwoApplication* app)
     // Readers and writes
     registerDataReader(std::make_unique<CSVReader>());
     registerDataReader(std::make_unique<JSONDataFrameReader>());
+    registerDataReader(std::make_unique<BinaryDataFrameReader>());
 
     registerDataWriter(std::make_unique<CSVWriter>());
     registerDataWriter(std::make_unique<XMLWriter>());
     registerDataWriter(std::make_unique<JSONDataFrameWriter>());
+    registerDataWriter(std::make_unique<BinaryDataFrameWriter>());
 
     // Data converters
     registerPropertyConverter(std::make_unique<OptionToStringConverter<ColumnOptionProperty>>());
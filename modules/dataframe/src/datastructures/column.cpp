@@ -76,10 +76,17 @@ CategoricalColumn::CategoricalColumn(std::string_view header,
 CategoricalColumn::CategoricalColumn(std::string_view header, std::vector<type> data,
                                      std::vector<std::string> lookup, Unit unit,
                                      std::optional<dvec2> range)
+    : CategoricalColumn(header, util::makeBuffer(std::move(data)), std::move(lookup), unit,
+                        range) {}
+
+CategoricalColumn::CategoricalColumn(std::string_view header,
+                                     std::shared_ptr<Buffer<type>> buffer,
+                                     std::vector<std::string> lookup, Unit unit,
+                                     std::optional<dvec2> range)
     : header_{header}
     , unit_{unit}
     , range_{range}
-    , buffer_{util::makeBuffer(std::move(data))}
+    , buffer_{std::move(buffer)}
     , lookUpTable_{std::move(lookup)} {
 
     for (auto&& [i, str] : util::enumerate<type>(lookUpTable_)) {
@@ -0,0 +1,240 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframereader.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferdisk.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/fileextension.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/sourcecontext.h>
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <modules/json/json.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t alignment = 64;
+constexpr size_t aligned(size_t size) { return (size + alignment - 1) / alignment * alignment; }
+
+/**
+ * Loads a column block from a shared mapping of the file. The mapping is kept alive as long as
+ * any column still refers to it.
+ */
+class MappedBufferLoader : public DiskRepresentationLoader<BufferRepresentation> {
+public:
+    MappedBufferLoader(std::shared_ptr<MemoryMappedFile> file, size_t offset)
+        : file_{std::move(file)}, offset_{offset} {}
+
+    virtual MappedBufferLoader* clone() const override { return new MappedBufferLoader(*this); }
+
+    virtual std::shared_ptr<BufferRepresentation> createRepresentation(
+        const BufferRepresentation& src) const override {
+        auto ram = createBufferRAM(src.getSize(), src.getDataFormat(), src.getBufferUsage(),
+                                   src.getBufferTarget());
+        load(*ram);
+        return ram;
+    }
+
+    virtual void updateRepresentation(std::shared_ptr<BufferRepresentation> dest,
+                                      const BufferRepresentation& src) const override {
+        auto ram = std::static_pointer_cast<BufferRAM>(dest);
+        if (ram->getSize() != src.getSize()) {
+            ram->setSize(src.getSize());
+        }
+        load(*ram);
+    }
+
+private:
+    void load(BufferRAM& ram) const {
+        std::memcpy(ram.getData(), file_->data() + offset_, ram.getSize() * ram.getSizeOfElement());
+    }
+
+    std::shared_ptr<MemoryMappedFile> file_;
+    size_t offset_;
+};
+
+template <typename T>
+std::shared_ptr<Buffer<T>> createBuffer(const std::shared_ptr<MemoryMappedFile>& file,
+                                        size_t offset, size_t rows) {
+    auto disk = std::make_shared<BufferDisk>(file->path(), rows, DataFormat<T>::get());
+    disk->setLoader(new MappedBufferLoader(file, offset));
+    auto buffer = std::make_shared<Buffer<T>>(rows);
+    buffer->addRepresentation(disk);
+    return buffer;
+}
+
+std::optional<dvec2> readRange(const json& jc) {
+    if (auto it = jc.find("range"); it != jc.end()) {
+        return dvec2{it->at(0).get<double>(), it->at(1).get<double>()};
+    }
+    return std::nullopt;
+}
+
+std::shared_ptr<DataFrame> createDataFrame(const json& header,
+                                           const std::shared_ptr<MemoryMappedFile>& file,
+                                           size_t dataStart,
+                                           const std::filesystem::path& fileName) {
+    const auto bytes = file->bytes();
+
+    const auto* nativeOrder = std::endian::native == std::endian::little ? "little" : "big";
+    if (header.at("byteOrder").get<std::string_view>() != nativeOrder) {
+        throw DataReaderException(SourceContext{}, "Byte order of {} does not match this system",
+                                  fileName);
+    }
+
+    const auto rows = header.at("rows").get<size_t>();
+
+    std::vector<std::shared_ptr<Column>> columns;
+    for (const auto& jc : header.at("columns")) {
+        const auto colHeader = jc.at("header").get<std::string>();
+        const auto type = jc.at("type").get<std::string_view>();
+        const auto* format = [&]() {
+            try {
+                return DataFormatBase::get(jc.at("format").get<std::string_view>());
+            } catch (const DataFormatException& e) {
+                throw DataReaderException(SourceContext{},
+                                          "Invalid format for column '{}' in {}: {}", colHeader,
+                                          fileName, e.getMessage());
+            }
+        }();
+        const auto offset = jc.at("offset").get<size_t>();
+        const auto size = jc.at("size").get<size_t>();
+        const auto unitStr = jc.value("unit", std::string{});
+        const auto unit = unitStr.empty() ? Unit{} : units::unit_from_string(unitStr);
+        const auto range = readRange(jc);
+
+        if (format->getId() == DataFormatId::NotSpecialized) {
+            throw DataReaderException(SourceContext{}, "Unsupported format for column '{}' in {}",
+                                      colHeader, fileName);
+        }
+        // Checked without overflow, the values come straight from the file
+        const auto elementSize = format->getSizeInBytes();
+        if (dataStart > bytes.size() || offset > bytes.size() - dataStart ||
+            size > bytes.size() - dataStart - offset || rows > size / elementSize ||
+            size != rows * elementSize) {
+            throw DataReaderException(SourceContext{}, "Invalid data block for column '{}' in {}",
+                                      colHeader, fileName);
+        }
+
+        if (type == "index" || type == "categorical") {
+            if (format->getId() != DataFormatId::UInt32) {
+                throw DataReaderException(SourceContext{},
+                                          "Expected UINT32 data for {} column '{}' in {}", type,
+                                          colHeader, fileName);
+            }
+            auto buffer = createBuffer<std::uint32_t>(file, dataStart + offset, rows);
+            if (type == "index") {
+                columns.push_back(std::make_shared<IndexColumn>(colHeader, buffer));
+            } else {
+                columns.push_back(std::make_shared<CategoricalColumn>(
+                    colHeader, buffer, jc.at("categories").get<std::vector<std::string>>(), unit,
+                    range));
+            }
+        } else {
+            columns.push_back(dispatching::singleDispatch<std::shared_ptr<Column>,
+                                                          dispatching::filter::All>(
+                format->getId(), [&]<typename T>() -> std::shared_ptr<Column> {
+                    return std::make_shared<TemplateColumn<T>>(
+                        colHeader, createBuffer<T>(file, dataStart + offset, rows), unit, range);
+                }));
+        }
+    }
+
+    return std::make_shared<DataFrame>(std::move(columns));
+}
+
+}  // namespace
+
+BinaryDataFrameReader::BinaryDataFrameReader() {
+    addExtension(FileExtension("ivdf", "Inviwo binary columnar DataFrame"));
+}
+
+BinaryDataFrameReader* BinaryDataFrameReader::clone() const {
+    return new BinaryDataFrameReader(*this);
+}
+
+std::shared_ptr<DataFrame> BinaryDataFrameReader::readData(const std::filesystem::path& fileName) {
+    const auto localPath = downloadAndCacheIfUrl(fileName);
+    checkExists(localPath);
+
+    auto file = MemoryMappedFile::open(localPath);
+    const auto bytes = file->bytes();
+
+    const auto readU64 = [&](size_t pos) {
+        std::uint64_t value = 0;
+        std::memcpy(&value, bytes.data() + pos, sizeof(value));
+        return value;
+    };
+
+    constexpr size_t preambleSize = 24;
+    if (bytes.size() < preambleSize ||
+        std::string_view{reinterpret_cast<const char*>(bytes.data()), 8} != "ivwdataf") {
+        throw DataReaderException(SourceContext{}, "Not a binary DataFrame file: {}", fileName);
+    }
+    if (const auto version = readU64(8); version != 1) {
+        throw DataReaderException(SourceContext{}, "Unsupported binary DataFrame version {} in {}",
+                                  version, fileName);
+    }
+    const auto headerSize = readU64(16);
+    if (headerSize > bytes.size() - preambleSize) {
+        throw DataReaderException(SourceContext{}, "Truncated binary DataFrame header: {}",
+                                  fileName);
+    }
+
+    try {
+        const auto header = json::parse(
+            std::string_view{reinterpret_cast<const char*>(bytes.data()) + preambleSize,
+                             static_cast<size_t>(headerSize)});
+        return createDataFrame(header, file, aligned(preambleSize + headerSize), fileName);
+    } catch (const json::exception& e) {
+        throw DataReaderException(SourceContext{}, "Invalid binary DataFrame header in {}: {}",
+                                  fileName, e.what());
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,183 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframewriter.h>
+
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/fileextension.h>
+#include <inviwo/core/util/sourcecontext.h>
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <modules/json/json.h>
+
+#include <fmt/std.h>
+
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t alignment = 64;
+constexpr size_t aligned(size_t size) { return (size + alignment - 1) / alignment * alignment; }
+
+std::string_view columnTypeToString(ColumnType type) {
+    switch (type) {
+        case ColumnType::Index:
+            return "index";
+        case ColumnType::Categorical:
+            return "categorical";
+        case ColumnType::Ordinal:
+        default:
+            return "ordinal";
+    }
+}
+
+}  // namespace
+
+BinaryDataFrameWriter::BinaryDataFrameWriter() {
+    addExtension(FileExtension("ivdf", "Inviwo binary columnar DataFrame"));
+}
+
+BinaryDataFrameWriter* BinaryDataFrameWriter::clone() const {
+    return new BinaryDataFrameWriter(*this);
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data,
+                                      const std::filesystem::path& filePath) const {
+    checkOverwrite(filePath);
+
+    // Data frames read from the target file may still reference it through a memory mapping.
+    // Truncating the file would pull the data out from under them, instead write a new file next
+    // to it and replace the target when done.
+    auto tmpPath = filePath;
+    tmpPath += ".tmp";
+    try {
+        std::ofstream f{tmpPath, std::ios_base::out | std::ios_base::binary};
+        if (!f) {
+            throw DataWriterException(SourceContext{}, "Could not open file {}", tmpPath);
+        }
+        writeData(data, f);
+        f.close();
+        if (!f) {
+            throw DataWriterException(SourceContext{}, "Failed to write DataFrame to {}", tmpPath);
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, filePath, ec);
+        if (ec) {
+            // Windows can not rename over a file that is open elsewhere, copy the content instead.
+            // A memory mapped file can not be truncated there, so that fails rather than
+            // corrupting a mapping.
+            std::filesystem::copy_file(tmpPath, filePath,
+                                       std::filesystem::copy_options::overwrite_existing);
+            std::filesystem::remove(tmpPath, ec);
+        }
+    } catch (const std::filesystem::filesystem_error& e) {
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
+        throw DataWriterException(SourceContext{}, "Could not replace {}: {}", filePath,
+                                  e.what());
+    } catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
+        throw;
+    }
+}
+
+std::unique_ptr<std::vector<unsigned char>> BinaryDataFrameWriter::writeDataToBuffer(
+    const DataFrame* data, std::string_view) const {
+    std::stringstream ss;
+    writeData(data, ss);
+    auto stringData = std::move(ss).str();
+    return std::make_unique<std::vector<unsigned char>>(stringData.begin(), stringData.end());
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data, std::ostream& os) const {
+    if (!data) return;
+
+    std::vector<const BufferRAM*> blocks;
+    json columns = json::array();
+    size_t offset = 0;
+    for (const auto& col : *data) {
+        const auto* ram = col->getBuffer()->getRepresentation<BufferRAM>();
+        const auto size = ram->getSize() * ram->getSizeOfElement();
+
+        json jc = {{"header", col->getHeader()},
+                   {"type", columnTypeToString(col->getColumnType())},
+                   {"format", ram->getDataFormat()->getString()},
+                   {"unit", units::to_string(col->getUnit())},
+                   {"offset", offset},
+                   {"size", size}};
+        if (auto range = col->getCustomRange()) {
+            jc["range"] = {range->x, range->y};
+        }
+        if (col->getColumnType() == ColumnType::Categorical) {
+            jc["categories"] = static_cast<const CategoricalColumn&>(*col).getCategories();
+        }
+        columns.push_back(std::move(jc));
+        blocks.push_back(ram);
+        offset = aligned(offset + size);
+    }
+
+    const auto* byteOrder = std::endian::native == std::endian::little ? "little" : "big";
+    const json header = {
+        {"rows", data->getNumberOfRows()}, {"byteOrder", byteOrder}, {"columns", columns}};
+    const auto headerStr = header.dump();
+
+    const std::uint64_t version = 1;
+    const std::uint64_t headerSize = headerStr.size();
+    os.write("ivwdataf", 8);
+    os.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    os.write(reinterpret_cast<const char*>(&headerSize), sizeof(headerSize));
+    os.write(headerStr.data(), headerStr.size());
+
+    const std::vector<char> padding(alignment, 0);
+    auto pad = [&](size_t size) {
+        os.write(padding.data(), static_cast<std::streamsize>(aligned(size) - size));
+    };
+    pad(24 + headerStr.size());
+    for (const auto* ram : blocks) {
+        const auto size = ram->getSize() * ram->getSizeOfElement();
+        os.write(static_cast<const char*>(ram->getData()), static_cast<std::streamsize>(size));
+        pad(size);
+    }
+    if (!os) {
+        throw DataWriterException(SourceContext{}, "Failed to write DataFrame");
+    }
+}
+
+}  // namespace inviwo
@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/io/datareader.h>
 #include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/memorymappedfile.h>
 #include <inviwo/core/util/detected.h>
 #include <inviwo/core/util/fileextension.h>
 #include <inviwo/core/util/filesystem.h>
@@ -44,6 +45,7 @@
 #include <inviwo/core/util/sourcecontext.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/zip.h>
 #include <inviwo/dataframe/datastructures/column.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>
@@ -56,6 +58,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <optional>
@@ -241,17 +244,21 @@ std::any CSVReader::getOption(std::string_view key) {
 }
 
 std::shared_ptr<DataFrame> CSVReader::readData(const std::filesystem::path& fileName) {
-    auto file = openAndCacheIfUrl(fileName);
+    const auto localPath = downloadAndCacheIfUrl(fileName);
+    checkExists(localPath);
 
-    file.seekg(0, std::ios::end);
-    std::streampos len = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    if (len == std::streampos(0)) {
+    if (std::filesystem::file_size(localPath) == 0) {
         throw DataReaderException(SourceContext{}, "Emtpy file: {}", fileName);
     }
 
-    return readData(file);
+    // Parse the mapped file in place, pages are loaded as they are parsed and the content is never
+    // copied into memory as a whole.
+    const MemoryMappedFile file{localPath};
+    std::string_view content{reinterpret_cast<const char*>(file.data()), file.size()};
+    if (content.starts_with("\xEF\xBB\xBF")) {
+        content.remove_prefix(3);
+    }
+    return readContent(content);
 }
 
 namespace util {
@@ -427,18 +434,212 @@ std::string_view stripQuotes(std::string_view str) {
     return str;
 };
 
+/**
+ * Find the end of the row starting at @p pos, i.e. the first newline that is not quoted.
+ * @return the position of the newline or npos if the row continues to the end of @p str
+ */
+size_t findRowEnd(std::string_view str, size_t pos) {
+    bool quoted = false;
+    while (true) {
+        pos = str.find_first_of("\"\n", pos);
+        if (pos == std::string_view::npos) {
+            return pos;
+        } else if (str[pos] == '"') {
+            quoted = !quoted;
+            ++pos;
+        } else if (quoted) {
+            ++pos;
+        } else {
+            return pos;
+        }
+    }
+}
+
+/**
+ * Call @p func(row, lineNumber, next) for each trimmed row in @p str where @p next is the position
+ * of the following row. @p lineNumber counts newlines, starting at @p firstLine for the first row.
+ * Iteration stops if @p func returns false.
+ */
+template <typename Func>
+void forEachRow(std::string_view str, size_t firstLine, Func&& func) {
+    size_t line = firstLine;
+    for (size_t pos = 0; pos < str.size();) {
+        const auto end = findRowEnd(str, pos);
+        const auto row = str.substr(pos, end == std::string_view::npos ? end : end - pos);
+        const auto next = end == std::string_view::npos ? str.size() : end + 1;
+        if (!std::invoke(func, util::trim(row), line, next)) return;
+        line += 1 + static_cast<size_t>(std::ranges::count(row, '\n'));
+        pos = next;
+    }
+}
+
 }  // namespace util
 
-std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
-    size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
-    size_t sampleRows) const {
+namespace {
+
+constexpr size_t minChunkSize = size_t{1} << 20;
+
+/**
+ * Run @p func(i) for i in [0, count) on the thread pool, or on the calling thread if there is no
+ * pool. Waits for all tasks before rethrowing the first exception.
+ */
+template <typename Func>
+void parallelFor(size_t count, Func&& func) {
+    if (util::getPoolSize() == 0 || count <= 1) {
+        for (size_t i = 0; i < count; ++i) func(i);
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        futures.push_back(util::dispatchPool([&func, i]() { func(i); }));
+    }
+    // help out if called from within the pool, to not dead lock on a busy pool.
+    auto& pool = util::getThreadPool();
+    for (auto& f : futures) pool.wait(f);
+    for (auto& f : futures) f.get();
+}
+
+struct Chunk {
+    std::string_view data;
+    size_t firstLine;
+};
+
+/**
+ * Split @p data into about @p count chunks at row boundaries. The quotes and newlines of evenly
+ * sized segments are counted in parallel, each boundary is then moved forward to the next newline
+ * that is not inside quotes.
+ */
+std::vector<Chunk> splitIntoChunks(std::string_view data, size_t firstLine, size_t count) {
+    if (count <= 1) return {Chunk{data, firstLine}};
+
+    struct Counts {
+        size_t quotes = 0;
+        size_t newlines = 0;
+    };
+    std::vector<Counts> counts(count);
+    parallelFor(count, [&](size_t i) {
+        const auto segment = data.substr(i * data.size() / count,
+                                         (i + 1) * data.size() / count - i * data.size() / count);
+        for (const char c : segment) {
+            counts[i].quotes += c == '"';
+            counts[i].newlines += c == '\n';
+        }
+    });
+
+    std::vector<Chunk> chunks;
+    size_t begin = 0;
+    size_t beginLine = firstLine;
+    Counts before;
+    for (size_t i = 1; i < count; ++i) {
+        before.quotes += counts[i - 1].quotes;
+        before.newlines += counts[i - 1].newlines;
+
+        size_t pos = i * data.size() / count;
+        if (pos < begin) continue;
+
+        bool quoted = before.quotes % 2 == 1;
+        size_t line = firstLine + before.newlines;
+        for (; pos < data.size(); ++pos) {
+            if (data[pos] == '"') {
+                quoted = !quoted;
+            } else if (data[pos] == '\n') {
+                ++line;
+                if (!quoted) break;
+            }
+        }
+        if (pos >= data.size()) break;
+
+        chunks.push_back(Chunk{data.substr(begin, pos + 1 - begin), beginLine});
+        begin = pos + 1;
+        beginLine = line;
+    }
+    chunks.push_back(Chunk{data.substr(begin), beginLine});
+    return chunks;
+}
+
+using Cells = std::variant<std::vector<std::uint32_t>, std::vector<int>, std::vector<float>,
+                           std::vector<double>, std::vector<std::string_view>>;
+
+template <typename T>
+void appendCell(std::vector<T>& data, std::string_view str, size_t line, size_t col,
+                CSVReader::EmptyField emptyField, [[maybe_unused]] bool stripQuotes,
+                bool cLocale) {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        data.push_back(stripQuotes ? util::stripQuotes(str) : str);
+    } else if (str.empty()) {
+        switch (emptyField) {
+            case CSVReader::EmptyField::Throw:
+                throw DataReaderException(SourceContext{}, "Empty field on line {}, column {}",
+                                          line, col);
+            case CSVReader::EmptyField::NanOrZero:
+                if constexpr (std::is_floating_point_v<T>) {
+                    data.push_back(std::numeric_limits<T>::quiet_NaN());
+                } else {
+                    data.emplace_back();
+                }
+                break;
+            case CSVReader::EmptyField::EmptyOrZero:
+                data.emplace_back();
+                break;
+            default:
+                data.emplace_back();
+                break;
+        }
+    } else if (auto val = util::toNumber<T>(str, cLocale)) {
+        data.push_back(*val);
+    } else {
+        throw DataReaderException(SourceContext{}, "Invalid format on line {}, column {}", line,
+                                  col);
+    }
+}
+
+template <typename T>
+std::function<void(std::vector<Cells>&)> concatenate(std::vector<T>& data) {
+    return [&data](std::vector<Cells>& parts) {
+        std::vector<size_t> offsets{0};
+        for (auto& part : parts) {
+            offsets.push_back(offsets.back() + std::get<std::vector<T>>(part).size());
+        }
+        data.resize(offsets.back());
+        parallelFor(parts.size(), [&](size_t i) {
+            auto& part = std::get<std::vector<T>>(parts[i]);
+            std::ranges::copy(part, data.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+            part = std::vector<T>{};
+        });
+    };
+}
+
+template <typename T>
+std::vector<T>& dataContainer(TemplateColumn<T>& col) {
+    return col.getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer();
+}
+
+}  // namespace
+
+/**
+ * The parsed type of a column and how to move the parsed cells of all chunks into the DataFrame.
+ */
+struct CSVReader::ColumnTarget {
+    Cells empty;
+    EmptyField emptyField;
+    bool stripQuotes;
+    std::function<void(std::vector<Cells>&)> concatenate;
+};
+
+std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(size_t nCol, std::string_view data,
+                                                            size_t firstLine,
+                                                            size_t sampleRows) const {
     size_t sampledRows = sampleRows;
     std::vector<TypeCounts> counts(nCol);
 
     const bool cLocale = locale_ == "C";
 
-    for (auto [i, row] : util::enumerate(rows)) {
-        util::parse(row.first, delimiters_, nCol, row.second,
+    size_t i = 0;
+    util::forEachRow(data, firstLine, [&](std::string_view row, size_t lineNumber, size_t) {
+        if (skipRow(row, lineNumber, true)) return true;
+
+        util::parse(row, delimiters_, nCol, lineNumber,
                     [&](std::string_view cell, size_t index, [[maybe_unused]] size_t part) {
                         if (cell.empty()) {
                             // Ignore empty cells.
@@ -451,16 +652,17 @@ std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
                             ++counts[index].string;
                         }
                     });
-        if (i > sampledRows) {
+        if (i++ > sampledRows) {
             if (std::any_of(counts.begin(), counts.end(), [](const TypeCounts& type) {
                     return type.integer == 0 && type.real == 0 && type.string == 0;
                 })) {
                 sampledRows *= 2;
             } else {
-                break;
+                return false;
             }
         }
-    }
+        return true;
+    });
     if (sampledRows != sampleRows) {
         log::warn(
             "Could not find any data for some columns, sampled more rows to determine column "
@@ -471,64 +673,32 @@ std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
     return counts;
 }
 
-template <typename T, bool index = false>
-std::function<void(std::string_view, size_t, size_t)> addColumn(DataFrame& df,
-                                                                std::string_view header, Unit unit,
-                                                                CSVReader::EmptyField emptyField,
-                                                                bool cLocale) {
-    auto& data = [&]() -> decltype(auto) {
-        if constexpr (index && std::is_same_v<T, std::uint32_t>) {
-            df.getIndexColumn()->setHeader(header);
-            df.getIndexColumn()->setUnit(unit);
-            return df.getIndexColumn()
-                ->getTypedBuffer()
-                ->getEditableRAMRepresentation()
-                ->getDataContainer();
-        } else {
-            return df.addColumn<T>(header, 0, unit)
-                ->getTypedBuffer()
-                ->getEditableRAMRepresentation()
-                ->getDataContainer();
-        }
-    }();
-    return [&data, cLocale, emptyField](std::string_view str, size_t line, size_t col) {
-        if (str.empty()) {
-            switch (emptyField) {
-                case CSVReader::EmptyField::Throw:
-                    throw DataReaderException(SourceContext{}, "Empty field on line {}, column {}",
-                                              line, col);
-                case CSVReader::EmptyField::NanOrZero:
-                    if constexpr (std::is_floating_point_v<T>) {
-                        data.push_back(std::numeric_limits<T>::quiet_NaN());
-                    } else {
-                        data.emplace_back();
-                    }
-                    break;
-                case CSVReader::EmptyField::EmptyOrZero:
-                    data.emplace_back();
-                    break;
-                default:
-                    data.emplace_back();
-                    break;
-            }
-        } else if (auto val = util::toNumber<T>(str, cLocale)) {
-            data.push_back(*val);
-        } else {
-            throw DataReaderException(SourceContext{}, "Invalid format on line {}, column {}", line,
-                                      col);
-        }
-    };
-}
-
-std::vector<std::function<void(std::string_view, size_t, size_t)>> CSVReader::addColumns(
+std::vector<CSVReader::ColumnTarget> CSVReader::addColumns(
     DataFrame& df, const std::vector<TypeCounts>& typeCounts,
     const std::vector<std::string>& headers) const {
 
-    const bool cLocale = locale_ == "C";
     std::regex re{unitRegexp_};
     std::smatch m;
 
-    std::vector<std::function<void(std::string_view, size_t, size_t)>> appenders;
+    const auto categorical = [&](const std::string& header) {
+        auto col = df.addCategoricalColumn(header);
+        return ColumnTarget{std::vector<std::string_view>{}, emptyField_, stripQuotes_,
+                            [col](std::vector<Cells>& parts) {
+                                auto add = col->addMany();
+                                for (auto& part : parts) {
+                                    for (auto str : std::get<std::vector<std::string_view>>(part)) {
+                                        add(str);
+                                    }
+                                    part = std::vector<std::string_view>{};
+                                }
+                            }};
+    };
+    const auto numerical = [&]<typename T>(const std::string& header, Unit unit) {
+        auto& data = dataContainer(*df.addColumn<T>(header, 0, unit));
+        return ColumnTarget{std::vector<T>{}, emptyField_, false, concatenate(data)};
+    };
+
+    std::vector<ColumnTarget> targets;
     for (auto&& [counts, header] : util::zip(typeCounts, headers)) {
         auto headerCopy = header;
         Unit unit{};
@@ -541,39 +711,32 @@ std::vector<std::function<void(std::string_view, size_t, size_t)>> CSVReader::ad
         }
 
         if (counts.index) {
-            appenders.push_back(addColumn<std::uint32_t, true>(
-                df, headerCopy, unit, CSVReader::EmptyField::Throw, cLocale));
-        } else if (stripQuotes_ && counts.string > 0) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back([f = col->addMany()](std::string_view str, size_t, size_t) {
-                f(util::stripQuotes(str));
-            });
+            auto indexCol = df.getIndexColumn();
+            indexCol->setHeader(headerCopy);
+            indexCol->setUnit(unit);
+            targets.push_back(ColumnTarget{std::vector<std::uint32_t>{}, EmptyField::Throw, false,
+                                           concatenate(dataContainer(*indexCol))});
         } else if (counts.string > 0) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back(
-                [f = col->addMany()](std::string_view str, size_t, size_t) { f(str); });
+            targets.push_back(categorical(header));
         } else if (doublePrecision_ && counts.real > 0) {
-            appenders.push_back(addColumn<double>(df, headerCopy, unit, emptyField_, cLocale));
+            targets.push_back(numerical.template operator()<double>(headerCopy, unit));
         } else if (!doublePrecision_ && counts.real > 0) {
-            appenders.push_back(addColumn<float>(df, headerCopy, unit, emptyField_, cLocale));
+            targets.push_back(numerical.template operator()<float>(headerCopy, unit));
         } else if (counts.integer > 0) {
-            appenders.push_back(addColumn<int>(df, headerCopy, unit, emptyField_, cLocale));
-        } else if (stripQuotes_) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back([f = col->addMany()](std::string_view str, size_t, size_t) {
-                f(util::stripQuotes(str));
-            });
+            targets.push_back(numerical.template operator()<int>(headerCopy, unit));
         } else {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back(
-                [f = col->addMany()](std::string_view str, size_t, size_t) { f(str); });
+            targets.push_back(categorical(header));
         }
     }
 
-    return appenders;
+    return targets;
 }
 
 bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHeader) const {
+    if (filters_.includeRows.empty() && filters_.excludeRows.empty() &&
+        filters_.includeItems.empty() && filters_.excludeItems.empty()) {
+        return false;
+    }
 
     auto filterRow = [&](bool neutralValue) {
         return [&, neutral = neutralValue](const auto& f) {
@@ -642,6 +805,12 @@ bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHe
 std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
     filesystem::skipByteOrderMark(stream);
 
+    const std::string content{std::istreambuf_iterator<char>(stream),
+                              std::istreambuf_iterator<char>()};
+    return readContent(content);
+}
+
+std::shared_ptr<DataFrame> CSVReader::readContent(std::string_view content) const {
     util::OnScopeExit cleanup{nullptr};
     if (!config::charconv || locale_ != "C") {
         // We need to use the C locale here to force use of decimal "."
@@ -653,44 +822,54 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
         cleanup.setAction([prev]() { std::setlocale(LC_ALL, prev.c_str()); });
     }
 
-    std::string content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
     std::string_view trimmed{content};
     if (auto pos = trimmed.find_last_not_of(" \f\n\r\t\v"); pos != std::string_view::npos) {
         trimmed = trimmed.substr(0, pos + 1);
+    } else {
+        trimmed = {};
     }
 
-    std::vector<std::pair<std::string_view, size_t>> rows;
-    util::parse(trimmed, "\n", std::nullopt, std::nullopt,
-                [&](std::string_view line, [[maybe_unused]] size_t index, size_t lineNumber) {
-                    if (!skipRow(line, lineNumber, true)) {
-                        rows.emplace_back(line, lineNumber);
-                    }
-                });
+    // find the first row, it holds the headers or the first row of data
+    std::optional<std::pair<std::string_view, size_t>> firstRow;
+    size_t dataBegin = 0;
+    size_t dataLine = 1;
+    util::forEachRow(trimmed, 1, [&](std::string_view row, size_t lineNumber, size_t next) {
+        if (skipRow(row, lineNumber, true)) return true;
+        firstRow.emplace(row, lineNumber);
+        if (firstRowHeader_) {
+            dataBegin = next;
+            dataLine = lineNumber + 1 + static_cast<size_t>(std::ranges::count(row, '\n'));
+        } else {
+            dataBegin = static_cast<size_t>(row.data() - trimmed.data());
+            dataLine = lineNumber;
+        }
+        return false;
+    });
 
-    if (rows.empty()) {
+    if (!firstRow) {
         throw DataReaderException("No data");
     }
 
     // extract first row
     std::vector<std::string> headers;
-    util::parse(rows.front().first, delimiters_, std::nullopt, rows.front().second,
+    util::parse(firstRow->first, delimiters_, std::nullopt, firstRow->second,
                 [&](std::string_view cell, [[maybe_unused]] size_t index,
                     [[maybe_unused]] size_t partNumber) {
                     headers.emplace_back(stripQuotes_ ? util::stripQuotes(cell) : cell);
                     return true;
                 });
 
-    if (firstRowHeader_) {
-        rows.erase(rows.begin());
-    } else {
+    if (!firstRowHeader_) {
         for (auto&& [i, header] : util::enumerate(headers)) {
             header = fmt::format("Column {}", i + 1);
         }
     }
 
+    const auto data = trimmed.substr(dataBegin);
+
     // Construct Data Frame
     auto df = std::make_shared<DataFrame>();
-    auto types = findCellTypes(headers.size(), rows, exampleRows_);
+    auto types = findCellTypes(headers.size(), data, dataLine, exampleRows_);
     if (firstColIndices_) {
         if (!types.empty() && types.front().string == 0 && types.front().real == 0) {
             types.front().index = true;
@@ -698,16 +877,48 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
             throw Exception("Unable to use first column as index, invalid data found");
         }
     }
-    const auto appenders = addColumns(*df, types, headers);
-
-    for (const auto& [row, lineNumber] : rows) {
-        if (!skipRow(row, lineNumber, false)) {
-            util::parse(row, delimiters_, headers.size(), lineNumber,
-                        [&, l = lineNumber](std::string_view cell, size_t index,
-                                            [[maybe_unused]] size_t part) {
-                            appenders[index](cell, l, index + 1);
-                        });
+    const auto targets = addColumns(*df, types, headers);
+
+    // Parse the chunks in parallel into typed buffers, and move them into the columns afterwards
+    const auto poolSize = util::getPoolSize();
+    const auto chunks = splitIntoChunks(
+        data, dataLine,
+        poolSize == 0 ? 1 : std::clamp(data.size() / minChunkSize, size_t{1}, 4 * poolSize));
+
+    const bool cLocale = locale_ == "C";
+    std::vector<std::vector<Cells>> parsed(targets.size(), std::vector<Cells>(chunks.size()));
+    parallelFor(chunks.size(), [&](size_t chunk) {
+        std::vector<Cells> cells;
+        cells.reserve(targets.size());
+        for (const auto& target : targets) cells.push_back(target.empty);
+
+        util::forEachRow(chunks[chunk].data, chunks[chunk].firstLine,
+                         [&](std::string_view row, size_t lineNumber, size_t) {
+                             if (skipRow(row, lineNumber, true) ||
+                                 skipRow(row, lineNumber, false)) {
+                                 return true;
+                             }
+                             util::parse(row, delimiters_, headers.size(), lineNumber,
+                                         [&](std::string_view cell, size_t index, size_t) {
+                                             const auto& target = targets[index];
+                                             std::visit(
+                                                 [&](auto& column) {
+                                                     appendCell(column, cell, lineNumber,
+                                                                index + 1, target.emptyField,
+                                                                target.stripQuotes, cLocale);
+                                                 },
+                                                 cells[index]);
+                                         });
+                             return true;
+                         });
+
+        for (size_t col = 0; col < targets.size(); ++col) {
+            parsed[col][chunk] = std::move(cells[col]);
         }
+    });
+
+    for (auto&& [target, parts] : util::zip(targets, parsed)) {
+        target.concatenate(parts);
     }
 
     if (!firstColIndices_) {
@@ -0,0 +1,118 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/io/csvreader.h>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace inviwo;
+
+namespace {
+
+/**
+ * A CSV file with an integer, two floating point and a categorical column of about @p bytes
+ */
+std::string makeCSV(size_t bytes) {
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<> intDist(0, 100000);
+    std::uniform_real_distribution<> realDist(-1000.0, 1000.0);
+    constexpr std::array<std::string_view, 4> categories{"alpha", "beta", "\"gamma, delta\"",
+                                                         "epsilon"};
+
+    std::string csv = "Index,X [m],Y [m],Category\n";
+    csv.reserve(bytes + 64);
+    while (csv.size() < bytes) {
+        fmt::format_to(std::back_inserter(csv), "{},{:.6f},{:.6f},{}\n", intDist(gen),
+                       realDist(gen), realDist(gen), categories[intDist(gen) % categories.size()]);
+    }
+    return csv;
+}
+
+constexpr size_t dataSize = size_t{64} << 20;
+
+void ReadStream(benchmark::State& state) {
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(0)));
+    const auto csv = makeCSV(dataSize);
+    const CSVReader reader;
+    for (auto _ : state) {
+        std::istringstream stream{csv};
+        auto df = reader.readData(stream);
+        benchmark::DoNotOptimize(df);
+    }
+    state.SetBytesProcessed(state.iterations() * csv.size());
+}
+
+void ReadFile(benchmark::State& state) {
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(0)));
+    const auto csv = makeCSV(dataSize);
+    const auto file = std::filesystem::temp_directory_path() / "inviwo-bm-csvreader.csv";
+    {
+        std::ofstream out{file, std::ios::binary};
+        out.write(csv.data(), static_cast<std::streamsize>(csv.size()));
+    }
+    CSVReader reader;
+    for (auto _ : state) {
+        auto df = reader.readData(file);
+        benchmark::DoNotOptimize(df);
+    }
+    state.SetBytesProcessed(state.iterations() * csv.size());
+    std::filesystem::remove(file);
+}
+
+}  // namespace
+
+BENCHMARK(ReadStream)->Arg(0)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(ReadFile)->Arg(0)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-CSVReader");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
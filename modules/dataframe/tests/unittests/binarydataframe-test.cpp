@@ -0,0 +1,186 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/buffer/bufferdisk.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/io/binarydataframereader.h>
+#include <inviwo/dataframe/io/binarydataframewriter.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+TEST(BinaryDataFrame, roundTrip) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+
+    DataFrame src;
+    src.addColumn<float>("x", std::vector<float>{1.0f, 2.5f, -3.0f}, units::unit_from_string("m"),
+                         dvec2{-5.0, 5.0});
+    src.addColumn<int>("count", std::vector<int>{7, 8, 9});
+    src.addCategoricalColumn("species", std::vector<std::string>{"setosa", "virginica", "setosa"});
+    src.updateIndexBuffer();
+
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(&src, tmpFile.getFileName());
+
+    BinaryDataFrameReader reader;
+    auto dst = reader.readData(tmpFile.getFileName());
+
+    ASSERT_EQ(src.getNumberOfColumns(), dst->getNumberOfColumns());
+    ASSERT_EQ(src.getNumberOfRows(), dst->getNumberOfRows());
+
+    // columns are only loaded from the file once they are accessed
+    EXPECT_TRUE(dst->getColumn("x")->getBuffer()->hasRepresentation<BufferDisk>());
+    EXPECT_FALSE(dst->getColumn("x")->getBuffer()->hasRepresentation<BufferRAM>());
+
+    for (size_t i = 0; i < src.getNumberOfColumns(); ++i) {
+        auto a = src.getColumn(i);
+        auto b = dst->getColumn(i);
+        EXPECT_EQ(a->getHeader(), b->getHeader());
+        EXPECT_EQ(a->getColumnType(), b->getColumnType());
+        EXPECT_EQ(a->getUnit(), b->getUnit());
+        EXPECT_EQ(a->getCustomRange(), b->getCustomRange());
+        EXPECT_TRUE(*a->getBuffer() == *b->getBuffer()) << a->getHeader();
+    }
+
+    auto species = std::dynamic_pointer_cast<CategoricalColumn>(dst->getColumn("species"));
+    ASSERT_TRUE(species);
+    EXPECT_EQ("virginica", species->get(1));
+    EXPECT_EQ(src.getColumn("species")->getAsString(2), species->getAsString(2));
+}
+
+TEST(BinaryDataFrame, overwriteMappedFile) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+
+    DataFrame first;
+    first.addColumn<int>("count", std::vector<int>{7, 8, 9});
+    DataFrame second;
+    second.addColumn<int>("count", std::vector<int>{1});
+
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(&first, tmpFile.getFileName());
+
+    BinaryDataFrameReader reader;
+    auto dst = reader.readData(tmpFile.getFileName());
+    ASSERT_FALSE(dst->getColumn("count")->getBuffer()->hasRepresentation<BufferRAM>());
+
+    // the lazily loaded columns still reference the old file content
+#ifdef WIN32
+    // Windows might refuse to replace a file that is memory mapped
+    try {
+        writer.writeData(&second, tmpFile.getFileName());
+    } catch (const DataWriterException&) {
+    }
+#else
+    writer.writeData(&second, tmpFile.getFileName());
+    EXPECT_EQ(size_t{1}, reader.readData(tmpFile.getFileName())->getNumberOfRows());
+#endif
+    EXPECT_TRUE(*first.getColumn("count")->getBuffer() == *dst->getColumn("count")->getBuffer());
+}
+
+TEST(BinaryDataFrame, invalidFile) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+    std::fputs("not a dataframe, just some text", tmpFile);
+    std::fflush(tmpFile);
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+TEST(BinaryDataFrame, corruptHeader) {
+    // Write a file with the given header size and header, followed by one block of data
+    const auto writeFile = [](const std::filesystem::path& path, std::uint64_t headerSize,
+                              std::string_view header) {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        const std::uint64_t version = 1;
+        file.write("ivwdataf", 8);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        file.write(reinterpret_cast<const char*>(&headerSize), sizeof(headerSize));
+        file.write(header.data(), header.size());
+        file << std::string(128, '\0');
+    };
+    const auto column = [](std::string_view format, std::string_view rows,
+                           std::string_view offset, std::string_view size) {
+        const auto* byteOrder = std::endian::native == std::endian::little ? "little" : "big";
+        return fmt::format(
+            R"({{"rows": {}, "byteOrder": "{}", "columns": [{{"header": "x", "type": "ordinal",)"
+            R"( "format": "{}", "offset": {}, "size": {}}}]}})",
+            rows, byteOrder, format, offset, size);
+    };
+
+    util::TempFileHandle tmpFile("", ".ivdf");
+    BinaryDataFrameReader reader;
+
+    const auto valid = column("INT32", "4", "0", "16");
+    writeFile(tmpFile.getFileName(), valid.size(), valid);
+    EXPECT_EQ(size_t{4}, reader.readData(tmpFile.getFileName())->getNumberOfRows());
+
+    // header size past the end of the file, also when the bounds check would overflow
+    writeFile(tmpFile.getFileName(), valid.size() + 1000, valid);
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+    writeFile(tmpFile.getFileName(), std::numeric_limits<std::uint64_t>::max() - 8, valid);
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+
+    // rows * 4 wraps around to the given size of 0
+    const auto wrappedRows = column("INT32", "4611686018427387904", "0", "0");
+    writeFile(tmpFile.getFileName(), wrappedRows.size(), wrappedRows);
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+
+    // offset + size wraps around
+    const auto wrappedOffset = column("INT32", "4", "18446744073709551608", "16");
+    writeFile(tmpFile.getFileName(), wrappedOffset.size(), wrappedOffset);
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+
+    const auto unknownFormat = column("NOTAFORMAT", "4", "0", "16");
+    writeFile(tmpFile.getFileName(), unknownFormat.size(), unknownFormat);
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+}  // namespace inviwo
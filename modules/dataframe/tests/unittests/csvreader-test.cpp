@@ -55,6 +55,24 @@ TEST(CSVnoData, file) {
     EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
 }
 
+TEST(CSVdata, file) {
+    util::TempFileHandle tmpFile("", ".csv");
+    const std::string_view content =
+        "\xef\xbb\xbf" "A,B,C\n1,\"multi\nline\",2.5\n2,b,3.5\r\n3,\"c\",4.5\n";
+    std::fwrite(content.data(), content.size(), 1, tmpFile);
+    std::fflush(tmpFile);
+
+    CSVReader reader;
+    auto dataframe = reader.readData(tmpFile.getFileName());
+
+    ASSERT_EQ(4, dataframe->getNumberOfColumns()) << "column count does not match";
+    ASSERT_EQ(3, dataframe->getNumberOfRows()) << "row count does not match";
+    EXPECT_EQ("A", dataframe->getColumn(1)->getHeader());
+    EXPECT_EQ("multi\nline", dataframe->getColumn(2)->getAsString(0));
+    EXPECT_EQ("c", dataframe->getColumn(2)->getAsString(2));
+    EXPECT_EQ("4.5", dataframe->getColumn(3)->getAsString(2));
+}
+
 TEST(CSVdata, numRows) {
     // test for correct row count
     std::istringstream ss("1\n2\n3\n4\n\5\n6");
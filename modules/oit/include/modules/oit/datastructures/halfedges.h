@@ -33,13 +33,14 @@
 
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/datastructures/geometry/mesh.h>
-#include <inviwo/core/util/iterrange.h>
-#include <inviwo/core/util/transformiterator.h>
 
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <optional>
-#include <unordered_map>
+#include <ranges>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace inviwo {
@@ -77,6 +78,12 @@ public:
      */
     HalfEdges(const Mesh& mesh);
 
+    /**
+     * @brief Construct from a list of triangles, three vertex indices per triangle.
+     * The twins are found using meshutil::findHalfEdgeTwins.
+     */
+    explicit HalfEdges(std::span<const std::uint32_t> triangles);
+
     /**
      * @brief Creates a index buffer for triangles with connectivity 'None'
      */
@@ -133,6 +140,16 @@ public:
     auto faces() const;
     auto vertices() const;
 
+    /**
+     * @brief Number of edges with only one half edge, i.e. edges without a twin
+     */
+    std::size_t boundaryEdges() const { return boundaryEdges_; }
+    /**
+     * @brief Number of edges shared by more than two half edges or by two half edges in the same
+     * direction
+     */
+    std::size_t nonManifoldEdges() const { return nonManifoldEdges_; }
+
 private:
     friend EdgeIter;
 
@@ -164,39 +181,42 @@ private:
         std::optional<std::uint32_t> twin = std::nullopt;
     };
 
+    static constexpr std::uint32_t noEdge = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Half edges, the edges of face f are stored at 3 * f, 3 * f + 1, and 3 * f + 2
+     */
     std::vector<HalfEdge> edges_;
-    std::unordered_map<std::uint32_t, std::uint32_t> vertexToEdge_;
-    std::unordered_map<std::uint32_t, std::uint32_t> faceToEdge_;
+    /**
+     * @brief The first half edge starting in each vertex, noEdge for unused vertex indices
+     */
+    std::vector<std::uint32_t> vertexToEdge_;
+    std::size_t boundaryEdges_ = 0;
+    std::size_t nonManifoldEdges_ = 0;
 };
 
 inline auto HalfEdges::faceToEdge(std::uint32_t faceIndex) const -> EdgeIter {
-    return {this, faceToEdge_.at(faceIndex)};
+    if (std::size_t{faceIndex} * 3 >= edges_.size()) {
+        throw std::out_of_range("HalfEdges: face index out of range");
+    }
+    return {this, faceIndex * 3};
 }
 
 inline auto HalfEdges::vertexToEdge(std::uint32_t vertexIndex) const -> EdgeIter {
-    return {this, vertexToEdge_.at(vertexIndex)};
+    if (vertexIndex >= vertexToEdge_.size() || vertexToEdge_[vertexIndex] == noEdge) {
+        throw std::out_of_range("HalfEdges: vertex index out of range");
+    }
+    return {this, vertexToEdge_[vertexIndex]};
 }
 
 inline auto HalfEdges::faces() const {
-    const auto transform =
-        [this](
-            const std::unordered_map<std::uint32_t, std::uint32_t>::value_type& item) -> EdgeIter {
-        return {this, item.second};
-    };
-
-    return util::as_range(util::makeTransformIterator(transform, faceToEdge_.begin()),
-                          util::makeTransformIterator(transform, faceToEdge_.end()));
+    return std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(edges_.size() / 3)) |
+           std::views::transform([this](std::uint32_t face) { return EdgeIter{this, face * 3}; });
 }
 
 inline auto HalfEdges::vertices() const {
-    const auto transform =
-        [this](
-            const std::unordered_map<std::uint32_t, std::uint32_t>::value_type& item) -> EdgeIter {
-        return {this, item.second};
-    };
-
-    return util::as_range(util::makeTransformIterator(transform, vertexToEdge_.begin()),
-                          util::makeTransformIterator(transform, vertexToEdge_.end()));
+    return vertexToEdge_ | std::views::filter([](std::uint32_t edge) { return edge != noEdge; }) |
+           std::views::transform([this](std::uint32_t edge) { return EdgeIter{this, edge}; });
 }
 
 inline std::uint32_t HalfEdges::EdgeIter::vertex() const {
@@ -34,92 +34,70 @@
 #include <inviwo/core/datastructures/geometry/geometrytype.h>
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/util/assertion.h>
-#include <inviwo/core/util/iterrange.h>
-#include <inviwo/core/util/transformiterator.h>
+#include <modules/base/algorithm/mesh/halfedgetwins.h>
 #include <modules/base/algorithm/meshutils.h>
 
-#include <map>
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <utility>
 
 namespace inviwo {
 
-HalfEdges::HalfEdges(Mesh::MeshInfo info, const IndexBuffer& indexBuffer) {
-    // map to fill in the opposite direction
-    // (start_vertex, end_vertex) -> edge_index
-    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
+namespace {
 
-    std::uint32_t face = 0;
+void appendTriangles(Mesh::MeshInfo info, const IndexBuffer& indexBuffer,
+                     std::vector<std::uint32_t>& triangles) {
     meshutil::forEachTriangle(info, indexBuffer,
                               [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
-                                  // a-b, b-c, c-a
-                                  const auto count = static_cast<std::uint32_t>(edges_.size());
-                                  edges_.push_back(HalfEdge{a, face, count + 1, count + 2});
-                                  edgeMap.try_emplace({a, b}, count + 0);
-                                  vertexToEdge_.try_emplace(a, count + 0);
-
-                                  edges_.push_back(HalfEdge{b, face, count + 2, count + 0});
-                                  edgeMap.try_emplace({b, c}, count + 1);
-                                  vertexToEdge_.try_emplace(b, count + 1);
-
-                                  edges_.push_back(HalfEdge{c, face, count + 0, count + 1});
-                                  edgeMap.try_emplace({c, a}, count + 2);
-                                  vertexToEdge_.try_emplace(c, count + 2);
-
-                                  faceToEdge_.try_emplace(face, count);
-
-                                  ++face;
+                                  triangles.insert(triangles.end(), {a, b, c});
                               });
+}
 
-    for (auto& edge : edges_) {
-        const auto a = edge.vertex;
-        const auto b = edges_[edge.next].vertex;
+std::vector<std::uint32_t> gatherTriangles(Mesh::MeshInfo info, const IndexBuffer& indexBuffer) {
+    std::vector<std::uint32_t> triangles;
+    appendTriangles(info, indexBuffer, triangles);
+    return triangles;
+}
 
-        auto it = edgeMap.find(std::pair{b, a});
-        if (it != edgeMap.end()) {
-            edge.twin = it->second;
-        }
+std::vector<std::uint32_t> gatherTriangles(const Mesh& mesh) {
+    std::vector<std::uint32_t> triangles;
+    for (auto [info, indexBuffer] : mesh.getIndexBuffers()) {
+        if (info.dt != DrawType::Triangles) continue;
+        appendTriangles(info, *indexBuffer, triangles);
     }
+    return triangles;
 }
 
-HalfEdges::HalfEdges(const Mesh& mesh) {
+}  // namespace
 
-    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
-    std::uint32_t face = 0;
+HalfEdges::HalfEdges(Mesh::MeshInfo info, const IndexBuffer& indexBuffer)
+    : HalfEdges(gatherTriangles(info, indexBuffer)) {}
 
-    for (auto [info, indexBuffer] : mesh.getIndexBuffers()) {
-        if (info.dt != DrawType::Triangles) continue;
-        meshutil::forEachTriangle(info, *indexBuffer,
-                                  [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
-                                      // a-b, b-c, c-a
-                                      const auto count = static_cast<std::uint32_t>(edges_.size());
-                                      edges_.push_back(HalfEdge{a, face, count + 1, count + 2});
-                                      edgeMap.try_emplace({a, b}, count + 0);
-                                      vertexToEdge_.try_emplace(a, count + 0);
-
-                                      edges_.push_back(HalfEdge{b, face, count + 2, count + 0});
-                                      edgeMap.try_emplace({b, c}, count + 1);
-                                      vertexToEdge_.try_emplace(b, count + 1);
-
-                                      edges_.push_back(HalfEdge{c, face, count + 0, count + 1});
-                                      edgeMap.try_emplace({c, a}, count + 2);
-                                      vertexToEdge_.try_emplace(c, count + 2);
-
-                                      faceToEdge_.try_emplace(face, count);
-
-                                      ++face;
-                                  });
-    }
+HalfEdges::HalfEdges(const Mesh& mesh) : HalfEdges(gatherTriangles(mesh)) {}
 
-    for (auto& edge : edges_) {
-        const auto a = edge.vertex;
-        const auto b = edges_[edge.next].vertex;
+HalfEdges::HalfEdges(std::span<const std::uint32_t> triangles) {
+    const auto twins = meshutil::findHalfEdgeTwins(triangles);
+    boundaryEdges_ = twins.boundaryEdges;
+    nonManifoldEdges_ = twins.nonManifoldEdges;
 
-        auto it = edgeMap.find(std::pair{b, a});
-        if (it != edgeMap.end()) {
-            edge.twin = it->second;
-        }
+    if (!triangles.empty()) {
+        vertexToEdge_.assign(std::size_t{std::ranges::max(triangles)} + 1, noEdge);
+    }
+
+    // a-b, b-c, c-a
+    edges_.reserve(triangles.size());
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(triangles.size()); ++i) {
+        const auto first = i - i % 3;
+        const auto twin = twins.twins[i] != meshutil::HalfEdgeTwins::noTwin
+                              ? std::optional<std::uint32_t>{twins.twins[i]}
+                              : std::nullopt;
+        edges_.push_back(HalfEdge{.vertex = triangles[i],
+                                  .face = i / 3,
+                                  .next = first + (i + 1) % 3,
+                                  .prev = first + (i + 2) % 3,
+                                  .twin = twin});
+        if (vertexToEdge_[triangles[i]] == noEdge) vertexToEdge_[triangles[i]] = i;
     }
 }
 
@@ -114,6 +114,8 @@ TEST(HalfEdges, plane) {
     EXPECT_EQ(std::distance(edges.faces().begin(), edges.faces().end()), 2 * width * height);
     EXPECT_EQ(std::distance(edges.vertices().begin(), edges.vertices().end()),
               (width + 1) * (height + 1));
+    EXPECT_EQ(edges.boundaryEdges(), 2 * (width + height));
+    EXPECT_EQ(edges.nonManifoldEdges(), 0);
 
     // First face
     const auto e0 = edges.faceToEdge(0);
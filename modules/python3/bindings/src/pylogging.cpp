@@ -38,6 +38,7 @@
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/consolelogger.h>
 #include <inviwo/core/util/filelogger.h>
+#include <inviwo/core/util/tracerecorder.h>
 #include <inviwo/core/processors/processor.h>
 
 #include <modules/python3/opaquetypes.h>
@@ -122,6 +123,19 @@ void exposeLogging(pybind11::module& m) {
         .def(py::init<std::string>())
         .def("log", &FileLogger::log);
 
+    py::classh<TraceRecorder>(m, "TraceRecorder")
+        .def_property_static(
+            "enabled", [](py::object) { return TraceRecorder::isEnabled(); },
+            [](py::object, bool enabled) { TraceRecorder::setEnabled(enabled); })
+        .def_property_static(
+            "capacity", [](py::object) { return TraceRecorder::getCapacity(); },
+            [](py::object, size_t capacity) { TraceRecorder::setCapacity(capacity); })
+        .def_static("clear", &TraceRecorder::clear)
+        .def_static(
+            "writeChromeTrace",
+            [](const std::filesystem::path& path) { TraceRecorder::writeChromeTrace(path); },
+            py::arg("path"));
+
     m.def(
         "log",
         [](std::string_view source, LogLevel level, LogAudience audience, std::string_view file,
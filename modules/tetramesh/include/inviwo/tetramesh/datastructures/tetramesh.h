@@ -37,6 +37,10 @@
 
 #include <fmt/format.h>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace inviwo {
 
 /**
@@ -86,6 +90,28 @@ public:
      * @return scalar value range
      */
     virtual dvec2 getDataRange() const = 0;
+
+    /**
+     * Return the opposing faces of each tetrahedron, see utiltetra::getOpposingFaces. They are
+     * computed on first use and cached, copies of the mesh share the cache until invalidated.
+     *
+     * @return opposing faces where a negative index indicates a boundary face
+     */
+    std::shared_ptr<const std::vector<ivec4>> getOpposingFaces() const;
+
+protected:
+    /**
+     * Discard cached data that depends on the tetrahedra. Derived classes have to call this
+     * whenever the node ids returned by get() change.
+     */
+    void invalidateTopology();
+
+private:
+    struct TopologyCache {
+        std::mutex mutex;
+        std::shared_ptr<const std::vector<ivec4>> opposingFaces;
+    };
+    std::shared_ptr<TopologyCache> topology_ = std::make_shared<TopologyCache>();
 };
 
 template <>
@@ -0,0 +1,95 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tetramesh/tetrameshmoduledefine.h>
+
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+
+class TetraMesh;
+
+/**
+ * Point location in a tetrahedral mesh. Finds the tetrahedron containing a position given in data
+ * space along with its barycentric coordinates.
+ *
+ * Each thread remembers the last tetrahedron it found. A query first walks from there towards the
+ * position across the opposing faces of the mesh, see TetraMesh::getOpposingFaces, which is cheap
+ * for positions close to each other like the steps along an integral line. If the walk does not
+ * reach the position, for example due to holes in the mesh, the tetrahedra overlapping the
+ * position are looked up in a uniform grid.
+ *
+ * The locator is thread safe and holds copies of the nodes and tetrahedra of the mesh.
+ */
+class IVW_MODULE_TETRAMESH_API TetraMeshLocator {
+public:
+    struct Location {
+        int tetra;
+        /**
+         * Barycentric coordinates with respect to the four nodes of the tetrahedron
+         */
+        dvec4 barycentric;
+    };
+
+    explicit TetraMeshLocator(const TetraMesh& mesh);
+
+    /**
+     * Find the tetrahedron containing \p pos, given in data space
+     * @return the location or std::nullopt if \p pos is outside of the mesh
+     */
+    std::optional<Location> locate(const dvec3& pos) const;
+
+    const std::vector<ivec4>& getNodeIds() const { return nodeIds_; }
+    std::size_t getNumberOfNodes() const { return nodes_.size(); }
+
+private:
+    std::optional<dvec4> barycentric(int tetra, const dvec3& pos) const;
+    std::optional<Location> walk(int tetra, const dvec3& pos) const;
+    std::optional<Location> search(const dvec3& pos) const;
+    size3_t cell(const dvec3& pos) const;
+
+    std::vector<vec3> nodes_;
+    std::vector<ivec4> nodeIds_;
+    std::shared_ptr<const std::vector<ivec4>> opposingFaces_;
+
+    dvec3 gridMin_{0.0};
+    dvec3 gridMax_{0.0};
+    dvec3 cellScale_{0.0};
+    size3_t gridDims_{0};
+    std::vector<std::size_t> cellOffsets_;
+    std::vector<int> cellTetras_;
+};
+
+}  // namespace inviwo
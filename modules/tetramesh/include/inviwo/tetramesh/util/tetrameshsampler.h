@@ -0,0 +1,139 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tetramesh/tetrameshmoduledefine.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
+#include <inviwo/tetramesh/util/tetrameshlocator.h>
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/spatialsampler.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * @brief A SpatialSampler for tetrahedral meshes
+ *
+ * Samples values given per node of a TetraMesh by locating the tetrahedron containing the position,
+ * see TetraMeshLocator, and interpolating the values of its four nodes barycentrically. Positions
+ * outside of the mesh return zero. The sampler is thread safe, consecutive samples close to each
+ * other on the same thread are cheap, which makes it suitable for tracing integral lines.
+ *
+ * @see utiltetra::getNodeGradients
+ */
+template <typename ReturnType = dvec3>
+class TetraMeshSampler : public SpatialSampler<ReturnType> {
+public:
+    /**
+     * @param mesh         the tetrahedral mesh
+     * @param nodeValues   one value per node of \p mesh
+     * @param space        coordinate space of the sample positions
+     * @throws Exception if the number of values does not match the number of nodes
+     */
+    TetraMeshSampler(std::shared_ptr<const TetraMesh> mesh, std::vector<ReturnType> nodeValues,
+                     CoordinateSpace space = CoordinateSpace::Data);
+    virtual ~TetraMeshSampler() = default;
+
+protected:
+    virtual ReturnType sampleDataSpace(const dvec3& pos) const override;
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+
+    /**
+     * Locate \p pos, reusing the result of the previous query on this thread if it was for the
+     * same position. The tracers check withinBounds before sampling each position, this way a
+     * sample only does the point location once.
+     */
+    std::optional<TetraMeshLocator::Location> locate(const dvec3& pos) const;
+
+    std::shared_ptr<const TetraMesh> mesh_;
+    TetraMeshLocator locator_;
+    std::vector<ReturnType> values_;
+    // Identifies the sampler in the per thread cache, an address could be reused
+    std::uint64_t id_;
+
+    static inline std::atomic<std::uint64_t> nextId_{1};
+};
+
+template <typename ReturnType>
+TetraMeshSampler<ReturnType>::TetraMeshSampler(std::shared_ptr<const TetraMesh> mesh,
+                                               std::vector<ReturnType> nodeValues,
+                                               CoordinateSpace space)
+    : SpatialSampler<ReturnType>(*mesh, space)
+    , mesh_{std::move(mesh)}
+    , locator_{*mesh_}
+    , values_{std::move(nodeValues)}
+    , id_{nextId_.fetch_add(1, std::memory_order_relaxed)} {
+    if (values_.size() != locator_.getNumberOfNodes()) {
+        throw Exception(SourceContext{}, "Expected one value per node ({}), got {} values",
+                        locator_.getNumberOfNodes(), values_.size());
+    }
+}
+
+template <typename ReturnType>
+auto TetraMeshSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> ReturnType {
+    const auto location = locate(pos);
+    if (!location) {
+        return ReturnType(0.0);
+    }
+    const auto& ids = locator_.getNodeIds()[location->tetra];
+    ReturnType result(0.0);
+    for (int i = 0; i < 4; ++i) {
+        result += values_[ids[i]] * location->barycentric[i];
+    }
+    return result;
+}
+
+template <typename ReturnType>
+bool TetraMeshSampler<ReturnType>::withinBoundsDataSpace(const dvec3& pos) const {
+    return locate(pos).has_value();
+}
+
+template <typename ReturnType>
+auto TetraMeshSampler<ReturnType>::locate(const dvec3& pos) const
+    -> std::optional<TetraMeshLocator::Location> {
+    struct LastQuery {
+        std::uint64_t sampler = 0;
+        dvec3 pos{0.0};
+        std::optional<TetraMeshLocator::Location> location;
+    };
+    thread_local LastQuery last;
+
+    if (last.sampler != id_ || last.pos != pos) {
+        last = {id_, pos, locator_.locate(pos)};
+    }
+    return last.location;
+}
+
+}  // namespace inviwo
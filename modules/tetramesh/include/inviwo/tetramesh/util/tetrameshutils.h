@@ -47,10 +47,14 @@ namespace utiltetra {
  * Determine the opposing faces of each tetradhedron by identifying faces with shared nodes.
  * The four face IDs of a single tetrahedron are stored in an ivec4. The order matches the vertex
  * IDs in \p nodeIds so that the corresponding node is the apex of the face.
+ * The faces are bucketed by their smallest node and matched within each bucket in parallel. A face
+ * shared by more than two tetrahedra is matched pairwise in tetrahedron order.
+ * Prefer TetraMesh::getOpposingFaces which caches the result.
  *
  * @param nodeIds        contains four node IDs for each tetrahedron
  * @return opposing faces where a negative index indicates a boundary face, that is no neighboring
  *         tetrahedron
+ * @throws Exception if a node ID is negative
  */
 IVW_MODULE_TETRAMESH_API std::vector<ivec4> getOpposingFaces(const std::vector<ivec4>& nodeIds);
 
@@ -91,6 +95,18 @@ IVW_MODULE_TETRAMESH_API std::shared_ptr<Mesh> createBoundaryMesh(
  */
 IVW_MODULE_TETRAMESH_API std::shared_ptr<Mesh> createBoundaryMesh(const TetraMesh& mesh);
 
+/**
+ * Compute the gradient of the scalar field given by the w component of \p nodes at each node. The
+ * gradient is constant within each tetrahedron for linear interpolation, the gradient at a node is
+ * the volume weighted average of the gradients of the tetrahedra sharing the node.
+ *
+ * @param nodes     vertex positions of the tetrahedra along with the scalar values
+ * @param nodeIds   contains four node IDs for each tetrahedron
+ * @return gradient per node in data space, zero for nodes not used by any tetrahedron
+ */
+IVW_MODULE_TETRAMESH_API std::vector<dvec3> getNodeGradients(const std::vector<vec4>& nodes,
+                                                             const std::vector<ivec4>& nodeIds);
+
 /**
  * Check and fix the face orientations of the tetrahedral mesh. Afterward, the faces of each
  * tetrahedra are facing outward, that is the vertices of each triangle are ordered counter-clock
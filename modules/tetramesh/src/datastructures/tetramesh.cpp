@@ -28,5 +28,23 @@
  *********************************************************************************/
 
 #include <inviwo/tetramesh/datastructures/tetramesh.h>
+#include <inviwo/tetramesh/util/tetrameshutils.h>
 
-namespace inviwo {}  // namespace inviwo
+namespace inviwo {
+
+std::shared_ptr<const std::vector<ivec4>> TetraMesh::getOpposingFaces() const {
+    const auto topology = topology_;
+    const std::scoped_lock lock{topology->mutex};
+    if (!topology->opposingFaces) {
+        std::vector<vec4> nodes;
+        std::vector<ivec4> nodeIds;
+        get(nodes, nodeIds);
+        topology->opposingFaces =
+            std::make_shared<const std::vector<ivec4>>(utiltetra::getOpposingFaces(nodeIds));
+    }
+    return topology->opposingFaces;
+}
+
+void TetraMesh::invalidateTopology() { topology_ = std::make_shared<TopologyCache>(); }
+
+}  // namespace inviwo
@@ -82,6 +82,7 @@ void VolumeTetraMesh::setData(const std::shared_ptr<const Volume>& volume, int c
 
     volume_ = volume;
     channel_ = channel;
+    invalidateTopology();
     setModelMatrix(tetraBoundingBox(*volume_));
     setWorldMatrix(dmat4(1.0));
 }
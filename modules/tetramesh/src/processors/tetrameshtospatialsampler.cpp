@@ -0,0 +1,70 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/processors/tetrameshtospatialsampler.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
+#include <inviwo/tetramesh/util/tetrameshsampler.h>
+#include <inviwo/tetramesh/util/tetrameshutils.h>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo TetraMeshToSpatialSampler::processorInfo_{
+    "org.inviwo.TetraMeshToSpatialSampler",  // Class identifier
+    "TetraMesh To Spatial Sampler",          // Display name
+    "Unstructured Grids",                    // Category
+    CodeState::Experimental,                 // Code state
+    Tags::CPU | Tag{"Unstructured"},         // Tags
+    R"(Creates a spatial sampler of the gradient of the scalar field of a tetrahedral mesh,
+    for example for tracing integral lines directly on the mesh. The gradient is computed per node
+    and interpolated barycentrically within each tetrahedron.)"_unindentHelp};
+
+const ProcessorInfo& TetraMeshToSpatialSampler::getProcessorInfo() const { return processorInfo_; }
+
+TetraMeshToSpatialSampler::TetraMeshToSpatialSampler()
+    : Processor{}
+    , inport_{"inport", "Input tetra mesh with scalar values"_help}
+    , sampler_{"sampler",
+               "Sampler of the scalar gradient in data space, zero outside of the mesh"_help} {
+
+    addPorts(inport_, sampler_);
+}
+
+void TetraMeshToSpatialSampler::process() {
+    const auto mesh = inport_.getData();
+
+    std::vector<vec4> nodes;
+    std::vector<ivec4> nodeIds;
+    mesh->get(nodes, nodeIds);
+
+    sampler_.setData(std::make_shared<TetraMeshSampler<dvec3>>(
+        mesh, utiltetra::getNodeGradients(nodes, nodeIds)));
+}
+
+}  // namespace inviwo
@@ -131,11 +131,11 @@ void TetraMeshVolumeRaycaster::process() {
         const auto& tetraMesh = *inport_.getData();
 
         tetraMesh.get(tetraNodes_, tetraNodeIds_);
-        auto opposingFaces = utiltetra::getOpposingFaces(tetraNodeIds_);
+        const auto opposingFaces = tetraMesh.getOpposingFaces();
 
-        buffers_->upload(tetraNodes_, tetraNodeIds_, opposingFaces);
+        buffers_->upload(tetraNodes_, tetraNodeIds_, *opposingFaces);
         mesh_ = utiltetra::createBoundaryMesh(tetraMesh, tetraNodes_, tetraNodeIds_,
-                                              utiltetra::getBoundaryFaces(opposingFaces));
+                                              utiltetra::getBoundaryFaces(*opposingFaces));
     }
 
     {
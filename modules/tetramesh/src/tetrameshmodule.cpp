@@ -33,6 +33,7 @@
 #include <inviwo/tetramesh/processors/tetrameshboundingbox.h>
 #include <inviwo/tetramesh/processors/tetrameshvolumeraycaster.h>
 #include <inviwo/tetramesh/processors/tetrameshboundaryextractor.h>
+#include <inviwo/tetramesh/processors/tetrameshtospatialsampler.h>
 #include <inviwo/tetramesh/processors/transformtetramesh.h>
 #include <inviwo/tetramesh/processors/volumetotetramesh.h>
 
@@ -48,6 +49,7 @@ TetraMeshModule::TetraMeshModule(InviwoApplication* app) : InviwoModule(app, "Te
 
     registerProcessor<TetraMeshBoundaryExtractor>();
     registerProcessor<TetraMeshBoundingBox>();
+    registerProcessor<TetraMeshToSpatialSampler>();
     registerProcessor<TetraMeshVolumeRaycaster>();
     registerProcessor<TransformTetraMesh>();
     registerProcessor<VolumeToTetraMesh>();
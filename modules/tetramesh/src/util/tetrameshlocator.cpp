@@ -0,0 +1,246 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/util/tetrameshlocator.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
+
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <glm/geometric.hpp>
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <ranges>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::size_t minChunkSize = 1 << 16;
+// Tolerance of the barycentric coordinates for positions on a face, edge, or node
+constexpr double baryEpsilon = 1e-9;
+// Maximum number of tetrahedra visited when walking from the last location
+constexpr int maxWalkSteps = 64;
+// Aim for about this many tetrahedra per grid cell
+constexpr double tetrasPerCell = 2.0;
+constexpr std::size_t maxGridDim = 1024;
+
+size3_t gridDimensions(const dvec3& extent, std::size_t nTetras) {
+    const auto cells = std::max(1.0, static_cast<double>(nTetras) / tetrasPerCell);
+    // Axes thinner than a cell get a single cell, distribute the cells over the remaining ones
+    double cellSize = 0.0;
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        double size = 1.0;
+        int axes = 0;
+        for (int i = 0; i < 3; ++i) {
+            if (extent[i] > cellSize) {
+                size *= extent[i];
+                ++axes;
+            }
+        }
+        if (axes == 0) break;
+        cellSize = std::pow(size / cells, 1.0 / axes);
+    }
+    if (!(cellSize > 0.0)) return size3_t{1};
+
+    return glm::clamp(size3_t{glm::ceil(extent / cellSize)}, size3_t{1}, size3_t{maxGridDim});
+}
+
+}  // namespace
+
+TetraMeshLocator::TetraMeshLocator(const TetraMesh& mesh)
+    : opposingFaces_{mesh.getOpposingFaces()} {
+    std::vector<vec4> nodes;
+    mesh.get(nodes, nodeIds_);
+    nodes_.reserve(nodes.size());
+    std::ranges::transform(nodes, std::back_inserter(nodes_),
+                           [](const vec4& node) { return vec3{node}; });
+    if (nodes_.empty() || nodeIds_.empty()) return;
+
+    gridMin_ = dvec3{nodes_.front()};
+    gridMax_ = gridMin_;
+    for (const auto& node : nodes_) {
+        gridMin_ = glm::min(gridMin_, dvec3{node});
+        gridMax_ = glm::max(gridMax_, dvec3{node});
+    }
+    const auto extent = gridMax_ - gridMin_;
+    gridDims_ = gridDimensions(extent, nodeIds_.size());
+    cellScale_ = glm::mix(dvec3{gridDims_} / extent, dvec3{0.0},
+                          glm::lessThanEqual(extent, dvec3{0.0}));
+
+    // Bin each tetrahedron into all cells overlapped by its bounding box with a counting sort
+    const auto nCells = glm::compMul(gridDims_);
+    const auto cellIndex = [&](const size3_t& c) {
+        return c.x + gridDims_.x * (c.y + gridDims_.y * c.z);
+    };
+    const auto forEachCell = [&](std::size_t tetra, auto&& f) {
+        const auto& ids = nodeIds_[tetra];
+        dvec3 lo{nodes_[ids[0]]};
+        dvec3 hi{lo};
+        for (int i = 1; i < 4; ++i) {
+            lo = glm::min(lo, dvec3{nodes_[ids[i]]});
+            hi = glm::max(hi, dvec3{nodes_[ids[i]]});
+        }
+        const auto first = cell(lo);
+        const auto last = cell(hi);
+        for (auto z = first.z; z <= last.z; ++z) {
+            for (auto y = first.y; y <= last.y; ++y) {
+                for (auto x = first.x; x <= last.x; ++x) {
+                    f(cellIndex(size3_t{x, y, z}));
+                }
+            }
+        }
+    };
+
+    std::vector<std::atomic<std::size_t>> cursor(nCells);
+    util::forEachChunk(
+        nodeIds_.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto tetra = begin; tetra < end; ++tetra) {
+                forEachCell(tetra, [&](std::size_t c) {
+                    cursor[c].fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        },
+        minChunkSize);
+    cellOffsets_.assign(nCells + 1, 0);
+    for (std::size_t c = 0; c < nCells; ++c) {
+        cellOffsets_[c + 1] = cellOffsets_[c] + cursor[c].load(std::memory_order_relaxed);
+        cursor[c].store(cellOffsets_[c], std::memory_order_relaxed);
+    }
+    cellTetras_.resize(cellOffsets_.back());
+    util::forEachChunk(
+        nodeIds_.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto tetra = begin; tetra < end; ++tetra) {
+                forEachCell(tetra, [&](std::size_t c) {
+                    cellTetras_[cursor[c].fetch_add(1, std::memory_order_relaxed)] =
+                        static_cast<int>(tetra);
+                });
+            }
+        },
+        minChunkSize);
+    // Sort the cells to make the search independent of the scheduling
+    util::forEachChunk(
+        nCells,
+        [&](std::size_t begin, std::size_t end) {
+            for (auto c = begin; c < end; ++c) {
+                std::sort(cellTetras_.begin() + cellOffsets_[c],
+                          cellTetras_.begin() + cellOffsets_[c + 1]);
+            }
+        },
+        minChunkSize);
+}
+
+std::optional<TetraMeshLocator::Location> TetraMeshLocator::locate(const dvec3& pos) const {
+    struct LastLocation {
+        const TetraMeshLocator* locator = nullptr;
+        int tetra = -1;
+    };
+    thread_local LastLocation last;
+
+    // The last location is only a starting point, a stale entry is harmless as long as it is valid
+    if (last.locator == this && last.tetra >= 0 &&
+        last.tetra < static_cast<int>(nodeIds_.size())) {
+        if (auto location = walk(last.tetra, pos)) {
+            last.tetra = location->tetra;
+            return location;
+        }
+    }
+    if (auto location = search(pos)) {
+        last = {this, location->tetra};
+        return location;
+    }
+    return std::nullopt;
+}
+
+std::optional<dvec4> TetraMeshLocator::barycentric(int tetra, const dvec3& pos) const {
+    const auto& ids = nodeIds_[tetra];
+    const dvec3 p0{nodes_[ids[0]]};
+    const auto e1 = dvec3{nodes_[ids[1]]} - p0;
+    const auto e2 = dvec3{nodes_[ids[2]]} - p0;
+    const auto e3 = dvec3{nodes_[ids[3]]} - p0;
+    const auto d = pos - p0;
+
+    const auto det = glm::dot(e1, glm::cross(e2, e3));
+    if (det == 0.0) return std::nullopt;
+
+    const auto l1 = glm::dot(d, glm::cross(e2, e3)) / det;
+    const auto l2 = glm::dot(e1, glm::cross(d, e3)) / det;
+    const auto l3 = glm::dot(e1, glm::cross(e2, d)) / det;
+    return dvec4{1.0 - l1 - l2 - l3, l1, l2, l3};
+}
+
+std::optional<TetraMeshLocator::Location> TetraMeshLocator::walk(int tetra,
+                                                                 const dvec3& pos) const {
+    for (int step = 0; step < maxWalkSteps; ++step) {
+        const auto bary = barycentric(tetra, pos);
+        if (!bary) return std::nullopt;
+
+        // Cross the face opposite of the node with the most negative coordinate
+        int face = 0;
+        for (int i = 1; i < 4; ++i) {
+            if ((*bary)[i] < (*bary)[face]) face = i;
+        }
+        if ((*bary)[face] >= -baryEpsilon) return Location{tetra, *bary};
+
+        const auto next = (*opposingFaces_)[tetra][face];
+        if (next < 0) return std::nullopt;
+        tetra = next / 4;
+    }
+    return std::nullopt;
+}
+
+std::optional<TetraMeshLocator::Location> TetraMeshLocator::search(const dvec3& pos) const {
+    if (cellTetras_.empty() || glm::any(glm::lessThan(pos, gridMin_)) ||
+        glm::any(glm::greaterThan(pos, gridMax_))) {
+        return std::nullopt;
+    }
+    const auto c = cell(pos);
+    const auto index = c.x + gridDims_.x * (c.y + gridDims_.y * c.z);
+    for (auto i = cellOffsets_[index]; i < cellOffsets_[index + 1]; ++i) {
+        const auto tetra = cellTetras_[i];
+        if (const auto bary = barycentric(tetra, pos);
+            bary && glm::compMin(*bary) >= -baryEpsilon) {
+            return Location{tetra, *bary};
+        }
+    }
+    return std::nullopt;
+}
+
+size3_t TetraMeshLocator::cell(const dvec3& pos) const {
+    const auto c = glm::max((pos - gridMin_) * cellScale_, dvec3{0.0});
+    return glm::min(size3_t{c}, gridDims_ - size3_t{1});
+}
+
+}  // namespace inviwo
@@ -32,13 +32,22 @@
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/zip.h>
 
+#include <glm/gtx/component_wise.hpp>
 #include <glm/gtx/transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
+#include <glm/matrix.hpp>
 
 #include <algorithm>
-#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <ranges>
 
 namespace inviwo {
 
@@ -46,61 +55,114 @@ namespace utiltetra {
 
 namespace detail {
 
-struct TriangleKey {
-    TriangleKey(const ivec3& indices) : tri{indices} {
-        std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
-    }
-    TriangleKey(int a, int b, int c) : tri{a, b, c} {
-        std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
-    }
+int globalFaceId(int tetra, int face) { return tetra * 4 + face; }
 
-    bool operator==(const TriangleKey& rhs) const { return tri == rhs.tri; }
+/**
+ * A half face stored in the bucket of its smallest node. The two other nodes identify the face
+ * within the bucket.
+ */
+struct BucketFace {
+    int mid;
+    int max;
+    int faceId;
 
-    ivec3 tri;
+    auto operator<=>(const BucketFace&) const = default;
 };
 
-struct TriangleHash {
-    size_t operator()(const TriangleKey& key) const {
-        size_t seed = 0;
-        inviwo::util::hash_combine(seed, key.tri[0]);
-        inviwo::util::hash_combine(seed, key.tri[1]);
-        inviwo::util::hash_combine(seed, key.tri[2]);
-        return seed;
-    }
-};
+constexpr std::size_t minChunkSize = 1 << 16;
 
-int globalFaceId(int tetra, int face) { return tetra * 4 + face; }
+/**
+ * Call \p f with the global face id and the sorted node ids of each half face of \p tetra.
+ */
+template <typename F>
+void forEachFace(const ivec4& tetra, int tetraId, F&& f) {
+    for (int face = 0; face < 4; ++face) {
+        // the nodes of the half face opposing node `face`
+        std::array<int, 3> tri{tetra[(face + 1) % 4], tetra[(face + 2) % 4], tetra[(face + 3) % 4]};
+        if (tri[0] > tri[1]) std::swap(tri[0], tri[1]);
+        if (tri[1] > tri[2]) std::swap(tri[1], tri[2]);
+        if (tri[0] > tri[1]) std::swap(tri[0], tri[1]);
+        f(globalFaceId(tetraId, face), tri);
+    }
+}
 
 }  // namespace detail
 
 std::vector<ivec4> getOpposingFaces(const std::vector<ivec4>& nodeIds) {
-    using TetraId = int;
-    using FaceId = int;
-
-    std::unordered_map<detail::TriangleKey, std::pair<TetraId, FaceId>, detail::TriangleHash>
-        adjacency;
+    if (nodeIds.size() > static_cast<std::size_t>(std::numeric_limits<int>::max() / 4)) {
+        throw Exception(SourceContext{}, "Too many tetrahedra ({}), face ids have to fit in an int",
+                        nodeIds.size());
+    }
     std::vector<ivec4> opposingFaces(nodeIds.size(), ivec4(-1));
+    if (nodeIds.empty()) return opposingFaces;
 
-    for (int tetra = 0; tetra < std::ssize(nodeIds); ++tetra) {
-        for (int face = 0; face < 4; ++face) {
-            // determine indices of half face opposing the current one
-            int nextHf = (face + 1) % 4;
-            int midHf = (face + 2) % 4;
-            int prevHf = (face + 3) % 4;
-
-            detail::TriangleKey tri{nodeIds[tetra][nextHf], nodeIds[tetra][midHf],
-                                    nodeIds[tetra][prevHf]};
-
-            if (auto adjIt = adjacency.find(tri); adjIt != adjacency.end()) {
-                auto&& [opposingTetra, opposingFace] = adjIt->second;
-                opposingFaces[tetra][face] = detail::globalFaceId(opposingTetra, opposingFace);
-                opposingFaces[opposingTetra][opposingFace] = detail::globalFaceId(tetra, face);
-                adjacency.erase(adjIt);
-            } else {
-                adjacency.insert({tri, {tetra, face}});
+    const auto [minNode, maxNode] = std::ranges::minmax(
+        nodeIds | std::views::transform([](const ivec4& ids) { return glm::compMin(ids); }));
+    if (minNode < 0) {
+        throw Exception(SourceContext{}, "Negative node id ({}) in tetrahedra", minNode);
+    }
+    const auto nNodes = static_cast<std::size_t>(maxNode) + 1;
+
+    // Counting sort of the half faces into buckets by their smallest node
+    std::vector<std::atomic<int>> cursor(nNodes);
+    util::forEachChunk(
+        nodeIds.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto tetra = begin; tetra < end; ++tetra) {
+                detail::forEachFace(nodeIds[tetra], static_cast<int>(tetra),
+                                    [&](int, const std::array<int, 3>& tri) {
+                                        cursor[tri[0]].fetch_add(1, std::memory_order_relaxed);
+                                    });
             }
-        }
+        },
+        detail::minChunkSize);
+    std::vector<int> offsets(nNodes + 1, 0);
+    for (std::size_t node = 0; node < nNodes; ++node) {
+        offsets[node + 1] = offsets[node] + cursor[node].load(std::memory_order_relaxed);
+        cursor[node].store(offsets[node], std::memory_order_relaxed);
     }
+
+    std::vector<detail::BucketFace> faces(nodeIds.size() * 4);
+    util::forEachChunk(
+        nodeIds.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (auto tetra = begin; tetra < end; ++tetra) {
+                detail::forEachFace(nodeIds[tetra], static_cast<int>(tetra),
+                                    [&](int faceId, const std::array<int, 3>& tri) {
+                                        const auto pos =
+                                            cursor[tri[0]].fetch_add(1, std::memory_order_relaxed);
+                                        faces[pos] = {tri[1], tri[2], faceId};
+                                    });
+            }
+        },
+        detail::minChunkSize);
+
+    // Sorting each bucket puts the matching half faces next to each other, ordered by face id.
+    // Consecutive half faces are paired which gives the same result as matching the faces in
+    // tetrahedron order. Every face id is written by exactly one bucket.
+    const auto setOpposing = [&](int faceId, int opposingId) {
+        opposingFaces[faceId / 4][faceId % 4] = opposingId;
+    };
+    util::forEachChunk(
+        nNodes,
+        [&](std::size_t begin, std::size_t end) {
+            for (auto node = begin; node < end; ++node) {
+                const auto first = faces.begin() + offsets[node];
+                const auto last = faces.begin() + offsets[node + 1];
+                std::sort(first, last);
+                for (auto it = first; it != last && std::next(it) != last;) {
+                    if (it->mid == std::next(it)->mid && it->max == std::next(it)->max) {
+                        setOpposing(it->faceId, std::next(it)->faceId);
+                        setOpposing(std::next(it)->faceId, it->faceId);
+                        std::advance(it, 2);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+        },
+        detail::minChunkSize);
+
     return opposingFaces;
 }
 
@@ -153,7 +215,34 @@ std::shared_ptr<Mesh> createBoundaryMesh(const TetraMesh& mesh) {
     std::vector<vec4> nodes;
     std::vector<ivec4> nodeIds;
     mesh.get(nodes, nodeIds);
-    return createBoundaryMesh(mesh, nodes, nodeIds, getBoundaryFaces(getOpposingFaces(nodeIds)));
+    return createBoundaryMesh(mesh, nodes, nodeIds, getBoundaryFaces(*mesh.getOpposingFaces()));
+}
+
+std::vector<dvec3> getNodeGradients(const std::vector<vec4>& nodes,
+                                    const std::vector<ivec4>& nodeIds) {
+    std::vector<dvec3> gradients(nodes.size(), dvec3{0.0});
+    std::vector<double> weights(nodes.size(), 0.0);
+
+    for (const auto& ids : nodeIds) {
+        const dvec4 n0{nodes[ids[0]]};
+        const dmat3 edges{dvec3{nodes[ids[1]]} - dvec3{n0}, dvec3{nodes[ids[2]]} - dvec3{n0},
+                          dvec3{nodes[ids[3]]} - dvec3{n0}};
+        const double det = glm::determinant(edges);
+        if (det == 0.0) continue;
+
+        // The gradient g satisfies dot(g, edge_i) = f_i - f_0 for all three edges
+        const dvec3 df{nodes[ids[1]].w - n0.w, nodes[ids[2]].w - n0.w, nodes[ids[3]].w - n0.w};
+        const dvec3 gradient = glm::inverse(glm::transpose(edges)) * df;
+        const double volume = std::abs(det) / 6.0;
+        for (int i = 0; i < 4; ++i) {
+            gradients[ids[i]] += gradient * volume;
+            weights[ids[i]] += volume;
+        }
+    }
+    for (auto&& [gradient, weight] : util::zip(gradients, weights)) {
+        if (weight > 0.0) gradient /= weight;
+    }
+    return gradients;
 }
 
 void fixFaceOrientation(const std::vector<vec4>& nodes, std::vector<ivec4>& nodeIds) {
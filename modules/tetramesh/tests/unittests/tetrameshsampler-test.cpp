@@ -0,0 +1,156 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tetramesh/datastructures/volumetetramesh.h>
+#include <inviwo/tetramesh/util/tetrameshlocator.h>
+#include <inviwo/tetramesh/util/tetrameshsampler.h>
+#include <inviwo/tetramesh/util/tetrameshutils.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * A tetra mesh of the unit cube with the scalar field 2x + 3y - z
+ */
+std::shared_ptr<VolumeTetraMesh> createLinearMesh(size3_t dims) {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto* data = ram->getDataTyped();
+    const util::IndexMapper3D im{dims};
+    const dvec3 max{dims - size3_t{1}};
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const auto p = dvec3{x, y, z} / max;
+                data[im(x, y, z)] = static_cast<float>(2.0 * p.x + 3.0 * p.y - p.z);
+            }
+        }
+    }
+    return std::make_shared<VolumeTetraMesh>(std::make_shared<Volume>(ram));
+}
+
+std::vector<dvec3> nodePositions(const TetraMesh& mesh) {
+    std::vector<vec4> nodes;
+    std::vector<ivec4> nodeIds;
+    mesh.get(nodes, nodeIds);
+    std::vector<dvec3> positions;
+    for (const auto& node : nodes) positions.emplace_back(node);
+    return positions;
+}
+
+}  // namespace
+
+TEST(TetraMeshSampler, LocateWalk) {
+    const auto mesh = createLinearMesh(size3_t{9, 7, 5});
+    const TetraMeshLocator locator{*mesh};
+
+    // Small steps along a line reuse the last location, then jump across the mesh
+    for (int i = 0; i <= 100; ++i) {
+        const dvec3 pos{0.01 + 0.0098 * i, 0.3 + 0.004 * i, 0.9 - 0.008 * i};
+        const auto location = locator.locate(pos);
+        ASSERT_TRUE(location);
+        EXPECT_NEAR(glm::compAdd(location->barycentric), 1.0, 1e-9);
+        EXPECT_GE(glm::compMin(location->barycentric), -1e-9);
+    }
+    EXPECT_TRUE(locator.locate(dvec3{0.01, 0.99, 0.01}));
+    EXPECT_TRUE(locator.locate(dvec3{1.0, 1.0, 1.0}));
+    EXPECT_FALSE(locator.locate(dvec3{1.5, 0.5, 0.5}));
+    EXPECT_FALSE(locator.locate(dvec3{0.5, -0.01, 0.5}));
+}
+
+TEST(TetraMeshSampler, LocateGridSearch) {
+    const auto mesh = createLinearMesh(size3_t{9, 7, 5});
+    const TetraMeshLocator locator{*mesh};
+
+    // The first query on a thread has no last location and goes through the grid search
+    std::mt19937 rand{7};
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    for (int i = 0; i < 64; ++i) {
+        const dvec3 pos{dist(rand), dist(rand), dist(rand)};
+        std::optional<TetraMeshLocator::Location> location;
+        std::thread{[&]() { location = locator.locate(pos); }}.join();
+        ASSERT_TRUE(location) << "pos " << pos.x << ", " << pos.y << ", " << pos.z;
+        EXPECT_NEAR(glm::compAdd(location->barycentric), 1.0, 1e-9);
+        EXPECT_GE(glm::compMin(location->barycentric), -1e-9);
+    }
+}
+
+TEST(TetraMeshSampler, InterpolatesLinearFields) {
+    const auto mesh = createLinearMesh(size3_t{6, 5, 8});
+    const TetraMeshSampler<dvec3> sampler{mesh, nodePositions(*mesh)};
+
+    std::mt19937 rand{42};
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    for (int i = 0; i < 1000; ++i) {
+        const dvec3 pos{dist(rand), dist(rand), dist(rand)};
+        ASSERT_TRUE(sampler.withinBounds(pos));
+        const auto value = sampler.sample(pos);
+        EXPECT_NEAR(value.x, pos.x, 1e-5);
+        EXPECT_NEAR(value.y, pos.y, 1e-5);
+        EXPECT_NEAR(value.z, pos.z, 1e-5);
+    }
+    EXPECT_FALSE(sampler.withinBounds(dvec3{0.5, 0.5, 1.1}));
+    EXPECT_EQ(sampler.sample(dvec3{0.5, 0.5, 1.1}), dvec3{0.0});
+
+    EXPECT_THROW(TetraMeshSampler<double>(mesh, std::vector<double>(3, 0.0)), Exception);
+}
+
+TEST(TetraMeshSampler, NodeGradients) {
+    const auto mesh = createLinearMesh(size3_t{5, 4, 6});
+    std::vector<vec4> nodes;
+    std::vector<ivec4> nodeIds;
+    mesh->get(nodes, nodeIds);
+
+    const auto gradients = utiltetra::getNodeGradients(nodes, nodeIds);
+    ASSERT_EQ(gradients.size(), nodes.size());
+    for (const auto& gradient : gradients) {
+        EXPECT_NEAR(gradient.x, 2.0, 1e-4);
+        EXPECT_NEAR(gradient.y, 3.0, 1e-4);
+        EXPECT_NEAR(gradient.z, -1.0, 1e-4);
+    }
+}
+
+}  // namespace inviwo
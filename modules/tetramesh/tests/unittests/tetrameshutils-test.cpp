@@ -0,0 +1,134 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tetramesh/util/tetrameshutils.h>
+#include <inviwo/tetramesh/datastructures/volumetetramesh.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * Reference implementation, matches the half faces in tetrahedron order
+ */
+std::vector<ivec4> mapOpposingFaces(const std::vector<ivec4>& nodeIds) {
+    std::map<std::array<int, 3>, int> open;
+    std::vector<ivec4> opposingFaces(nodeIds.size(), ivec4(-1));
+    for (int tetra = 0; tetra < static_cast<int>(nodeIds.size()); ++tetra) {
+        for (int face = 0; face < 4; ++face) {
+            std::array<int, 3> tri{nodeIds[tetra][(face + 1) % 4], nodeIds[tetra][(face + 2) % 4],
+                                   nodeIds[tetra][(face + 3) % 4]};
+            std::ranges::sort(tri);
+            if (auto it = open.find(tri); it != open.end()) {
+                opposingFaces[tetra][face] = it->second;
+                opposingFaces[it->second / 4][it->second % 4] = tetra * 4 + face;
+                open.erase(it);
+            } else {
+                open.emplace(tri, tetra * 4 + face);
+            }
+        }
+    }
+    return opposingFaces;
+}
+
+std::shared_ptr<Volume> createVolume(size3_t dims) {
+    return std::make_shared<Volume>(std::make_shared<VolumeRAMPrecision<float>>(dims));
+}
+
+}  // namespace
+
+TEST(TetraMeshUtils, OpposingFacesSingleTetra) {
+    const std::vector<ivec4> nodeIds{{0, 1, 2, 3}};
+    const auto opposing = utiltetra::getOpposingFaces(nodeIds);
+    ASSERT_EQ(opposing.size(), 1);
+    EXPECT_EQ(opposing[0], ivec4(-1));
+    EXPECT_EQ(utiltetra::getBoundaryFaces(opposing), (std::vector<int>{0, 1, 2, 3}));
+
+    EXPECT_TRUE(utiltetra::getOpposingFaces({}).empty());
+    EXPECT_THROW(utiltetra::getOpposingFaces({ivec4{0, 1, 2, -1}}), Exception);
+}
+
+TEST(TetraMeshUtils, OpposingFacesNonManifold) {
+    // Three tetrahedra sharing the face 0-1-2, the first two are paired
+    const std::vector<ivec4> nodeIds{{0, 1, 2, 3}, {2, 1, 0, 4}, {5, 0, 1, 2}};
+    const auto opposing = utiltetra::getOpposingFaces(nodeIds);
+    EXPECT_EQ(opposing, mapOpposingFaces(nodeIds));
+    EXPECT_EQ(opposing[0][3], 4 + 3);
+    EXPECT_EQ(opposing[1][3], 3);
+    EXPECT_EQ(opposing[2][0], -1);
+}
+
+TEST(TetraMeshUtils, OpposingFacesGrid) {
+    const size3_t dims{12, 9, 7};
+    const VolumeTetraMesh mesh{createVolume(dims)};
+    std::vector<vec4> nodes;
+    std::vector<ivec4> nodeIds;
+    mesh.get(nodes, nodeIds);
+
+    const auto opposing = utiltetra::getOpposingFaces(nodeIds);
+    EXPECT_EQ(opposing, mapOpposingFaces(nodeIds));
+
+    const size3_t cells = dims - size3_t{1};
+    const auto boundary = 4 * (cells.x * cells.y + cells.y * cells.z + cells.x * cells.z);
+    EXPECT_EQ(utiltetra::getBoundaryFaces(opposing).size(), boundary);
+}
+
+TEST(TetraMeshUtils, OpposingFacesCache) {
+    VolumeTetraMesh mesh{createVolume(size3_t{4, 4, 4})};
+
+    const auto opposing = mesh.getOpposingFaces();
+    ASSERT_TRUE(opposing);
+    EXPECT_EQ(opposing->size(), static_cast<size_t>(mesh.getNumberOfCells()));
+    EXPECT_EQ(mesh.getOpposingFaces(), opposing);
+
+    const std::unique_ptr<VolumeTetraMesh> copy{mesh.clone()};
+    EXPECT_EQ(copy->getOpposingFaces(), opposing);
+
+    mesh.setData(createVolume(size3_t{3, 4, 5}));
+    const auto updated = mesh.getOpposingFaces();
+    EXPECT_NE(updated, opposing);
+    EXPECT_EQ(updated->size(), static_cast<size_t>(mesh.getNumberOfCells()));
+    EXPECT_EQ(copy->getOpposingFaces(), opposing);
+}
+
+}  // namespace inviwo
@@ -31,67 +31,295 @@
 
 #include <modules/vectorfieldvisualization/vectorfieldvisualizationmoduledefine.h>
 
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
 #include <inviwo/core/datastructures/datatraits.h>
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
 #include <inviwo/core/util/document.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/glmmat.h>
 #include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/sourcecontext.h>
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>
 
+#include <compare>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace inviwo {
 
+/**
+ * A set of integral lines stored as columns. The positions of all lines are kept in one
+ * contiguous array, and each line is a range [offset(i), offset(i+1)) of it. Meta data is stored
+ * in one column per key, a Buffer with one value per position, so all lines in a set share the
+ * same meta data keys.
+ *
+ * Lines are added either by copying an IntegralLine with push_back, by appending another set, or
+ * by writing points directly into the columns (getEditablePositions and getEditableMetaData) and
+ * then calling commitLine. Points written after the last committed line are "pending" until they
+ * are committed or discarded.
+ */
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineSet {
 public:
     enum class SetIndex { Yes, No };
+    using TerminationReason = IntegralLine::TerminationReason;
+
+    /**
+     * A view of a single line in the set. The view refers to the columns of the set and is
+     * invalidated when the set is modified.
+     */
+    class IVW_MODULE_VECTORFIELDVISUALIZATION_API Line {
+    public:
+        Line(const IntegralLineSet& set, size_t line) : set_{&set}, line_{line} {}
+
+        size_t size() const { return set_->offsets_[line_ + 1] - set_->offsets_[line_]; }
+        /** The index of the first point of the line in the columns of the set */
+        size_t getOffset() const { return set_->offsets_[line_]; }
+
+        std::span<const dvec3> getPositions() const {
+            return std::span{set_->positions_}.subspan(getOffset(), size());
+        }
+        template <typename T>
+        std::span<const T> getMetaData(std::string_view name) const {
+            return std::span{set_->getMetaData<T>(name)}.subspan(getOffset(), size());
+        }
+        bool hasMetaData(std::string_view name) const { return set_->hasMetaData(name); }
+        std::vector<std::string> getMetaDataKeys() const { return set_->getMetaDataKeys(); }
+
+        double getLength() const;
+
+        uint32_t getIndex() const { return set_->indices_[line_]; }
+        TerminationReason getBackwardTerminationReason() const {
+            return set_->backwardTerminationReasons_[line_];
+        }
+        TerminationReason getForwardTerminationReason() const {
+            return set_->forwardTerminationReasons_[line_];
+        }
+
+        /** Copy the line and its meta data into a standalone IntegralLine */
+        IntegralLine toIntegralLine() const;
+
+    private:
+        friend IntegralLineSet;
+        const IntegralLineSet* set_;
+        size_t line_;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Line;
+        using difference_type = std::ptrdiff_t;
+        using reference = Line;
+        using pointer = void;
+
+        const_iterator() = default;
+        const_iterator(const IntegralLineSet* set, size_t line) : set_{set}, line_{line} {}
+
+        Line operator*() const { return Line{*set_, line_}; }
+        Line operator[](difference_type n) const { return *(*this + n); }
+
+        const_iterator& operator++() {
+            ++line_;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            ++line_;
+            return tmp;
+        }
+        const_iterator& operator--() {
+            --line_;
+            return *this;
+        }
+        const_iterator operator--(int) {
+            auto tmp = *this;
+            --line_;
+            return tmp;
+        }
+        const_iterator& operator+=(difference_type n) {
+            line_ += n;
+            return *this;
+        }
+        const_iterator& operator-=(difference_type n) {
+            line_ -= n;
+            return *this;
+        }
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b) {
+            return static_cast<difference_type>(a.line_) - static_cast<difference_type>(b.line_);
+        }
+        friend bool operator==(const const_iterator& a, const const_iterator& b) {
+            return a.line_ == b.line_;
+        }
+        friend std::strong_ordering operator<=>(const const_iterator& a,
+                                                const const_iterator& b) {
+            return a.line_ <=> b.line_;
+        }
+
+    private:
+        const IntegralLineSet* set_ = nullptr;
+        size_t line_ = 0;
+    };
+
+    using value_type = Line;
+    using iterator = const_iterator;
 
-    using value_type = IntegralLine;
     IntegralLineSet(mat4 modelMatrix, mat4 worldMatrix = mat4(1));
+    IntegralLineSet(const IntegralLineSet& rhs);
+    IntegralLineSet(IntegralLineSet&& rhs) noexcept = default;
+    IntegralLineSet& operator=(const IntegralLineSet& that);
+    IntegralLineSet& operator=(IntegralLineSet&& that) noexcept = default;
     virtual ~IntegralLineSet();
 
     mat4 getModelMatrix() const;
     mat4 getWorldMatrix() const;
 
-    std::vector<IntegralLine>::const_iterator begin() const;
-    std::vector<IntegralLine>::const_iterator end() const;
-
-    std::vector<IntegralLine>::iterator begin();
-    std::vector<IntegralLine>::iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
-    const IntegralLine& back() const { return lines_.back(); }
-    IntegralLine& back() { return lines_.back(); }
-
-    const IntegralLine& front() const { return lines_.front(); }
-    IntegralLine& front() { return lines_.front(); }
+    /** @throws Exception if the set is empty */
+    Line front() const { return at(0); }
+    /** @throws Exception if the set is empty */
+    Line back() const { return at(size() - 1); }
 
+    /** The number of lines */
     size_t size() const;
+    bool empty() const;
 
-    IntegralLine& operator[](size_t idx);
-    const IntegralLine& operator[](size_t idx) const;
-
-    IntegralLine& at(size_t idx);
-    const IntegralLine& at(size_t idx) const;
+    Line operator[](size_t idx) const;
+    Line at(size_t idx) const;
 
+    /**
+     * Copy \p line into the set. The meta data keys and formats of the line have to match the
+     * ones of the set, unless the set is empty.
+     * @throws Exception if the meta data does not match
+     */
     void push_back(const IntegralLine& line, SetIndex updateIndex);
     void push_back(const IntegralLine& line, size_t idx);
+    /**
+     * Copy \p line from another set into this set.
+     * @throws Exception if the meta data does not match
+     */
+    void push_back(const Line& line, SetIndex updateIndex);
+    void push_back(const Line& line, size_t idx);
+
+    /**
+     * Append all lines of \p other, keeping their indices.
+     * @throws Exception if the meta data does not match
+     */
+    void append(const IntegralLineSet& other);
+
+    /** The positions of all lines */
+    const std::vector<dvec3>& getPositions() const;
+    /**
+     * The offset of the first point of each line, plus the total number of points at the end.
+     * A moved from set has no offsets.
+     */
+    const std::vector<size_t>& getOffsets() const;
 
-    void push_back(IntegralLine&& line, SetIndex updateIndex);
-    void push_back(IntegralLine&& line, size_t idx);
+    /** The meta data column for \p name, one value per position */
+    template <typename T>
+    const std::vector<T>& getMetaData(std::string_view name) const;
+    std::shared_ptr<const BufferBase> getMetaDataBuffer(std::string_view name) const;
+    const std::map<std::string, std::shared_ptr<BufferBase>, std::less<>>& getMetaDataBuffers()
+        const;
+    bool hasMetaData(std::string_view name) const;
+    std::vector<std::string> getMetaDataKeys() const;
 
-    std::vector<IntegralLine>& getVector() { return lines_; }
-    const std::vector<IntegralLine>& getVector() const { return lines_; }
+    /**
+     * Editable access to the positions, used to add points to a new line.
+     * @see commitLine
+     */
+    std::vector<dvec3>& getEditablePositions();
+    /**
+     * Editable access to the meta data column for \p name. The column is created, filled with
+     * zeros for all existing points, if it does not exist.
+     * @throws Exception if the column exists with another format
+     */
+    template <typename T>
+    std::vector<T>& getEditableMetaData(std::string_view name);
+
+    /** The number of points added to the columns since the last committed line */
+    size_t getNumberOfPendingPoints() const;
+    /** Reverse the order of the pending points in all columns */
+    void reversePendingPoints();
+    /** Remove the pending points from all columns */
+    void discardPendingPoints();
+    /**
+     * Add the pending points as a new line.
+     * @throws Exception if not all meta data columns have the same size as the positions
+     */
+    void commitLine(uint32_t index, TerminationReason backward = TerminationReason::Unknown,
+                    TerminationReason forward = TerminationReason::Unknown);
 
 private:
-    std::vector<IntegralLine> lines_;
+    // The number of points in committed lines, offsets_ is empty in a moved from set
+    size_t committedPoints() const;
+    void checkColumns() const;
+
+    std::vector<dvec3> positions_;
+    std::vector<size_t> offsets_;
+    std::map<std::string, std::shared_ptr<BufferBase>, std::less<>> metaData_;
+
+    std::vector<uint32_t> indices_;
+    std::vector<TerminationReason> backwardTerminationReasons_;
+    std::vector<TerminationReason> forwardTerminationReasons_;
+
     mat4 modelMatrix_;
     mat4 worldMatrix_;
 };
 
+template <typename T>
+const std::vector<T>& IntegralLineSet::getMetaData(std::string_view name) const {
+    auto it = metaData_.find(name);
+    if (it == metaData_.end()) {
+        throw Exception(SourceContext{}, "No meta data with name: {}", name);
+    }
+    auto askedDF = DataFormat<T>::get();
+    auto isDF = it->second->getDataFormat();
+    if (isDF != askedDF) {
+        throw Exception(SourceContext{},
+                        "Incorrect dataformat for meta data {} asking for {} but is {}", name,
+                        askedDF->getString(), isDF->getString());
+    }
+    return static_cast<const Buffer<T>*>(it->second.get())
+        ->getRAMRepresentation()
+        ->getDataContainer();
+}
+
+template <typename T>
+std::vector<T>& IntegralLineSet::getEditableMetaData(std::string_view name) {
+    auto it = metaData_.find(name);
+    if (it == metaData_.end()) {
+        it = metaData_.emplace(name, util::makeBuffer(std::vector<T>(positions_.size()))).first;
+    }
+    auto askedDF = DataFormat<T>::get();
+    auto isDF = it->second->getDataFormat();
+    if (isDF != askedDF) {
+        throw Exception(SourceContext{},
+                        "Incorrect dataformat for meta data {} asking for {} but is {}", name,
+                        askedDF->getString(), isDF->getString());
+    }
+    return static_cast<Buffer<T>*>(it->second.get())
+        ->getEditableRAMRepresentation()
+        ->getDataContainer();
+}
+
 using IntegralLineSetInport = DataInport<IntegralLineSet>;
 using IntegralLineSetOutport = DataOutport<IntegralLineSet>;
 
@@ -102,7 +330,8 @@ struct DataTraits<IntegralLineSet> {
     static constexpr uvec3 colorCode() { return {255, 150, 0}; }
     static Document info(const IntegralLineSet& data) {
         std::ostringstream oss;
-        oss << "Integral Line Set with " << data.size() << " lines";
+        oss << "Integral Line Set with " << data.size() << " lines and "
+            << data.getPositions().size() << " points";
         Document doc;
         doc.append("p", oss.str());
         return doc;
@@ -36,8 +36,10 @@
 #include <inviwo/core/util/spatial4dsampler.h>  // IWUY pragma: keep
 #include <inviwo/core/util/typetraits.h>
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
 #include <modules/vectorfieldvisualization/properties/integrallineproperties.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -79,6 +81,15 @@ public:
 
     Result traceFrom(const SpatialVector& pIn) const;
 
+    /**
+     * Trace a line from \p pIn and add it to \p lines with index \p idx. The points are written
+     * directly into the columns of \p lines. Lines with less than \p minPoints points are
+     * discarded.
+     * @return true if the line was added
+     */
+    bool traceInto(const SpatialVector& pIn, IntegralLineSet& lines, size_t idx,
+                   size_t minPoints = 2) const;
+
     void addMetaDataSampler(const std::string& name, std::shared_ptr<const Sampler> sampler);
 
     const DataHomogeneousSpatialMatrix& getSeedTransformationMatrix() const;
@@ -90,15 +101,38 @@ private:
         bool outOfBounds;
     };
 
+    /**
+     * The columns of an IntegralLineSet that the tracer writes to, looked up once per line
+     */
+    struct Columns {
+        IntegralLineSet& lines;
+        std::vector<dvec3>& positions;
+        std::vector<dvec3>& velocities;
+        std::vector<double>* timestamps;
+        std::vector<std::pair<const Sampler*, std::vector<SampleType>*>> metaData;
+    };
+
+    struct Trace {
+        size_t seedIndex{0};
+        IntegralLine::TerminationReason backward{IntegralLine::TerminationReason::Unknown};
+        IntegralLine::TerminationReason forward{IntegralLine::TerminationReason::Unknown};
+    };
+
     inline SpatialVector seedTransform(const SpatialVector& seed) const;
 
     StepResult step(const SpatialVector& oldPos, double stepSize) const;
 
-    bool addPoint(IntegralLine& line, const SpatialVector& pos) const;
-    bool addPoint(IntegralLine& line, const SpatialVector& pos,
-                  const DataVector& worldVelocity) const;
+    Columns columns(IntegralLineSet& lines) const;
+
+    /**
+     * Trace a line from \p pIn, the points are left as pending points in the columns.
+     */
+    Trace trace(const SpatialVector& pIn, Columns& cols) const;
+
+    bool addPoint(Columns& cols, const SpatialVector& pos) const;
+    bool addPoint(Columns& cols, const SpatialVector& pos, const DataVector& worldVelocity) const;
 
-    IntegralLine::TerminationReason integrate(size_t steps, SpatialVector pos, IntegralLine& line,
+    IntegralLine::TerminationReason integrate(size_t steps, SpatialVector pos, Columns& cols,
                                               bool fwd) const;
 
     IntegralLineProperties::IntegrationScheme integrationScheme_;
@@ -131,18 +165,66 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::IntegralLineTracer(
 template <typename SpatialSampler, bool TimeDependent>
 typename IntegralLineTracer<SpatialSampler, TimeDependent>::Result
 IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const SpatialVector& pIn) const {
-    const SpatialVector p = seedTransform(pIn);
+    IntegralLineSet lines{mat4{1.0f}};
+    auto cols = columns(lines);
+    const auto trace = this->trace(pIn, cols);
+
     Result res;
-    IntegralLine& line = res.line;
+    res.seedIndex = trace.seedIndex;
+    if (lines.getNumberOfPendingPoints() > 0) {
+        lines.commitLine(0, trace.backward, trace.forward);
+        res.line = lines.front().toIntegralLine();
+    } else {
+        res.line.setBackwardTerminationReason(trace.backward);
+        res.line.setForwardTerminationReason(trace.forward);
+    }
+    return res;
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+bool IntegralLineTracer<SpatialSampler, TimeDependent>::traceInto(const SpatialVector& pIn,
+                                                                  IntegralLineSet& lines,
+                                                                  size_t idx,
+                                                                  size_t minPoints) const {
+    auto cols = columns(lines);
+    const auto trace = this->trace(pIn, cols);
+    if (lines.getNumberOfPendingPoints() < std::max(minPoints, size_t{1})) {
+        lines.discardPendingPoints();
+        return false;
+    }
+    lines.commitLine(static_cast<uint32_t>(idx), trace.backward, trace.forward);
+    return true;
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::columns(IntegralLineSet& lines) const
+    -> Columns {
+    Columns cols{lines, lines.getEditablePositions(),
+                 lines.getEditableMetaData<dvec3>("velocity"), nullptr, {}};
+    if constexpr (TimeDependent) {
+        cols.timestamps = &lines.getEditableMetaData<double>("timestamp");
+    }
+    for (auto& m : metaSamplers_) {
+        cols.metaData.emplace_back(m.second.get(),
+                                   &lines.getEditableMetaData<SampleType>(m.first));
+    }
+    return cols;
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::trace(const SpatialVector& pIn,
+                                                              Columns& cols) const -> Trace {
+    const SpatialVector p = seedTransform(pIn);
+    Trace res;
 
     const auto [stepsBWD, stepsFWD] = [dir = dir_, steps = steps_,
-                                       &line]() -> std::pair<size_t, size_t> {
+                                       &res]() -> std::pair<size_t, size_t> {
         switch (dir) {
             case inviwo::IntegralLineProperties::Direction::Forward:
-                line.setBackwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
+                res.backward = IntegralLine::TerminationReason::StartPoint;
                 return {1, steps + 1};
             case inviwo::IntegralLineProperties::Direction::Backward:
-                line.setForwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
+                res.forward = IntegralLine::TerminationReason::StartPoint;
                 return {steps + 1, 1};
             default:
             case inviwo::IntegralLineProperties::Direction::Bidirectional: {
@@ -151,29 +233,18 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const SpatialVector
         }
     }();
 
-    line.getPositions().reserve(steps_ + 2);
-    line.getMetaData<dvec3>("velocity", true).reserve(steps_ + 2);
-
-    if constexpr (TimeDependent) {
-        line.getMetaData<double>("timestamp", true).reserve(steps_ + 2);
-    }
-
-    for (auto& m : metaSamplers_) {
-        line.getMetaData<typename Sampler::type>(m.first, true).reserve(steps_ + 2);
-    }
-
-    if (!addPoint(line, p)) {
+    if (!addPoint(cols, p)) {
         return res;  // Zero velocity at seed point
     }
 
-    line.setBackwardTerminationReason(integrate(stepsBWD, p, line, false));
+    res.backward = integrate(stepsBWD, p, cols, false);
 
-    if (line.getPositions().size() > 1) {
-        line.reverse();
-        res.seedIndex = line.getPositions().size() - 1;
+    if (const auto points = cols.lines.getNumberOfPendingPoints(); points > 1) {
+        cols.lines.reversePendingPoints();
+        res.seedIndex = points - 1;
     }
 
-    line.setForwardTerminationReason(integrate(stepsFWD, p, line, true));
+    res.forward = integrate(stepsFWD, p, cols, true);
     return res;
 }
 
@@ -266,36 +337,35 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
 }
 
 template <typename SpatialSampler, bool TimeDependent>
-bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(IntegralLine& line,
+bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(Columns& cols,
                                                                  const SpatialVector& pos) const {
-    return addPoint(line, pos, sampler_->sample(pos));
+    return addPoint(cols, pos, sampler_->sample(pos));
 }
 
 template <typename SpatialSampler, bool TimeDependent>
 bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(
-    IntegralLine& line, const SpatialVector& pos, const DataVector& worldVelocity) const {
+    Columns& cols, const SpatialVector& pos, const DataVector& worldVelocity) const {
 
     if (glm::length(worldVelocity) < std::numeric_limits<double>::epsilon()) {
         return false;
     }
 
-    line.getPositions().emplace_back(util::glm_convert<dvec3>(pos));
-    line.getMetaData<dvec3>("velocity").emplace_back(util::glm_convert<dvec3>(worldVelocity));
+    cols.positions.emplace_back(util::glm_convert<dvec3>(pos));
+    cols.velocities.emplace_back(util::glm_convert<dvec3>(worldVelocity));
 
     if constexpr (TimeDependent) {
-        line.getMetaData<double>("timestamp").emplace_back(pos[Sampler::SpatialDimensions - 1]);
+        cols.timestamps->emplace_back(pos[Sampler::SpatialDimensions - 1]);
     }
 
-    for (auto& m : metaSamplers_) {
-        line.getMetaData<typename Sampler::type>(m.first).emplace_back(
-            util::glm_convert<dvec3>(m.second->sample(pos)));
+    for (auto& [sampler, column] : cols.metaData) {
+        column->emplace_back(util::glm_convert<SampleType>(sampler->sample(pos)));
     }
     return true;
 }
 
 template <typename SpatialSampler, bool TimeDependent>
 IntegralLine::TerminationReason IntegralLineTracer<SpatialSampler, TimeDependent>::integrate(
-    size_t steps, SpatialVector pos, IntegralLine& line, bool fwd) const {
+    size_t steps, SpatialVector pos, Columns& cols, bool fwd) const {
     if (steps == 0) return IntegralLine::TerminationReason::StartPoint;
     for (size_t i = 0; i < steps; i++) {
         if (!sampler_->withinBounds(pos)) {
@@ -307,7 +377,7 @@ IntegralLine::TerminationReason IntegralLineTracer<SpatialSampler, TimeDependent
         }
         pos = result.position;
 
-        if (!addPoint(line, result.position, result.data)) {
+        if (!addPoint(cols, result.position, result.data)) {
             return IntegralLine::TerminationReason::ZeroVelocity;
         }
     }
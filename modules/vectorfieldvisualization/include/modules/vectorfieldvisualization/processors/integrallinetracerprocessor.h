@@ -43,6 +43,10 @@
 #include <modules/vectorfieldvisualization/integrallinetracer.h>
 #include <modules/vectorfieldvisualization/ports/seedpointsport.h>
 
+#include <algorithm>
+#include <ranges>
+#include <vector>
+
 namespace inviwo {
 
 template <typename Tracer>
@@ -113,17 +117,26 @@ void IntegralLineTracerProcessor<Tracer>::process() {
         tracer.addMetaDataSampler(key, meta.second);
     }
 
-    std::mutex mutex;
+    // Each job traces a contiguous range of seeds into its own set, the sets are then appended in
+    // seed order. This avoids any locking and keeps the output independent of the scheduling.
+    const size_t jobs = std::max(size_t{1}, 4 * util::getPoolSize());
     size_t startID = 0;
     for (const auto& seeds : seeds_) {
-        util::forEachParallel(*seeds, [&](const auto& p, size_t i) {
-            IntegralLine line = tracer.traceFrom(p);
-            auto size = line.getPositions().size();
-            if (size > 1) {
-                std::lock_guard<std::mutex> lock(mutex);
-                lines->push_back(std::move(line), startID + i);
-            }
-        });
+        std::vector<IntegralLineSet> chunks(
+            jobs, IntegralLineSet{sampler->getModelMatrix(), sampler->getWorldMatrix()});
+        util::forEachParallel(
+            std::views::iota(size_t{0}, jobs),
+            [&](size_t job) {
+                const auto begin = (seeds->size() * job) / jobs;
+                const auto end = (seeds->size() * (job + 1)) / jobs;
+                for (auto i = begin; i < end; ++i) {
+                    tracer.traceInto((*seeds)[i], chunks[job], startID + i);
+                }
+            },
+            jobs);
+        for (const auto& chunk : chunks) {
+            lines->append(chunk);
+        }
         startID += seeds->size();
     }
 
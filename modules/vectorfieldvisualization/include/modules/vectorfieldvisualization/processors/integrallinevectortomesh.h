@@ -62,7 +62,6 @@
 
 namespace inviwo {
 class Deserializer;
-class IntegralLine;
 class Serializer;
 
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineVectorToMesh : public Processor {
@@ -138,8 +137,8 @@ private:
 
     FloatVec4Property selectedColor_;
 
-    bool isFiltered(const IntegralLine& line, uint32_t idx) const;
-    bool isSelected(const IntegralLine& line, uint32_t idx) const;
+    bool isFiltered(const IntegralLineSet::Line& line, uint32_t idx) const;
+    bool isSelected(const IntegralLineSet::Line& line, uint32_t idx) const;
 
     void updateOptions();
 };
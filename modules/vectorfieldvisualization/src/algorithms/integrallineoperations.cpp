@@ -42,7 +42,9 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <span>
 #include <sstream>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -55,6 +57,89 @@
 
 namespace inviwo {
 namespace util {
+
+namespace {
+
+/**
+ * Transform \p positions to world space and store them in \p world, the \p world vector is reused
+ * between lines to avoid allocations.
+ */
+void toWorldSpace(std::span<const dvec3> positions, const dmat4& toWorld,
+                  std::vector<dvec3>& world) {
+    world.resize(positions.size());
+    std::transform(positions.begin(), positions.end(), world.begin(), [&](const dvec3& pos) {
+        const dvec4 P = toWorld * dvec4(pos, 1);
+        return dvec3(P) / P.w;
+    });
+}
+
+/**
+ * Compute the curvature for each of the world space \p positions into \p K, both spans have to
+ * have the same size which has to be larger than one.
+ */
+void curvature(std::span<const dvec3> positions, std::span<double> K) {
+    const auto n = positions.size();
+    for (size_t i = 1; i + 1 < n; ++i) {
+        const auto t1 = positions[i - 1] - positions[i];
+        const auto t2 = positions[i] - positions[i + 1];
+
+        const auto l1 = glm::length(t1);
+        const auto l2 = glm::length(t2);
+        if (l1 == 0 || l2 == 0) {
+            K[i] = 0;
+            log::warn("Got zero offset");
+            continue;
+        }
+        const auto nt1 = t1 / l1;  // normalize t1
+        const auto nt2 = t2 / l2;  // normalize t2
+        const auto dot = glm::dot(nt1, nt2);
+        const auto cdot = dot < -1.0 ? -1.0 : (dot > 1.0 ? 1.0 : dot);
+        const auto angle = std::acos(cdot);
+
+        const double meanL = 0.5 * (l1 + l2);
+        K[i] = angle / meanL;
+    }
+    K[n - 1] = n > 2 ? K[n - 2] : 0.0;  // last, copy second to last
+    K[0] = K[1];                        // Copy second to first
+}
+
+/**
+ * Compute the tortuosity for each of the world space \p positions into \p K, both spans have to
+ * have the same size.
+ */
+void tortuosity(std::span<const dvec3> positions, std::span<double> K) {
+    if (positions.empty()) return;
+    double acuDist = 0;
+    const dvec3 start = positions.front();
+    dvec3 prev = start;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const auto& p = positions[i];
+        acuDist += glm::distance(prev, p);
+        prev = p;
+        const auto dist = glm::distance(start, p);
+        K[i] = dist == 0 ? 1.0 : acuDist / dist;
+    }
+}
+
+/**
+ * Fill a new double column called \p name in \p lines by calling \p kernel for each line with
+ * more than \p minPoints points.
+ */
+template <typename Kernel>
+void perLine(IntegralLineSet& lines, std::string_view name, size_t minPoints, Kernel kernel) {
+    if (lines.hasMetaData(name)) return;
+    const dmat4 toWorld{lines.getModelMatrix()};
+    auto& column = lines.getEditableMetaData<double>(name);
+    std::vector<dvec3> world;
+    for (const auto& line : lines) {
+        if (line.size() <= minPoints) continue;
+        toWorldSpace(line.getPositions(), toWorld, world);
+        kernel(world, std::span{column}.subspan(line.getOffset(), line.size()));
+    }
+}
+
+}  // namespace
+
 IntegralLine curvature(const IntegralLine& line, dmat4 toWorld) {
     IntegralLine copy(line);
     curvature(copy, toWorld);
@@ -69,58 +154,17 @@ IntegralLineSet curvature(const IntegralLineSet& lines) {
 void curvature(IntegralLine& line, dmat4 toWorld) {
     if (line.hasMetaData("curvature")) return;
     if (line.getPositions().size() <= 1) return;
-    auto positions = line.getPositions();  // note, this creates a copy, we modify it below
 
-    std::transform(positions.begin(), positions.end(), positions.begin(), [&](dvec3 pos) {
-        dvec4 P = toWorld * dvec4(pos, 1);
-        return dvec3(P) / P.w;
-    });
-
-    auto md = line.createMetaData<double>("curvature");
-    auto& K = md->getEditableRAMRepresentation()->getDataContainer();
-    const auto& V = line.getMetaData<dvec3>("velocity");
-
-    auto cur = positions.begin();
-    auto vel = V.begin();
-
-    for (; cur != positions.end() && vel != V.end(); ++cur, ++vel) {
-        if (cur == positions.begin()) {
-            // first
-            K.emplace_back(0);
-        } else if (cur == positions.end() - 1) {
-            // last, copy second to last
-            K.emplace_back(K.back());
-        } else {
-            const auto p = *cur;
-            const auto pm = *(cur - 1);
-            const auto pp = *(cur + 1);
-
-            const auto t1 = pm - p;
-            const auto t2 = p - pp;
-
-            auto l1 = glm::length(t1);
-            auto l2 = glm::length(t2);
-            if (l1 == 0 || l2 == 0) {
-                K.emplace_back(0);
-                log::warn("Got zero offset");
-                continue;
-            }
-            const auto nt1 = t1 / l1;  // normalize t1
-            const auto nt2 = t2 / l2;  // normalize t2
-            const auto dot = glm::dot(nt1, nt2);
-            const auto cdot = dot < -1.0 ? -1.0 : (dot > 1.0 ? 1.0 : dot);
-            const auto angle = std::acos(cdot);
-
-            const double meanL = 0.5 * (l1 + l2);
-            K.emplace_back(angle / meanL);
-        }
-    }
-    K[0] = K[1];  // Copy second to first
+    std::vector<dvec3> world;
+    toWorldSpace(line.getPositions(), toWorld, world);
+    auto& K = line.getMetaData<double>("curvature", true);
+    K.resize(world.size());
+    curvature(world, K);
 }
 void curvature(IntegralLineSet& lines) {
-    for (auto& line : lines) {
-        curvature(line, dmat4(lines.getModelMatrix()));
-    }
+    perLine(lines, "curvature", 1, [](std::span<const dvec3> positions, std::span<double> K) {
+        curvature(positions, K);
+    });
 }
 
 IntegralLine tortuosity(const IntegralLine& line, dmat4 toWorld) {
@@ -136,36 +180,18 @@ IntegralLineSet tortuosity(const IntegralLineSet& lines) {
 
 void tortuosity(IntegralLine& line, dmat4 toWorld) {
     if (line.hasMetaData("tortuosity")) return;
-    auto positions = line.getPositions();  // note, this creates a copy, we modify it below
-    if (positions.size() <= 1) return;
-
-    std::transform(positions.begin(), positions.end(), positions.begin(), [&](dvec3 pos) {
-        dvec4 P = toWorld * dvec4(pos, 1);
-        return dvec3(P) / P.w;
-    });
-
-    auto md = line.createMetaData<double>("tortuosity");
-    auto& K = md->getEditableRAMRepresentation()->getDataContainer();
-    double acuDist = 0;
-
-    dvec3 start = positions.front();
-    dvec3 prev = start;
-
-    for (auto& p : positions) {
-        auto div = [](auto a, auto b) {
-            if (b == 0) return 1.0;
-            return a / b;
-        };
+    if (line.getPositions().size() <= 1) return;
 
-        acuDist += glm::distance(prev, p);
-        prev = p;
-        K.emplace_back(div(acuDist, glm::distance(start, p)));
-    }
+    std::vector<dvec3> world;
+    toWorldSpace(line.getPositions(), toWorld, world);
+    auto& K = line.getMetaData<double>("tortuosity", true);
+    K.resize(world.size());
+    tortuosity(world, K);
 }
 void tortuosity(IntegralLineSet& lines) {
-    for (auto& line : lines) {
-        tortuosity(line, dmat4(lines.getModelMatrix()));
-    }
+    perLine(lines, "tortuosity", 1, [](std::span<const dvec3> positions, std::span<double> K) {
+        tortuosity(positions, K);
+    });
 }
 
 }  // namespace util
@@ -29,64 +29,297 @@
 
 #include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
 
+#include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/util/glmmat.h>
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <map>
+#include <string>
+#include <type_traits>
 #include <utility>
 
+#include <glm/geometric.hpp>
+
 namespace inviwo {
 
+namespace {
+
+template <typename Callable>
+void dispatchEditableColumn(BufferBase& buffer, Callable&& callable) {
+    buffer.getEditableRepresentation<BufferRAM>()->dispatch<void>(
+        [&](auto brprecision) { callable(brprecision->getDataContainer()); });
+}
+
+template <typename Callable>
+void dispatchColumn(const BufferBase& buffer, Callable&& callable) {
+    buffer.getRepresentation<BufferRAM>()->dispatch<void>(
+        [&](auto brprecision) { callable(brprecision->getDataContainer()); });
+}
+
+using MetaDataMap = std::map<std::string, std::shared_ptr<BufferBase>, std::less<>>;
+
+/**
+ * Append the elements [begin, end) of each column in \p src to the column with the same key in
+ * \p dst. If \p adoptKeys is set, \p dst is replaced by columns matching \p src.
+ * All keys and formats are checked before anything is appended, \p dst is left unchanged if
+ * they do not match.
+ * @throws Exception if the keys or formats of \p dst and \p src do not match
+ */
+template <typename SrcMap>
+void appendMetaData(MetaDataMap& dst, const SrcMap& src, size_t begin, size_t end,
+                    bool adoptKeys) {
+    MetaDataMap adopted;
+    if (adoptKeys) {
+        for (const auto& [key, buffer] : src) {
+            dispatchColumn(*buffer, [&, &key = key](const auto& data) {
+                using T = typename std::remove_cvref_t<decltype(data)>::value_type;
+                adopted.emplace(key, util::makeBuffer(std::vector<T>{}));
+            });
+        }
+    }
+    auto& target = adoptKeys ? adopted : dst;
+
+    if (src.size() != target.size()) {
+        throw Exception(SourceContext{}, "Meta data does not match the set, {} vs {} keys",
+                        src.size(), target.size());
+    }
+    for (const auto& [key, buffer] : src) {
+        auto it = target.find(key);
+        if (it == target.end() || it->second->getDataFormat() != buffer->getDataFormat()) {
+            throw Exception(SourceContext{}, "Meta data {} does not match the set", key);
+        }
+    }
+
+    for (const auto& [key, buffer] : src) {
+        dispatchEditableColumn(*target.find(key)->second, [&, &srcBuffer = buffer](auto& dstData) {
+            using T = typename std::remove_cvref_t<decltype(dstData)>::value_type;
+            const auto& srcData = static_cast<const BufferRAMPrecision<T>*>(
+                                      srcBuffer->getRepresentation<BufferRAM>())
+                                      ->getDataContainer();
+            dstData.insert(dstData.end(), srcData.begin() + begin, srcData.begin() + end);
+        });
+    }
+    if (adoptKeys) dst = std::move(adopted);
+}
+
+}  // namespace
+
+double IntegralLineSet::Line::getLength() const {
+    const auto positions = getPositions();
+    double length = 0.0;
+    for (size_t i = 1; i < positions.size(); ++i) {
+        length += glm::distance(positions[i - 1], positions[i]);
+    }
+    return length;
+}
+
+IntegralLine IntegralLineSet::Line::toIntegralLine() const {
+    IntegralLine line;
+    const auto positions = getPositions();
+    line.getPositions().assign(positions.begin(), positions.end());
+    const auto begin = getOffset();
+    const auto end = begin + size();
+    for (const auto& [key, buffer] : set_->metaData_) {
+        dispatchColumn(*buffer, [&, &key = key](const auto& data) {
+            using T = typename std::remove_cvref_t<decltype(data)>::value_type;
+            line.addMetaDataBuffer(
+                key, util::makeBuffer(std::vector<T>(data.begin() + begin, data.begin() + end)));
+        });
+    }
+    line.setIndex(getIndex());
+    line.setBackwardTerminationReason(getBackwardTerminationReason());
+    line.setForwardTerminationReason(getForwardTerminationReason());
+    return line;
+}
+
 IntegralLineSet::IntegralLineSet(mat4 modelMatrix, mat4 worldMatrix)
-    : lines_(), modelMatrix_(modelMatrix), worldMatrix_(worldMatrix) {}
+    : positions_{}
+    , offsets_{0}
+    , metaData_{}
+    , modelMatrix_(modelMatrix)
+    , worldMatrix_(worldMatrix) {}
+
+IntegralLineSet::IntegralLineSet(const IntegralLineSet& rhs)
+    : positions_{rhs.positions_}
+    , offsets_{rhs.offsets_}
+    , metaData_{}
+    , indices_{rhs.indices_}
+    , backwardTerminationReasons_{rhs.backwardTerminationReasons_}
+    , forwardTerminationReasons_{rhs.forwardTerminationReasons_}
+    , modelMatrix_{rhs.modelMatrix_}
+    , worldMatrix_{rhs.worldMatrix_} {
+    for (const auto& [key, buffer] : rhs.metaData_) {
+        metaData_.emplace(key, std::shared_ptr<BufferBase>(buffer->clone()));
+    }
+}
+
+IntegralLineSet& IntegralLineSet::operator=(const IntegralLineSet& that) {
+    if (this != &that) {
+        IntegralLineSet copy{that};
+        *this = std::move(copy);
+    }
+    return *this;
+}
 
-IntegralLineSet::~IntegralLineSet() {}
+IntegralLineSet::~IntegralLineSet() = default;
 
 mat4 IntegralLineSet::getModelMatrix() const { return modelMatrix_; }
 mat4 IntegralLineSet::getWorldMatrix() const { return worldMatrix_; }
 
-std::vector<IntegralLine>::const_iterator IntegralLineSet::begin() const { return lines_.begin(); }
+auto IntegralLineSet::begin() const -> const_iterator { return const_iterator{this, 0}; }
+
+auto IntegralLineSet::end() const -> const_iterator { return const_iterator{this, size()}; }
+
+size_t IntegralLineSet::size() const { return indices_.size(); }
+
+bool IntegralLineSet::empty() const { return indices_.empty(); }
+
+auto IntegralLineSet::operator[](size_t idx) const -> Line { return Line{*this, idx}; }
 
-std::vector<IntegralLine>::iterator IntegralLineSet::begin() { return lines_.begin(); }
+auto IntegralLineSet::at(size_t idx) const -> Line {
+    if (idx >= size()) {
+        throw Exception(SourceContext{}, "Line index {} out of range, the set has {} lines", idx,
+                        size());
+    }
+    return Line{*this, idx};
+}
+
+void IntegralLineSet::push_back(const IntegralLine& line, SetIndex updateIndex) {
+    push_back(line, updateIndex == SetIndex::Yes ? size() : line.getIndex());
+}
+
+void IntegralLineSet::push_back(const IntegralLine& line, size_t idx) {
+    const auto& positions = line.getPositions();
+    appendMetaData(metaData_, line.getMetaDataBuffers(), 0, positions.size(),
+                   positions_.empty());
+
+    positions_.insert(positions_.end(), positions.begin(), positions.end());
+    commitLine(static_cast<uint32_t>(idx), line.getBackwardTerminationReason(),
+               line.getForwardTerminationReason());
+}
+
+void IntegralLineSet::push_back(const Line& line, SetIndex updateIndex) {
+    push_back(line, updateIndex == SetIndex::Yes ? size() : line.getIndex());
+}
 
-std::vector<IntegralLine>::const_iterator IntegralLineSet::end() const { return lines_.end(); }
+void IntegralLineSet::push_back(const Line& line, size_t idx) {
+    const auto begin = line.getOffset();
+    appendMetaData(metaData_, line.set_->metaData_, begin, begin + line.size(),
+                   positions_.empty());
 
-std::vector<IntegralLine>::iterator IntegralLineSet::end() { return lines_.end(); }
+    const auto positions = line.getPositions();
+    positions_.insert(positions_.end(), positions.begin(), positions.end());
+    commitLine(static_cast<uint32_t>(idx), line.getBackwardTerminationReason(),
+               line.getForwardTerminationReason());
+}
 
-size_t IntegralLineSet::size() const { return lines_.size(); }
+void IntegralLineSet::append(const IntegralLineSet& other) {
+    if (getNumberOfPendingPoints() != 0) {
+        throw Exception(SourceContext{}, "Can not append lines with pending points");
+    }
+    if (other.empty()) return;
 
-IntegralLine& IntegralLineSet::operator[](size_t idx) { return lines_[idx]; }
+    const auto begin = other.offsets_.front();
+    const auto end = other.offsets_.back();
+    appendMetaData(metaData_, other.metaData_, begin, end, positions_.empty());
 
-const IntegralLine& IntegralLineSet::operator[](size_t idx) const { return lines_[idx]; }
+    const auto shift = positions_.size();
+    if (offsets_.empty()) offsets_.push_back(0);
+    positions_.insert(positions_.end(), other.positions_.begin() + begin,
+                      other.positions_.begin() + end);
+    std::transform(other.offsets_.begin() + 1, other.offsets_.end(), std::back_inserter(offsets_),
+                   [&](size_t offset) { return offset + shift; });
+    indices_.insert(indices_.end(), other.indices_.begin(), other.indices_.end());
+    backwardTerminationReasons_.insert(backwardTerminationReasons_.end(),
+                                       other.backwardTerminationReasons_.begin(),
+                                       other.backwardTerminationReasons_.end());
+    forwardTerminationReasons_.insert(forwardTerminationReasons_.end(),
+                                      other.forwardTerminationReasons_.begin(),
+                                      other.forwardTerminationReasons_.end());
+}
 
-IntegralLine& IntegralLineSet::at(size_t idx) { return lines_.at(idx); }
+const std::vector<dvec3>& IntegralLineSet::getPositions() const { return positions_; }
 
-const IntegralLine& IntegralLineSet::at(size_t idx) const { return lines_.at(idx); }
+const std::vector<size_t>& IntegralLineSet::getOffsets() const { return offsets_; }
 
-void IntegralLineSet::push_back(const IntegralLine& line, SetIndex updateIndex) {
-    if (updateIndex == SetIndex::No) {
-        lines_.push_back(line);
-    } else {
-        push_back(line, lines_.size());
+std::shared_ptr<const BufferBase> IntegralLineSet::getMetaDataBuffer(std::string_view name) const {
+    auto it = metaData_.find(name);
+    if (it == metaData_.end()) {
+        throw Exception(SourceContext{}, "No meta data with name: {}", name);
     }
+    return it->second;
 }
 
-void IntegralLineSet::push_back(const IntegralLine& line, size_t idx) {
-    IntegralLine copy(line);
-    copy.setIndex(static_cast<uint32_t>(idx));
-    lines_.push_back(std::move(copy));
+const std::map<std::string, std::shared_ptr<BufferBase>, std::less<>>&
+IntegralLineSet::getMetaDataBuffers() const {
+    return metaData_;
 }
 
-void IntegralLineSet::push_back(IntegralLine&& line, SetIndex updateIndex) {
-    if (updateIndex == SetIndex::Yes) {
-        line.setIndex(static_cast<uint32_t>(lines_.size()));
+bool IntegralLineSet::hasMetaData(std::string_view name) const {
+    return metaData_.find(name) != metaData_.end();
+}
+
+std::vector<std::string> IntegralLineSet::getMetaDataKeys() const {
+    std::vector<std::string> keys;
+    for (auto& m : metaData_) {
+        keys.push_back(m.first);
+    }
+    return keys;
+}
+
+std::vector<dvec3>& IntegralLineSet::getEditablePositions() { return positions_; }
+
+size_t IntegralLineSet::getNumberOfPendingPoints() const {
+    return positions_.size() - committedPoints();
+}
+
+void IntegralLineSet::reversePendingPoints() {
+    const auto begin = committedPoints();
+    std::reverse(positions_.begin() + begin, positions_.end());
+    for (auto& [key, buffer] : metaData_) {
+        dispatchEditableColumn(*buffer, [&](auto& data) {
+            if (data.size() > begin) std::reverse(data.begin() + begin, data.end());
+        });
     }
-    lines_.push_back(line);
 }
 
-void IntegralLineSet::push_back(IntegralLine&& line, size_t idx) {
-    line.setIndex(static_cast<uint32_t>(idx));
-    lines_.push_back(line);
+void IntegralLineSet::discardPendingPoints() {
+    const auto begin = committedPoints();
+    positions_.resize(begin);
+    for (auto& [key, buffer] : metaData_) {
+        dispatchEditableColumn(*buffer, [&](auto& data) {
+            if (data.size() > begin) data.resize(begin);
+        });
+    }
+}
+
+void IntegralLineSet::commitLine(uint32_t index, TerminationReason backward,
+                                 TerminationReason forward) {
+    checkColumns();
+    if (offsets_.empty()) offsets_.push_back(0);
+    offsets_.push_back(positions_.size());
+    indices_.push_back(index);
+    backwardTerminationReasons_.push_back(backward);
+    forwardTerminationReasons_.push_back(forward);
+}
+
+size_t IntegralLineSet::committedPoints() const {
+    return offsets_.empty() ? 0 : offsets_.back();
+}
+
+void IntegralLineSet::checkColumns() const {
+    for (const auto& [key, buffer] : metaData_) {
+        dispatchColumn(*buffer, [&](const auto& data) {
+            if (data.size() != positions_.size()) {
+                throw Exception(SourceContext{},
+                                "Meta data {} has {} values, expected one per position ({})", key,
+                                data.size(), positions_.size());
+            }
+        });
+    }
 }
 
 }  // namespace inviwo
@@ -214,7 +214,7 @@ void PathLinesDeprecated::process() {
         }
     }
 
-    for (auto& line : *lines) {
+    for (const auto& line : *lines) {
         auto size = line.getPositions().size();
         if (size <= 1) continue;
 
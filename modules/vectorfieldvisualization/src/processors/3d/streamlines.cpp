@@ -204,7 +204,7 @@ void StreamLinesDeprecated::process() {
         }
     }
 
-    for (auto& line : *lines) {
+    for (const auto& line : *lines) {
         auto position = line.getPositions().begin();
         auto velocity = line.getMetaData<dvec3>("velocity").begin();
 
@@ -65,9 +65,7 @@
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/sourcecontext.h>
 #include <inviwo/core/util/staticstring.h>
-#include <inviwo/core/util/zip.h>
 #include <modules/brushingandlinking/ports/brushingandlinkingports.h>
-#include <modules/vectorfieldvisualization/datastructures/integralline.h>
 #include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
 
 #include <algorithm>
@@ -182,7 +180,8 @@ const ProcessorInfo IntegralLineVectorToMesh::processorInfo_{
     Tags::CPU,                              // Tags
 };
 
-bool IntegralLineVectorToMesh::isFiltered(const IntegralLine& line, uint32_t idx) const {
+bool IntegralLineVectorToMesh::isFiltered(const IntegralLineSet::Line& line,
+                                          uint32_t idx) const {
     switch (brushBy_.get()) {
         case BrushBy::LineIndex:
             return brushingList_.isFiltered(line.getIndex());
@@ -194,7 +193,8 @@ bool IntegralLineVectorToMesh::isFiltered(const IntegralLine& line, uint32_t idx
     }
 }
 
-bool IntegralLineVectorToMesh::isSelected(const IntegralLine& line, uint32_t idx) const {
+bool IntegralLineVectorToMesh::isSelected(const IntegralLineSet::Line& line,
+                                          uint32_t idx) const {
     switch (brushBy_.get()) {
         case BrushBy::LineIndex:
             return brushingList_.isSelected(line.getIndex());
@@ -212,7 +212,7 @@ void IntegralLineVectorToMesh::updateOptions() {
 
     std::vector<OptionPropertyStringOption> options = {{"constant", "constant color"}};
 
-    for (const auto& key : lines->front().getMetaDataKeys()) {
+    for (const auto& key : lines->getMetaDataKeys()) {
         options.emplace_back(key, key);
 
         if (!getPropertyByIdentifier(key)) {
@@ -293,24 +293,26 @@ IntegralLineVectorToMesh::IntegralLineVectorToMesh()
 
             uint32_t idx = 0;
             const auto data = lines_.getData();
-            for (auto& line : *data) {
+            const auto* timestamps = data->hasMetaData("timestamp")
+                                         ? &data->getMetaData<double>("timestamp")
+                                         : nullptr;
+            for (const auto& line : *data) {
                 util::OnScopeExit incIdx([&idx]() { idx++; });
-                auto size = line.getPositions().size();
-                if (size == 0) continue;
+                if (line.size() == 0) continue;
 
                 if (this->isFiltered(line, idx)) {
                     continue;
                 }
 
-                if (!line.hasMetaData("timestamp")) {
+                if (!timestamps) {
                     minT = std::min(minT, 0.);
                     maxT = std::max(maxT, 1.);
                 } else {
-                    const auto& timestamp = line.getMetaData<double>("timestamp");
-                    for (const auto& t : timestamp) {
-                        minT = std::min(minT, t);
-                        maxT = std::max(t, maxT);
-                    }
+                    const auto [min, max] = std::minmax_element(
+                        timestamps->begin() + line.getOffset(),
+                        timestamps->begin() + line.getOffset() + line.size());
+                    minT = std::min(minT, *min);
+                    maxT = std::max(*max, maxT);
                 }
             }
             NetworkLock lock(getNetwork());
@@ -342,12 +344,9 @@ void IntegralLineVectorToMesh::process() {
         return;
     }
 
-    mesh->setModelMatrix(lines_.getData()->getModelMatrix());
-    mesh->setWorldMatrix(lines_.getData()->getWorldMatrix());
-
-    std::vector<BasicMesh::Vertex> vertices;
-
-    vertices.reserve(lines_.getData()->size() * 2000);
+    const auto data = lines_.getData();
+    mesh->setModelMatrix(data->getModelMatrix());
+    mesh->setWorldMatrix(data->getWorldMatrix());
 
     auto metaDataKey = colorBy_.get();
 
@@ -378,132 +377,131 @@ void IntegralLineVectorToMesh::process() {
 
     bool colorWarningOnce = true;
 
-    Output output = output_.get();
+    const Output output = output_.get();
+
+    // The vertices are written directly into the mesh buffers, the number of points in the set
+    // is an upper bound of the number of vertices needed.
+    const size_t maxVertices =
+        data->getPositions().size() * (output == Output::Ribbons ? size_t{2} : size_t{1});
+    auto& meshPositions = mesh->getTypedDataContainer<buffertraits::PositionsBuffer>();
+    auto& meshNormals = mesh->getTypedDataContainer<buffertraits::NormalBuffer>();
+    auto& meshTexCoords = mesh->getTypedDataContainer<buffertraits::TexCoordBuffer<3>>();
+    auto& meshColors = mesh->getTypedDataContainer<buffertraits::ColorsBuffer>();
+    meshPositions.reserve(maxVertices);
+    meshNormals.reserve(maxVertices);
+    meshTexCoords.reserve(maxVertices);
+    meshColors.reserve(maxVertices);
+
+    const auto addVertex = [&](const vec3& pos, const vec3& normal, const vec4& color) {
+        const auto index = static_cast<std::uint32_t>(meshPositions.size());
+        meshPositions.push_back(pos);
+        meshNormals.push_back(normal);
+        meshTexCoords.push_back(pos);
+        meshColors.push_back(color);
+        return index;
+    };
 
-    uint32_t lineIdx = 0;
-    const auto data = lines_.getData();
-    for (auto& line : *data) {
-        util::OnScopeExit incIdx([&lineIdx]() { lineIdx++; });
-        auto size = line.getPositions().size();
+    const auto& positions = data->getPositions();
+    const auto& velocities = data->getMetaData<dvec3>("velocity");
 
-        if (size == 0 || isFiltered(line, lineIdx)) continue;
+    // metaData(i) returns the norm of the selected meta data of point i in the set
+    auto buildMesh = [&](auto metaData) {
+        uint32_t lineIdx = 0;
+        for (const auto& line : *data) {
+            util::OnScopeExit incIdx([&lineIdx]() { lineIdx++; });
+            const auto size = line.size();
 
-        auto indexBuffer = [&]() -> std::shared_ptr<IndexBufferRAM> {
-            if (output == Output::Lines) {
-                auto ib = mesh->addIndexBuffer(DrawType::Lines, ConnectivityType::StripAdjacency);
-                ib->getDataContainer().reserve(size + 2);
-                return ib;
-            } else if (output == Output::Ribbons) {
-                auto ib = mesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::Strip);
-                ib->getDataContainer().reserve(size * 2);
-                return ib;
-            }
-            throw Exception("Unsupported output type");
-        }();
+            if (size == 0 || isFiltered(line, lineIdx)) continue;
 
-        auto coloring = [&, this](auto sample, uint32_t lineIndex, uint32_t lineNumber) -> vec4 {
-            if (constantColor || this->isSelected(line, lineIdx)) {
-                return selectedColor_.get();
-            }
-
-            if (colorByPort) {
-                auto colors = colors_.getData();
-                size_t index = 0;
-                if (colorByPortNumber) {
-                    index = lineNumber;
-                } else if (colorByPortIndex) {
-                    index = lineIndex;
+            auto coloring = [&, this](size_t pointIdx) -> vec4 {
+                if (constantColor || this->isSelected(line, lineIdx)) {
+                    return selectedColor_.get();
                 }
 
-                if (index >= colors->size()) {
-                    if (colorWarningOnce) {
-                        colorWarningOnce = false;
-                        log::warn("Line index for color is out of range");
+                if (colorByPort) {
+                    auto colors = colors_.getData();
+                    size_t index = 0;
+                    if (colorByPortNumber) {
+                        index = lineIdx;
+                    } else if (colorByPortIndex) {
+                        index = line.getIndex();
                     }
-                    index %= colors->size();
-                }
-                return colors->at(index);
-            } else {
-                auto& mdValue = get<2>(sample);
-                double md = detail::norm(mdValue);
-                minMetaData = std::min(minMetaData, md);
-                maxMetaData = std::max(maxMetaData, md);
-
-                md -= mdProp->scaleBy_.get().x;
-                md /= mdProp->scaleBy_.get().y - mdProp->scaleBy_.get().x;
-                if (mdProp->loopTF_) {
-                    md -= std::floor(md);
-                }
 
-                return mdProp->tf_.get().sample(md);
-            }
-        };
-
-        auto lineLoop = [&coloring, &vertices, &indexBuffer, &lineIdx, this](
-                            const IntegralLine& line, auto mdContainter) {
-            size_t pointIdx = 0;
-            for (auto&& sample : util::zip(line.getPositions(), line.getMetaData<dvec3>("velocity"),
-                                           mdContainter)) {
-                util::OnScopeExit incPointIdx([&pointIdx]() { pointIdx++; });
-                bool first = pointIdx <= 1;
-                bool last = pointIdx >= line.getPositions().size() - 2;
-                // need to keep the two first and two last when using adjendency information
-                if (!first && !last && pointIdx % stride_.get() != 0) {
-                    continue;
-                }
-
-                vec3 pos = get<0>(sample);
-                vec3 vel = get<1>(sample);
+                    if (index >= colors->size()) {
+                        if (colorWarningOnce) {
+                            colorWarningOnce = false;
+                            log::warn("Line index for color is out of range");
+                        }
+                        index %= colors->size();
+                    }
+                    return colors->at(index);
+                } else {
+                    double md = metaData(pointIdx);
+                    minMetaData = std::min(minMetaData, md);
+                    maxMetaData = std::max(maxMetaData, md);
+
+                    md -= mdProp->scaleBy_.get().x;
+                    md /= mdProp->scaleBy_.get().y - mdProp->scaleBy_.get().x;
+                    if (mdProp->loopTF_) {
+                        md -= std::floor(md);
+                    }
 
-                vec4 color = coloring(sample, line.getIndex(), lineIdx);
+                    return mdProp->tf_.get().sample(md);
+                }
+            };
 
-                indexBuffer->add(static_cast<std::uint32_t>(vertices.size()));
-                vertices.push_back({pos, glm::normalize(vel), pos, color});
-            }
-        };
-
-        auto ribbonLoop = [&coloring, &vertices, &indexBuffer, &lineIdx, this](
-                              const IntegralLine& line, auto mdContainter) {
-            for (auto&& sample : util::zip(line.getPositions(), line.getMetaData<dvec3>("velocity"),
-                                           mdContainter, line.getMetaData<dvec3>("vorticity"))) {
-                vec3 pos = get<0>(sample);
-                vec3 vel = get<1>(sample);
-                vec3 vor = get<3>(sample);
-
-                vec4 color = coloring(sample, line.getIndex(), lineIdx);
-
-                auto N = glm::normalize(glm::cross(vor, vel));
-
-                auto off = glm::normalize(vor) * (ribbonWidth_.get() / 2.0f);
-                auto pos1 = pos - off;
-                auto pos2 = pos + off;
-                indexBuffer->add(static_cast<std::uint32_t>(vertices.size()));
-                vertices.push_back({pos1, N, pos1, color});
-                indexBuffer->add(static_cast<std::uint32_t>(vertices.size()));
-                vertices.push_back({pos2, N, pos2, color});
-            }
-        };
-
-        if (mdProp) {
-            line.getMetaDataBuffer(metaDataKey)
-                ->getRepresentation<BufferRAM>()
-                ->dispatch<void>([&](auto mdBuf) {
-                    if (output == Output::Lines)
-                        lineLoop(line, mdBuf->getDataContainer());
-                    else {
-                        ribbonLoop(line, mdBuf->getDataContainer());
+            const auto begin = line.getOffset();
+            if (output == Output::Lines) {
+                auto& indices =
+                    mesh->addIndexBuffer(DrawType::Lines, ConnectivityType::StripAdjacency)
+                        ->getDataContainer();
+                indices.reserve(size + 2);
+
+                for (size_t pointIdx = 0; pointIdx < size; ++pointIdx) {
+                    const bool first = pointIdx <= 1;
+                    const bool last = pointIdx + 2 >= size;
+                    // need to keep the two first and two last when using adjendency information
+                    if (!first && !last && pointIdx % stride_.get() != 0) {
+                        continue;
                     }
-                });
-        } else {
-            if (output == Output::Lines)
-                lineLoop(line, std::vector<int>(line.getPositions().size()));
-            else {
-                ribbonLoop(line, std::vector<int>(line.getPositions().size()));
+                    const auto i = begin + pointIdx;
+                    const vec3 pos{positions[i]};
+                    const vec3 vel{velocities[i]};
+                    indices.push_back(addVertex(pos, glm::normalize(vel), coloring(i)));
+                }
+            } else if (output == Output::Ribbons) {
+                const auto& vorticities = data->getMetaData<dvec3>("vorticity");
+                auto& indices = mesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::Strip)
+                                    ->getDataContainer();
+                indices.reserve(size * 2);
+
+                for (size_t i = begin; i < begin + size; ++i) {
+                    const vec3 pos{positions[i]};
+                    const vec3 vel{velocities[i]};
+                    const vec3 vor{vorticities[i]};
+
+                    const auto color = coloring(i);
+                    const auto N = glm::normalize(glm::cross(vor, vel));
+                    const auto off = glm::normalize(vor) * (ribbonWidth_.get() / 2.0f);
+                    indices.push_back(addVertex(pos - off, N, color));
+                    indices.push_back(addVertex(pos + off, N, color));
+                }
+            } else {
+                throw Exception(SourceContext{}, "Unsupported output type");
             }
         }
-    }
+    };
 
-    mesh->addVertices(vertices);
+    if (mdProp) {
+        data->getMetaDataBuffer(metaDataKey)
+            ->getRepresentation<BufferRAM>()
+            ->dispatch<void>([&](auto mdBuf) {
+                const auto& md = mdBuf->getDataContainer();
+                buildMesh([&md](size_t i) { return detail::norm(md[i]); });
+            });
+    } else {
+        buildMesh([](size_t) { return 0.0; });
+    }
 
     mesh_.setData(mesh);
     if (mdProp) {
@@ -0,0 +1,203 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/vectorfieldvisualization/datastructures/integralline.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
+
+#include <inviwo/core/util/exception.h>
+
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using TerminationReason = IntegralLine::TerminationReason;
+
+IntegralLine makeLine(size_t size, double start, uint32_t index) {
+    IntegralLine line;
+    for (size_t i = 0; i < size; ++i) {
+        line.getPositions().emplace_back(start + static_cast<double>(i), 0.0, 0.0);
+        line.getMetaData<float>("speed", true).push_back(static_cast<float>(start + i));
+    }
+    line.setIndex(index);
+    line.setBackwardTerminationReason(TerminationReason::StartPoint);
+    line.setForwardTerminationReason(TerminationReason::OutOfBounds);
+    return line;
+}
+
+}  // namespace
+
+TEST(IntegralLineSet, PushBackIntegralLine) {
+    IntegralLineSet set{mat4{1}};
+    set.push_back(makeLine(3, 0.0, 7), IntegralLineSet::SetIndex::No);
+    set.push_back(makeLine(2, 10.0, 7), IntegralLineSet::SetIndex::Yes);
+
+    ASSERT_EQ(set.size(), 2u);
+    EXPECT_EQ(set.getOffsets(), (std::vector<size_t>{0, 3, 5}));
+    EXPECT_EQ(set.getPositions().size(), 5u);
+    EXPECT_EQ(set.getMetaData<float>("speed"), (std::vector<float>{0, 1, 2, 10, 11}));
+
+    EXPECT_EQ(set[0].getIndex(), 7u);
+    EXPECT_EQ(set[1].getIndex(), 1u);
+    EXPECT_EQ(set.back().size(), 2u);
+    EXPECT_EQ(set.back().getPositions()[1], dvec3(11.0, 0.0, 0.0));
+    EXPECT_EQ(set.back().getMetaData<float>("speed")[0], 10.0f);
+    EXPECT_DOUBLE_EQ(set.front().getLength(), 2.0);
+    EXPECT_EQ(set[0].getBackwardTerminationReason(), TerminationReason::StartPoint);
+    EXPECT_EQ(set[0].getForwardTerminationReason(), TerminationReason::OutOfBounds);
+
+    const auto line = set[1].toIntegralLine();
+    EXPECT_EQ(line.getPositions(), (std::vector<dvec3>{{10, 0, 0}, {11, 0, 0}}));
+    EXPECT_EQ(line.getMetaData<float>("speed"), (std::vector<float>{10, 11}));
+    EXPECT_EQ(line.getIndex(), 1u);
+    EXPECT_EQ(line.getBackwardTerminationReason(), TerminationReason::StartPoint);
+    EXPECT_EQ(line.getForwardTerminationReason(), TerminationReason::OutOfBounds);
+}
+
+TEST(IntegralLineSet, MismatchingMetaDataLeavesSetUnchanged) {
+    IntegralLineSet set{mat4{1}};
+    auto first = makeLine(3, 0.0, 0);
+    first.getMetaData<int>("weight", true).assign(3, 1);
+    set.push_back(first, IntegralLineSet::SetIndex::Yes);
+
+    // "weight" is checked after "speed", which must not have been appended
+    auto wrongFormat = makeLine(2, 5.0, 1);
+    wrongFormat.getMetaData<float>("weight", true).assign(2, 1.0f);
+    EXPECT_THROW(set.push_back(wrongFormat, IntegralLineSet::SetIndex::Yes), Exception);
+
+    auto missingKey = makeLine(2, 5.0, 1);
+    missingKey.getMetaData<int>("other", true).assign(2, 1);
+    EXPECT_THROW(set.push_back(missingKey, IntegralLineSet::SetIndex::Yes), Exception);
+
+    EXPECT_THROW(set.push_back(makeLine(2, 5.0, 1), IntegralLineSet::SetIndex::Yes), Exception);
+
+    ASSERT_EQ(set.size(), 1u);
+    EXPECT_EQ(set.getPositions().size(), 3u);
+    EXPECT_EQ(set.getMetaData<float>("speed").size(), 3u);
+    EXPECT_EQ(set.getMetaData<int>("weight").size(), 3u);
+    EXPECT_EQ(set.getNumberOfPendingPoints(), 0u);
+
+    set.push_back(first, IntegralLineSet::SetIndex::Yes);
+    EXPECT_EQ(set.size(), 2u);
+}
+
+TEST(IntegralLineSet, PushBackLineAndAppend) {
+    IntegralLineSet a{mat4{1}};
+    a.push_back(makeLine(3, 0.0, 0), IntegralLineSet::SetIndex::Yes);
+    a.push_back(makeLine(4, 10.0, 1), IntegralLineSet::SetIndex::Yes);
+
+    IntegralLineSet b{mat4{1}};
+    b.push_back(a[1], IntegralLineSet::SetIndex::Yes);
+    ASSERT_EQ(b.size(), 1u);
+    EXPECT_EQ(b[0].getIndex(), 0u);
+    EXPECT_EQ(b.getMetaData<float>("speed"), (std::vector<float>{10, 11, 12, 13}));
+
+    b.append(a);
+    ASSERT_EQ(b.size(), 3u);
+    EXPECT_EQ(b.getOffsets(), (std::vector<size_t>{0, 4, 7, 11}));
+    EXPECT_EQ(b[1].getIndex(), 0u);
+    EXPECT_EQ(b[2].getIndex(), 1u);
+    EXPECT_EQ(b[1].getPositions()[0], dvec3(0.0, 0.0, 0.0));
+    EXPECT_EQ(b.getMetaData<float>("speed").size(), 11u);
+
+    const IntegralLineSet copy{b};
+    EXPECT_EQ(copy.getOffsets(), b.getOffsets());
+    EXPECT_NE(copy.getMetaDataBuffer("speed"), b.getMetaDataBuffer("speed"));
+    EXPECT_EQ(copy.getMetaData<float>("speed"), b.getMetaData<float>("speed"));
+}
+
+TEST(IntegralLineSet, PendingPoints) {
+    IntegralLineSet set{mat4{1}};
+    set.push_back(makeLine(2, 0.0, 0), IntegralLineSet::SetIndex::Yes);
+
+    auto& positions = set.getEditablePositions();
+    auto& speed = set.getEditableMetaData<float>("speed");
+    for (int i = 0; i < 3; ++i) {
+        positions.emplace_back(i, 1.0, 0.0);
+        speed.push_back(static_cast<float>(i));
+    }
+    EXPECT_EQ(set.getNumberOfPendingPoints(), 3u);
+    EXPECT_THROW(set.append(set), Exception);
+
+    set.reversePendingPoints();
+    EXPECT_EQ(set.getPositions()[2], dvec3(2.0, 1.0, 0.0));
+    EXPECT_EQ(set.getMetaData<float>("speed")[2], 2.0f);
+    EXPECT_EQ(set.getPositions()[0], dvec3(0.0, 0.0, 0.0));
+
+    set.commitLine(5, TerminationReason::Steps, TerminationReason::ZeroVelocity);
+    ASSERT_EQ(set.size(), 2u);
+    EXPECT_EQ(set.getNumberOfPendingPoints(), 0u);
+    EXPECT_EQ(set[1].getIndex(), 5u);
+    EXPECT_EQ(set[1].getBackwardTerminationReason(), TerminationReason::Steps);
+    EXPECT_EQ(set[1].getForwardTerminationReason(), TerminationReason::ZeroVelocity);
+
+    set.getEditablePositions().emplace_back(9.0, 9.0, 9.0);
+    // The meta data column has no value for the pending point
+    EXPECT_THROW(set.commitLine(6), Exception);
+    set.discardPendingPoints();
+    EXPECT_EQ(set.getPositions().size(), 5u);
+    EXPECT_EQ(set.size(), 2u);
+
+    // New columns are filled with zeros for the existing points
+    EXPECT_EQ(set.getEditableMetaData<int>("new"), std::vector<int>(5, 0));
+    EXPECT_THROW(set.getEditableMetaData<double>("new"), Exception);
+}
+
+TEST(IntegralLineSet, MovedFrom) {
+    IntegralLineSet set{mat4{1}};
+    set.push_back(makeLine(3, 0.0, 0), IntegralLineSet::SetIndex::Yes);
+
+    IntegralLineSet moved{std::move(set)};
+    EXPECT_EQ(moved.size(), 1u);
+
+    // NOLINTBEGIN(bugprone-use-after-move)
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.getNumberOfPendingPoints(), 0u);
+    EXPECT_THROW(set.back(), Exception);
+    EXPECT_THROW(set.front(), Exception);
+    set.discardPendingPoints();
+    set.reversePendingPoints();
+
+    // A moved from set can be used again
+    set.push_back(makeLine(2, 0.0, 0), IntegralLineSet::SetIndex::Yes);
+    set.append(moved);
+    ASSERT_EQ(set.size(), 2u);
+    EXPECT_EQ(set.getOffsets(), (std::vector<size_t>{0, 2, 5}));
+    EXPECT_EQ(set.back().size(), 3u);
+    // NOLINTEND(bugprone-use-after-move)
+}
+
+}  // namespace inviwo
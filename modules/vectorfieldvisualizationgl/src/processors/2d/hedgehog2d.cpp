@@ -42,10 +42,12 @@
 #include <inviwo/core/util/glmmat.h>
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/imagesampler.h>
+#include <inviwo/core/util/zip.h>
 
 #include <cmath>
 #include <memory>
 #include <numbers>
+#include <vector>
 
 #include <glm/geometric.hpp>
 #include <glm/mat2x2.hpp>
@@ -272,6 +274,8 @@ void HedgeHog2D::process() {
         .scaling = glyphScale_ * glm::compMin(delta),
     };
 
+    std::vector<dvec3> positions;
+    positions.reserve(static_cast<size_t>(numberOfGlyphs_.get().x) * numberOfGlyphs_.get().y);
     for (int j = 0; j < numberOfGlyphs_.get().y; j++) {
         vec2 center{0.0f, static_cast<float>(j) * delta.y + deltaHalf.y};
         for (int i = 0; i < numberOfGlyphs_.get().x; i++) {
@@ -281,23 +285,29 @@ void HedgeHog2D::process() {
             if (jitter_) {
                 pos += vec2{jitterx(rand_), jittery(rand_)} * jitterScale_.get();
             }
-
-            dvec2 velocity{sampler.sample(pos)};
-            velocity = dataMap.mapFromDataToValue(velocity);
-
-            const auto normalizedMagnitude = glm::length(velocity) / conservativeMax;
-            const vec4 color = getColor(normalizedMagnitude);
-            const auto length = normalized_ ? 1.0f : static_cast<float>(normalizedMagnitude);
-
-            switch (glyphType_) {
-                case GlyphType::Quiver:
-                    addQuiver(*mesh, *indexBuffer, config, pos, velocity, length, color);
-                    break;
-                case GlyphType::Arrow:
-                default:
-                    addArrow(*mesh, *indexBuffer, config, pos, velocity, length, color);
-                    break;
-            }
+            positions.emplace_back(pos, 0.0);
+        }
+    }
+    std::vector<dvec4> samples(positions.size());
+    sampler.sample(positions, samples);
+
+    for (auto&& [p, sample] : util::zip(positions, samples)) {
+        const vec2 pos{p};
+        dvec2 velocity{sample};
+        velocity = dataMap.mapFromDataToValue(velocity);
+
+        const auto normalizedMagnitude = glm::length(velocity) / conservativeMax;
+        const vec4 color = getColor(normalizedMagnitude);
+        const auto length = normalized_ ? 1.0f : static_cast<float>(normalizedMagnitude);
+
+        switch (glyphType_) {
+            case GlyphType::Quiver:
+                addQuiver(*mesh, *indexBuffer, config, pos, velocity, length, color);
+                break;
+            case GlyphType::Arrow:
+            default:
+                addArrow(*mesh, *indexBuffer, config, pos, velocity, length, color);
+                break;
         }
     }
 
@@ -0,0 +1,129 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/util/logcentral.h>
+#include <modules/base/algorithm/volume/volumevoronoi.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+std::vector<std::pair<uint32_t, vec3>> randomSeeds(size_t count) {
+    std::mt19937 rand{0};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<std::pair<uint32_t, vec3>> seeds;
+    for (size_t i = 0; i < count; ++i) {
+        seeds.emplace_back(static_cast<uint32_t>(i + 1), vec3{dist(rand), dist(rand), dist(rand)});
+    }
+    return seeds;
+}
+
+std::vector<float> randomWeights(size_t count) {
+    std::mt19937 rand{1};
+    std::uniform_real_distribution<float> dist{0.0f, 0.05f};
+    std::vector<float> weights(count);
+    std::generate(weights.begin(), weights.end(), [&]() { return dist(rand); });
+    return weights;
+}
+
+// args: volume size, number of seeds, number of threads (0 means serial)
+void voronoi(benchmark::State& state, const Wrapping3D& wrapping, bool weighted) {
+    const size3_t dims{static_cast<size_t>(state.range(0))};
+    const auto nSeeds = static_cast<size_t>(state.range(1));
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(2)));
+
+    const auto seeds = randomSeeds(nSeeds);
+    const auto weights =
+        weighted ? std::optional<std::vector<float>>{randomWeights(nSeeds)} : std::nullopt;
+
+    for (auto _ : state) {
+        auto volume =
+            util::voronoiSegmentation(dims, mat4{1.0f}, mat4{1.0f}, seeds, wrapping, weights);
+        benchmark::DoNotOptimize(volume);
+    }
+    state.counters["Voxels"] = benchmark::Counter(
+        static_cast<double>(dims.x * dims.y * dims.z) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+constexpr Wrapping3D clamp{Wrapping::Clamp, Wrapping::Clamp, Wrapping::Clamp};
+constexpr Wrapping3D repeat{Wrapping::Repeat, Wrapping::Repeat, Wrapping::Repeat};
+
+void Voronoi(benchmark::State& state) { voronoi(state, clamp, false); }
+void VoronoiWeighted(benchmark::State& state) { voronoi(state, clamp, true); }
+void VoronoiPeriodic(benchmark::State& state) { voronoi(state, repeat, false); }
+
+void seedScaling(benchmark::internal::Benchmark* b) {
+    // seed indices start at 1 and have to fit in an unsigned short
+    for (int64_t seeds : {16, 256, 4096, 65535}) {
+        b->Args({128, seeds, 0});
+    }
+}
+
+void threadScaling(benchmark::internal::Benchmark* b) {
+    const auto maxThreads = static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int64_t size : {128, 256}) {
+        b->Args({size, 4096, 0});
+        for (int64_t threads = 1; threads <= maxThreads; threads *= 2) {
+            b->Args({size, 4096, threads});
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK(Voronoi)->Apply(seedScaling)->UseRealTime();
+BENCHMARK(Voronoi)->Apply(threadScaling)->UseRealTime();
+BENCHMARK(VoronoiWeighted)->Apply(seedScaling)->UseRealTime();
+BENCHMARK(VoronoiPeriodic)->Apply(seedScaling)->UseRealTime();
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-Voronoi");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
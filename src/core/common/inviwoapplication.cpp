@@ -182,6 +182,10 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
 
     resizePool(systemSettings_->poolSize_);
     systemSettings_->poolSize_.onChange([this]() { resizePool(systemSettings_->poolSize_); });
+    processorNetworkEvaluator_->setParallelEvaluation(systemSettings_->parallelEvaluation_);
+    systemSettings_->parallelEvaluation_.onChange([this]() {
+        processorNetworkEvaluator_->setParallelEvaluation(systemSettings_->parallelEvaluation_);
+    });
 
     workspaceManager_->registerFactory(getProcessorFactory());
     workspaceManager_->registerFactory(getMetaDataFactory());
@@ -105,6 +105,13 @@ void HistogramCache::forEach(
     }
 }
 
+void HistogramCache::set(std::vector<Histogram1D> histograms) {
+    const std::scoped_lock lock{state_->mutex};
+    state_->histograms = std::move(histograms);
+    state_->status = Status::Valid;
+    state_->callbacks.invoke(state_->histograms);
+}
+
 void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& calculate) {
     bool reCalculate = false;
     std::shared_ptr<State> newState;
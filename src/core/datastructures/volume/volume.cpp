@@ -269,6 +269,10 @@ auto histCalc(const Volume& v) {
 
 void Volume::discardHistograms() { histograms_.discard(histCalc(*this)); }
 
+void Volume::setHistograms(std::vector<Histogram1D> histograms) {
+    histograms_.set(std::move(histograms));
+}
+
 HistogramCache::Result Volume::calculateHistograms(
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const {
     return histograms_.calculateHistograms(histCalc(*this), whenDone);
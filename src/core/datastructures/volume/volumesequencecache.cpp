@@ -0,0 +1,260 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumesequencecache.h>
+
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+VolumeSequenceCache::VolumeSequenceCache(size_t byteBudget, size_t prefetchCount)
+    : byteBudget_{byteBudget}, prefetchCount_{prefetchCount} {}
+
+VolumeSequenceCache::~VolumeSequenceCache() { waitForPending(); }
+
+void VolumeSequenceCache::setSequence(std::shared_ptr<const VolumeSequence> sequence) {
+    if (sequence == sequence_) return;
+    waitForPending();
+
+    const std::scoped_lock lock{mutex_};
+    sequence_ = std::move(sequence);
+    lru_.clear();
+    loaded_.clear();
+    last_ = 0;
+    forward_ = true;
+    stats_.loaded = 0;
+    stats_.bytes = 0;
+}
+
+std::shared_ptr<const Volume> VolumeSequenceCache::get(size_t index) {
+    std::shared_ptr<const Volume> volume;
+    std::shared_future<void> pending;
+    {
+        const std::scoped_lock lock{mutex_};
+        if (!sequence_ || index >= sequence_->size()) return nullptr;
+        volume = (*sequence_)[index];
+        if (const auto it = pending_.find(index); it != pending_.end()) pending = it->second;
+    }
+    if (!volume || !isStreamable(*volume)) return volume;
+
+    if (pending.valid()) pending.wait();
+
+    const bool hit = [&]() {
+        const std::scoped_lock lock{mutex_};
+        return loaded_.contains(index);
+    }();
+    if (!hit) {
+        volume->getRepresentation<VolumeRAM>();
+    }
+
+    {
+        const std::scoped_lock lock{mutex_};
+        ++(hit ? stats_.hits : stats_.misses);
+        if (index != last_) forward_ = index > last_;
+        last_ = index;
+        touch(index, sizeInBytes(*volume));
+        evict({index}, pendingBytes_);
+    }
+    prefetch(index);
+
+    return volume;
+}
+
+void VolumeSequenceCache::setByteBudget(size_t bytes) {
+    const std::scoped_lock lock{mutex_};
+    byteBudget_ = bytes;
+}
+
+size_t VolumeSequenceCache::getByteBudget() const {
+    const std::scoped_lock lock{mutex_};
+    return byteBudget_;
+}
+
+void VolumeSequenceCache::setPrefetchCount(size_t count) {
+    const std::scoped_lock lock{mutex_};
+    prefetchCount_ = count;
+}
+
+size_t VolumeSequenceCache::getPrefetchCount() const {
+    const std::scoped_lock lock{mutex_};
+    return prefetchCount_;
+}
+
+VolumeSequenceCache::Stats VolumeSequenceCache::getStats() const {
+    const std::scoped_lock lock{mutex_};
+    return stats_;
+}
+
+void VolumeSequenceCache::resetStats() {
+    const std::scoped_lock lock{mutex_};
+    stats_ = Stats{.loaded = stats_.loaded, .bytes = stats_.bytes};
+}
+
+void VolumeSequenceCache::clear() {
+    waitForPending();
+
+    const std::scoped_lock lock{mutex_};
+    for (const auto index : lru_) {
+        const auto volume = (*sequence_)[index];
+        if (volume.use_count() > 2) continue;
+        volume->releaseOtherRepresentations<VolumeDisk>();
+    }
+    lru_.clear();
+    loaded_.clear();
+    stats_.loaded = 0;
+    stats_.bytes = 0;
+}
+
+bool VolumeSequenceCache::isStreamable(const Volume& volume) {
+    return volume.hasRepresentation<VolumeDisk>();
+}
+
+size_t VolumeSequenceCache::sizeInBytes(const Volume& volume) {
+    return glm::compMul(volume.getDimensions()) * volume.getDataFormat()->getSizeInBytes();
+}
+
+void VolumeSequenceCache::waitForPending() {
+    std::vector<std::shared_future<void>> pending;
+    {
+        const std::scoped_lock lock{mutex_};
+        for (const auto& item : pending_) {
+            pending.push_back(item.second);
+        }
+    }
+    for (const auto& future : pending) {
+        future.wait();
+    }
+}
+
+void VolumeSequenceCache::touch(size_t index, size_t bytes) {
+    if (const auto it = loaded_.find(index); it != loaded_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+    } else {
+        lru_.push_front(index);
+        loaded_.emplace(index, Entry{lru_.begin(), bytes});
+        stats_.bytes += bytes;
+        stats_.loaded = loaded_.size();
+    }
+}
+
+void VolumeSequenceCache::evict(const std::vector<size_t>& keep, size_t reserve) {
+    auto it = lru_.end();
+    while (stats_.bytes + reserve > byteBudget_ && it != lru_.begin()) {
+        --it;
+        const auto index = *it;
+        if (std::ranges::find(keep, index) != keep.end() || pending_.contains(index)) continue;
+
+        // Volumes that are referenced outside of the sequence might have their representations in
+        // use, releasing them would invalidate those. The sequence and our copy make two owners.
+        const auto volume = (*sequence_)[index];
+        if (volume.use_count() > 2) continue;
+
+        // Volumes that have been modified since loading can not be reloaded from disk, and are
+        // only dropped from the bookkeeping.
+        if (volume->releaseOtherRepresentations<VolumeDisk>()) {
+            ++stats_.evictions;
+        }
+        stats_.bytes -= loaded_[index].bytes;
+        loaded_.erase(index);
+        it = lru_.erase(it);
+    }
+    stats_.loaded = loaded_.size();
+}
+
+void VolumeSequenceCache::prefetch(size_t index) {
+    if (util::getPoolSize() == 0) return;
+
+    const std::scoped_lock lock{mutex_};
+
+    // Select the following volumes that fit within the budget together with the current volume
+    const auto current = loaded_.find(index);
+    if (current == loaded_.end()) return;
+    size_t budget = byteBudget_ - std::min(byteBudget_, current->second.bytes);
+    std::vector<size_t> keep{index};
+    std::vector<std::pair<size_t, std::shared_ptr<const Volume>>> toLoad;
+    size_t required = 0;
+    for (size_t i = 1; i <= prefetchCount_; ++i) {
+        if (!forward_ && i > index) break;
+        const size_t next = forward_ ? index + i : index - i;
+        if (next >= sequence_->size()) break;
+
+        auto volume = (*sequence_)[next];
+        if (!volume || !isStreamable(*volume)) continue;
+        const auto bytes = sizeInBytes(*volume);
+        if (bytes > budget) break;
+        budget -= bytes;
+        keep.push_back(next);
+
+        if (loaded_.contains(next) || pending_.contains(next)) continue;
+        toLoad.emplace_back(next, std::move(volume));
+        required += bytes;
+    }
+
+    // Make room for the new volumes, the loaded and in flight volumes count against the budget
+    evict(keep, pendingBytes_ + required);
+
+    for (auto& item : toLoad) {
+        const auto next = item.first;
+        auto volume = std::move(item.second);
+        const auto bytes = sizeInBytes(*volume);
+        if (stats_.bytes + pendingBytes_ + bytes > byteBudget_) break;
+        pendingBytes_ += bytes;
+
+        auto load = [this, volume = std::move(volume), next, bytes]() {
+            bool success = false;
+            try {
+                volume->getRepresentation<VolumeRAM>();
+                success = true;
+            } catch (const Exception& e) {
+                log::exception(e);
+            } catch (const std::exception& e) {
+                log::exception(e);
+            }
+            const std::scoped_lock taskLock{mutex_};
+            pending_.erase(next);
+            pendingBytes_ -= bytes;
+            if (success) {
+                ++stats_.prefetched;
+                touch(next, bytes);
+            }
+        };
+        pending_[next] = util::dispatchPool(std::move(load)).share();
+    }
+}
+
+}  // namespace inviwo
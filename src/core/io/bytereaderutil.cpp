@@ -28,32 +28,119 @@
  *********************************************************************************/
 
 #include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/chunkedrawfile.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/io/curlutils.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/util/threadutil.h>
 
 #include <bxzstr/bxzstr.hpp>
 
 #include <fmt/format.h>
 #include <fmt/std.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <future>
 #include <memory>
+#include <vector>
 
 namespace inviwo {
 
-void util::reverseByteOrder(void* dest, size_t bytes, size_t elementSize) {
-    auto temp = std::make_unique<char[]>(elementSize);
+namespace {
+
+template <typename U>
+void swapElements(std::byte* data, size_t count) {
+    // memcpy avoids alignment and aliasing issues, the compilers turns it and std::byteswap
+    // into plain (vectorized) loads, bswap/shuffles and stores.
+    for (size_t i = 0; i < count; ++i) {
+        U value;
+        std::memcpy(&value, data + i * sizeof(U), sizeof(U));
+        value = std::byteswap(value);
+        std::memcpy(data + i * sizeof(U), &value, sizeof(U));
+    }
+}
+
+/**
+ * Swaps blocks of read data on the thread pool while the next block is read. Falls back to
+ * swapping on the calling thread if there is no thread pool.
+ */
+class ByteSwapper {
+public:
+    ByteSwapper(ByteOrder byteOrder, size_t elementSize)
+        : enabled_{byteOrder == ByteOrder::BigEndian && elementSize > 1}
+        , elementSize_{elementSize}
+        , blockSize_{std::max(size_t{1}, (size_t{4} << 20) / elementSize) * elementSize}
+        , parallel_{util::getPoolSize() > 0} {}
+    ByteSwapper(const ByteSwapper&) = delete;
+    ByteSwapper& operator=(const ByteSwapper&) = delete;
+    ~ByteSwapper() {
+        if (futures_.empty()) return;
+        auto& pool = util::getThreadPool();
+        for (auto& f : futures_) pool.wait(f);
+    }
+
+    /**
+     * The block size to use when reading, to swap the data while it is still in the cache
+     */
+    size_t blockSize(size_t maxBlockSize) const {
+        return enabled_ ? blockSize_ : maxBlockSize;
+    }
 
-    for (std::size_t i = 0; i < bytes; i += elementSize) {
-        for (std::size_t j = 0; j < elementSize; j++) {
-            temp[j] = static_cast<char*>(dest)[i + j];
+    void swap(void* data, size_t bytes) {
+        if (!enabled_) return;
+        if (parallel_) {
+            futures_.push_back(util::dispatchPool([data, bytes, elementSize = elementSize_]() {
+                util::reverseByteOrder(data, bytes, elementSize);
+            }));
+        } else {
+            util::reverseByteOrder(data, bytes, elementSize_);
         }
+    }
 
-        for (std::size_t j = 0; j < elementSize; j++) {
-            static_cast<char*>(dest)[i + j] = temp[elementSize - j - 1];
+    void wait() {
+        if (futures_.empty()) return;
+        // help out if called from within the pool, to not dead lock on a busy pool.
+        auto& pool = util::getThreadPool();
+        for (auto& f : futures_) {
+            pool.wait(f);
+            f.get();
         }
+        futures_.clear();
+    }
+
+private:
+    bool enabled_;
+    size_t elementSize_;
+    size_t blockSize_;
+    bool parallel_;
+    std::vector<std::future<void>> futures_;
+};
+
+}  // namespace
+
+void util::reverseByteOrder(void* dest, size_t bytes, size_t elementSize) {
+    auto* data = static_cast<std::byte*>(dest);
+    const auto count = bytes / elementSize;
+    switch (elementSize) {
+        case 1:
+            return;
+        case 2:
+            return swapElements<std::uint16_t>(data, count);
+        case 4:
+            return swapElements<std::uint32_t>(data, count);
+        case 8:
+            return swapElements<std::uint64_t>(data, count);
+        default:
+            for (size_t i = 0; i < count; ++i) {
+                std::reverse(data + i * elementSize, data + (i + 1) * elementSize);
+            }
     }
 }
 
@@ -67,13 +154,29 @@ void util::readBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
     }
     const util::OnScopeExit closeFile{[file]() { std::fclose(file); }};
 
-    std::fseek(file, static_cast<long>(offset), SEEK_SET);
-    if (std::fread(static_cast<char*>(dest), bytes, 1, file) != 1) {
-        throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}", path);
+    // long is only 32 bit on Windows, use the 64 bit versions to support large offsets
+#ifdef WIN32
+    const bool seeked = _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    const bool seeked = fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    if (!seeked) {
+        throw DataReaderException(SourceContext{}, "Could not seek to offset {} in file: {:?g}",
+                                  offset, path);
     }
-    if (byteOrder == ByteOrder::BigEndian && elementSize > 1) {
-        util::reverseByteOrder(dest, bytes, elementSize);
+    // Read in blocks, some platforms can not handle reads larger than 2GB in one call.
+    // Big endian data is read in smaller blocks and swapped while the next block is read.
+    ByteSwapper swapper{byteOrder, elementSize};
+    const auto blockSize = swapper.blockSize(size_t{1} << 30);
+    for (size_t pos = 0; pos < bytes; pos += blockSize) {
+        const auto size = std::min(blockSize, bytes - pos);
+        auto* block = static_cast<char*>(dest) + pos;
+        if (std::fread(block, size, 1, file) != 1) {
+            throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}", path);
+        }
+        swapper.swap(block, size);
     }
+    swapper.wait();
 }
 
 void util::readCompressedBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
@@ -85,14 +188,62 @@ void util::readCompressedBytesIntoBuffer(const std::filesystem::path& path, size
 
     if (fin.good()) {
         fin.seekg(static_cast<std::streamoff>(offset));
-        fin.read(static_cast<char*>(dest), static_cast<std::streamsize>(bytes));
 
-        if (byteOrder == ByteOrder::BigEndian && elementSize > 1) {
-            util::reverseByteOrder(dest, bytes, elementSize);
+        ByteSwapper swapper{byteOrder, elementSize};
+        const auto blockSize = swapper.blockSize(bytes);
+        for (size_t pos = 0; pos < bytes; pos += blockSize) {
+            const auto size = std::min(blockSize, bytes - pos);
+            auto* block = static_cast<char*>(dest) + pos;
+            fin.read(block, static_cast<std::streamsize>(size));
+            swapper.swap(block, size);
         }
+        swapper.wait();
     } else {
         throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}", path);
     }
 }
 
+void util::readChunkedBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
+                                      size_t bytes, ByteOrder byteOrder, size_t elementSize,
+                                      void* dest) {
+    const ChunkedRawFile file{path};
+    file.read(offset, bytes, dest);
+
+    ByteSwapper swapper{byteOrder, elementSize};
+    const auto blockSize = swapper.blockSize(bytes);
+    for (size_t pos = 0; pos < bytes; pos += blockSize) {
+        swapper.swap(static_cast<char*>(dest) + pos, std::min(blockSize, bytes - pos));
+    }
+    swapper.wait();
+}
+
+void util::readChunkedBrickIntoBuffer(const std::filesystem::path& path, size_t offset,
+                                      size3_t dims, size3_t brickOffset, size3_t brickDims,
+                                      ByteOrder byteOrder, size_t elementSize, void* dest) {
+    const ChunkedRawFile file{path};
+    file.readBrick(offset, dims, elementSize, brickOffset, brickDims, dest);
+
+    const auto bytes = brickDims.x * brickDims.y * brickDims.z * elementSize;
+    ByteSwapper swapper{byteOrder, elementSize};
+    const auto blockSize = swapper.blockSize(bytes);
+    for (size_t pos = 0; pos < bytes; pos += blockSize) {
+        swapper.swap(static_cast<char*>(dest) + pos, std::min(blockSize, bytes - pos));
+    }
+    swapper.wait();
+}
+
+void util::readBytesIntoBuffer(const std::filesystem::path& path, size_t offset, size_t bytes,
+                               ByteOrder byteOrder, size_t elementSize, Compression compression,
+                               void* dest) {
+    switch (compression) {
+        case Compression::Disabled:
+            return readBytesIntoBuffer(path, offset, bytes, byteOrder, elementSize, dest);
+        case Compression::Enabled:
+            return readCompressedBytesIntoBuffer(path, offset, bytes, byteOrder, elementSize,
+                                                 dest);
+        case Compression::Chunked:
+            return readChunkedBytesIntoBuffer(path, offset, bytes, byteOrder, elementSize, dest);
+    }
+}
+
 }  // namespace inviwo
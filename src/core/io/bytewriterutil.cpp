@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <inviwo/core/io/bytewriterutil.h>
+#include <inviwo/core/io/chunkedrawfile.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/filesystem.h>
@@ -75,10 +76,13 @@ void writeCompressedBytes(const std::filesystem::path& path, const void* source,
 
 void util::writeBytes(const std::filesystem::path& path, const void* source, size_t bytes,
                       Compression compression) {
-    if (compression == Compression::Enabled) {
-        writeCompressedBytes(path, source, bytes);
-    } else {
-        writeUncompressedBytes(path, source, bytes);
+    switch (compression) {
+        case Compression::Disabled:
+            return writeUncompressedBytes(path, source, bytes);
+        case Compression::Enabled:
+            return writeCompressedBytes(path, source, bytes);
+        case Compression::Chunked:
+            return ChunkedRawFile::write(path, source, bytes);
     }
 }
 
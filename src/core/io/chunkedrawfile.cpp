@@ -0,0 +1,379 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/chunkedrawfile.h>
+#include <inviwo/core/io/curlutils.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/glmfmt.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <zlib.h>
+
+#include <glm/vector_relational.hpp>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array<char, 8> chunkMagic{'i', 'v', 'w', 'c', 'h', 'u', 'n', 'k'};
+constexpr std::uint64_t chunkVersion = 1;
+constexpr size_t headerSize = chunkMagic.size() + 4 * sizeof(std::uint64_t);
+// zlib uses unsigned long for sizes, which is 32 bit on Windows
+constexpr size_t maxChunkSize = size_t{1} << 30;
+
+bool seek(FILE* file, size_t offset) {
+    // long is only 32 bit on Windows, use the 64 bit versions to support large offsets
+#ifdef WIN32
+    return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+// The header is stored little endian, only swap on big endian hosts
+std::uint64_t toLittleEndian(std::uint64_t value) {
+    if constexpr (std::endian::native == std::endian::big) {
+        return std::byteswap(value);
+    } else {
+        return value;
+    }
+}
+
+/**
+ * Runs the chunk tasks on the thread pool if there is one, otherwise directly on the calling
+ * thread.
+ */
+template <typename T>
+class ChunkTasks {
+public:
+    ChunkTasks() : parallel_{util::getPoolSize() > 0} {}
+    ChunkTasks(const ChunkTasks&) = delete;
+    ChunkTasks& operator=(const ChunkTasks&) = delete;
+    ~ChunkTasks() {
+        // Never leave tasks behind that refer to data on the stack
+        if (!parallel_) return;
+        auto& pool = util::getThreadPool();
+        for (auto& f : futures_) {
+            if (f.valid()) pool.wait(f);
+        }
+    }
+
+    template <typename F>
+    void add(F&& task) {
+        if (parallel_) {
+            futures_.push_back(util::dispatchPool(std::forward<F>(task)));
+        } else {
+            std::promise<T> promise;
+            if constexpr (std::is_void_v<T>) {
+                task();
+                promise.set_value();
+            } else {
+                promise.set_value(task());
+            }
+            futures_.push_back(promise.get_future());
+        }
+    }
+
+    // help out if called from within the pool, to not dead lock on a busy pool.
+    T get(size_t i) {
+        if (parallel_) util::getThreadPool().wait(futures_[i]);
+        return futures_[i].get();
+    }
+
+    void wait() {
+        for (size_t i = 0; i < futures_.size(); ++i) get(i);
+    }
+
+private:
+    bool parallel_;
+    std::vector<std::future<T>> futures_;
+};
+
+}  // namespace
+
+ChunkedRawFile::ChunkedRawFile(const std::filesystem::path& path)
+    : path_{net::downloadAndCacheIfUrl(path)}, size_{0}, chunkSize_{0}, offsets_{} {
+
+    FILE* file = filesystem::fopen(path_, "rb");
+    if (!file) {
+        throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+    const util::OnScopeExit closeFile{[file]() { std::fclose(file); }};
+
+    std::array<char, 8> magic{};
+    std::array<std::uint64_t, 4> header{};
+    if (std::fread(magic.data(), magic.size(), 1, file) != 1 ||
+        std::fread(header.data(), sizeof(header), 1, file) != 1 || magic != chunkMagic) {
+        throw DataReaderException(SourceContext{}, "Not a chunked raw file: {:?g}", path);
+    }
+    for (auto& item : header) item = toLittleEndian(item);
+    const auto [version, size, chunkSize, count] = header;
+
+    if (version != chunkVersion) {
+        throw DataReaderException(SourceContext{}, "Unsupported chunked raw version {} in: {:?g}",
+                                  version, path);
+    }
+
+    std::error_code ec;
+    const auto fileSize = static_cast<std::uint64_t>(std::filesystem::file_size(path_, ec));
+    if (ec) {
+        throw DataReaderException(SourceContext{}, "Could not read size of file: {:?g}", path);
+    }
+
+    // Validate the header against the file size before allocating anything from it, a corrupt
+    // count or size would otherwise end up in bad_alloc or length_error.
+    if (chunkSize == 0 || chunkSize > maxChunkSize ||
+        count != size / chunkSize + (size % chunkSize != 0 ? 1 : 0) ||
+        fileSize < headerSize || count >= (fileSize - headerSize) / sizeof(std::uint64_t)) {
+        throw DataReaderException(SourceContext{}, "Invalid chunk index in: {:?g}", path);
+    }
+
+    offsets_.resize(static_cast<size_t>(count) + 1);
+    if (std::fread(offsets_.data(), sizeof(std::uint64_t), offsets_.size(), file) !=
+        offsets_.size()) {
+        throw DataReaderException(SourceContext{}, "Could not read chunk index from: {:?g}", path);
+    }
+    for (auto& offset : offsets_) offset = toLittleEndian(offset);
+
+    // The chunks have to follow the index, stay within the file, and no compressed chunk can be
+    // larger than what zlib would produce for a chunk of chunkSize bytes.
+    const auto maxCompressedSize = compressBound(static_cast<uLong>(chunkSize));
+    const bool validOffsets =
+        offsets_.front() == headerSize + offsets_.size() * sizeof(std::uint64_t) &&
+        offsets_.back() <= fileSize &&
+        std::ranges::adjacent_find(offsets_, [&](std::uint64_t a, std::uint64_t b) {
+            return b < a || b - a > maxCompressedSize;
+        }) == offsets_.end();
+    if (!validOffsets) {
+        throw DataReaderException(SourceContext{}, "Invalid chunk index in: {:?g}", path);
+    }
+
+    size_ = static_cast<size_t>(size);
+    chunkSize_ = static_cast<size_t>(chunkSize);
+}
+
+void ChunkedRawFile::write(const std::filesystem::path& path, const void* source, size_t bytes,
+                           size_t chunkSize) {
+    if (chunkSize == 0 || chunkSize > maxChunkSize) {
+        throw DataWriterException(SourceContext{}, "Invalid chunk size {} for file: {:?g}",
+                                  chunkSize, path);
+    }
+
+    FILE* file = filesystem::fopen(path, "wb");
+    if (!file) {
+        throw DataWriterException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+    const util::OnScopeExit closeFile{[file]() { std::fclose(file); }};
+
+    const auto count = (bytes + chunkSize - 1) / chunkSize;
+    std::vector<std::uint64_t> offsets(count + 1);
+    offsets[0] = headerSize + offsets.size() * sizeof(std::uint64_t);
+
+    // The header and the index are written last, when all the chunk sizes are known
+    if (!seek(file, static_cast<size_t>(offsets[0]))) {
+        throw DataWriterException(SourceContext{}, "Could not write to file: {:?g}", path);
+    }
+
+    ChunkTasks<std::vector<Bytef>> tasks;
+    for (size_t chunk = 0; chunk < count; ++chunk) {
+        tasks.add([src = static_cast<const Bytef*>(source) + chunk * chunkSize,
+                   size = std::min(chunkSize, bytes - chunk * chunkSize)]() {
+            auto compressedSize = compressBound(static_cast<uLong>(size));
+            std::vector<Bytef> compressed(compressedSize);
+            if (compress2(compressed.data(), &compressedSize, src, static_cast<uLong>(size),
+                          Z_DEFAULT_COMPRESSION) != Z_OK) {
+                throw DataWriterException(SourceContext{}, "Could not compress chunk");
+            }
+            compressed.resize(compressedSize);
+            return compressed;
+        });
+    }
+    for (size_t chunk = 0; chunk < count; ++chunk) {
+        const auto compressed = tasks.get(chunk);
+        if (std::fwrite(compressed.data(), compressed.size(), 1, file) != 1) {
+            throw DataWriterException(SourceContext{}, "Could not write to file: {:?g}", path);
+        }
+        offsets[chunk + 1] = offsets[chunk] + compressed.size();
+    }
+
+    std::array<std::uint64_t, 4> header{chunkVersion, bytes, chunkSize, count};
+    for (auto& item : header) item = toLittleEndian(item);
+    for (auto& offset : offsets) offset = toLittleEndian(offset);
+    if (!seek(file, 0) || std::fwrite(chunkMagic.data(), chunkMagic.size(), 1, file) != 1 ||
+        std::fwrite(header.data(), sizeof(header), 1, file) != 1 ||
+        std::fwrite(offsets.data(), sizeof(std::uint64_t), offsets.size(), file) !=
+            offsets.size()) {
+        throw DataWriterException(SourceContext{}, "Could not write to file: {:?g}", path);
+    }
+}
+
+size_t ChunkedRawFile::size() const { return size_; }
+
+size_t ChunkedRawFile::chunkSize() const { return chunkSize_; }
+
+size_t ChunkedRawFile::chunkCount() const { return offsets_.size() - 1; }
+
+void ChunkedRawFile::forEachChunk(
+    std::span<const size_t> chunks,
+    const std::function<void(size_t, std::span<const std::byte>)>& callback) const {
+
+    FILE* file = filesystem::fopen(path_, "rb");
+    if (!file) {
+        throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path_);
+    }
+    const util::OnScopeExit closeFile{[file]() { std::fclose(file); }};
+
+    ChunkTasks<void> tasks;
+    for (const auto chunk : chunks) {
+        const auto begin = static_cast<size_t>(offsets_[chunk]);
+        const auto compressedSize = static_cast<size_t>(offsets_[chunk + 1]) - begin;
+        auto compressed = std::make_unique<Bytef[]>(compressedSize);
+        if (!seek(file, begin) || std::fread(compressed.get(), compressedSize, 1, file) != 1) {
+            throw DataReaderException(SourceContext{}, "Could not read chunk {} from file: {:?g}",
+                                      chunk, path_);
+        }
+
+        // Decompress while the next chunk is read
+        tasks.add([&, chunk, compressedSize, compressed = std::move(compressed)]() {
+            const auto size = std::min(chunkSize_, size_ - chunk * chunkSize_);
+            auto data = std::make_unique<Bytef[]>(size);
+            auto dataSize = static_cast<uLong>(size);
+            if (uncompress(data.get(), &dataSize, compressed.get(),
+                           static_cast<uLong>(compressedSize)) != Z_OK ||
+                dataSize != size) {
+                throw DataReaderException(SourceContext{},
+                                          "Could not decompress chunk {} of file: {:?g}", chunk,
+                                          path_);
+            }
+            callback(chunk, std::span{reinterpret_cast<const std::byte*>(data.get()), size});
+        });
+    }
+    tasks.wait();
+}
+
+void ChunkedRawFile::read(size_t offset, size_t bytes, void* dest) const {
+    if (bytes == 0) return;
+    if (offset > size_ || bytes > size_ - offset) {
+        throw DataReaderException(SourceContext{},
+                                  "Range [{}, {}) is outside of the {} bytes in file: {:?g}",
+                                  offset, offset + bytes, size_, path_);
+    }
+
+    std::vector<size_t> chunks;
+    for (auto chunk = offset / chunkSize_; chunk <= (offset + bytes - 1) / chunkSize_; ++chunk) {
+        chunks.push_back(chunk);
+    }
+
+    forEachChunk(chunks, [&](size_t chunk, std::span<const std::byte> data) {
+        const auto chunkBegin = chunk * chunkSize_;
+        const auto begin = std::max(offset, chunkBegin);
+        const auto end = std::min(offset + bytes, chunkBegin + data.size());
+        std::memcpy(static_cast<std::byte*>(dest) + (begin - offset),
+                    data.data() + (begin - chunkBegin), end - begin);
+    });
+}
+
+void ChunkedRawFile::readBrick(size_t offset, size3_t dims, size_t elementSize,
+                               size3_t brickOffset, size3_t brickDims, void* dest) const {
+    if (glm::any(glm::greaterThan(brickOffset + brickDims, dims))) {
+        throw DataReaderException(SourceContext{},
+                                  "Brick [{}, {}) is outside of the volume {} in file: {:?g}",
+                                  brickOffset, brickOffset + brickDims, dims, path_);
+    }
+    if (brickDims.x * brickDims.y * brickDims.z == 0) return;
+
+    const auto rowBytes = brickDims.x * elementSize;
+    const auto rowBegin = [&](size_t y, size_t z) {
+        return offset + (((brickOffset.z + z) * dims.y + brickOffset.y + y) * dims.x +
+                         brickOffset.x) *
+                            elementSize;
+    };
+    const auto rowEnd = rowBegin(brickDims.y - 1, brickDims.z - 1) + rowBytes;
+    if (rowEnd > size_) {
+        throw DataReaderException(SourceContext{},
+                                  "Brick [{}, {}) is outside of the {} bytes in file: {:?g}",
+                                  brickOffset, brickOffset + brickDims, size_, path_);
+    }
+
+    // Collect the chunks overlapping any of the rows, rows are visited in increasing order
+    std::vector<size_t> chunks;
+    for (size_t z = 0; z < brickDims.z; ++z) {
+        for (size_t y = 0; y < brickDims.y; ++y) {
+            const auto begin = rowBegin(y, z);
+            auto first = begin / chunkSize_;
+            if (!chunks.empty() && chunks.back() >= first) first = chunks.back() + 1;
+            for (auto chunk = first; chunk <= (begin + rowBytes - 1) / chunkSize_; ++chunk) {
+                chunks.push_back(chunk);
+            }
+        }
+    }
+
+    // Each chunk copies the parts of the rows it overlaps, different chunks never write to the
+    // same destination bytes.
+    const auto sliceBytes = dims.x * dims.y * elementSize;
+    forEachChunk(chunks, [&](size_t chunk, std::span<const std::byte> data) {
+        const auto chunkBegin = chunk * chunkSize_;
+        const auto chunkEnd = chunkBegin + data.size();
+        const auto firstZ = chunkBegin > offset ? (chunkBegin - offset) / sliceBytes : 0;
+        for (auto z = firstZ > brickOffset.z ? firstZ - brickOffset.z : 0; z < brickDims.z;
+             ++z) {
+            if (rowBegin(0, z) >= chunkEnd) break;
+            for (size_t y = 0; y < brickDims.y; ++y) {
+                const auto row = rowBegin(y, z);
+                if (row >= chunkEnd) break;
+                const auto begin = std::max(row, chunkBegin);
+                const auto end = std::min(row + rowBytes, chunkEnd);
+                if (begin >= end) continue;
+                const auto destOffset = ((z * brickDims.y + y) * rowBytes) + (begin - row);
+                std::memcpy(static_cast<std::byte*>(dest) + destOffset,
+                            data.data() + (begin - chunkBegin), end - begin);
+            }
+        }
+    });
+}
+
+}  // namespace inviwo
@@ -49,9 +49,22 @@ std::string_view enumToStr(Compression compression) {
             return "Disabled";
         case Compression::Enabled:
             return "Enabled";
+        case Compression::Chunked:
+            return "Chunked";
     }
     throw Exception{SourceContext{}, "Found invalid Compression enum value '{}'",
                     static_cast<int>(compression)};
 }
 
+std::string_view enumToStr(MemoryMapping memoryMapping) {
+    switch (memoryMapping) {
+        case MemoryMapping::Disabled:
+            return "Disabled";
+        case MemoryMapping::Enabled:
+            return "Enabled";
+    }
+    throw Exception{SourceContext{}, "Found invalid MemoryMapping enum value '{}'",
+                    static_cast<int>(memoryMapping)};
+}
+
 }  // namespace inviwo
@@ -0,0 +1,142 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/exception.h>
+
+#include <fmt/std.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <system_error>
+#include <tuple>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace inviwo {
+
+#ifdef WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path) : path_{path} {
+    // Allow others to delete or rename the file, so it can be replaced while it is mapped
+    file_ = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        file_ = nullptr;
+        throw FileException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!::GetFileSizeEx(file_, &fileSize)) {
+        ::CloseHandle(file_);
+        throw FileException(SourceContext{}, "Could not get the size of file: {:?g}", path);
+    }
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+    if (size_ == 0) return;
+
+    mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_) {
+        ::CloseHandle(file_);
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+    data_ = static_cast<const std::byte*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+        ::CloseHandle(mapping_);
+        ::CloseHandle(file_);
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (data_) ::UnmapViewOfFile(data_);
+    if (mapping_) ::CloseHandle(mapping_);
+    if (file_) ::CloseHandle(file_);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path) : path_{path} {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw FileException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw FileException(SourceContext{}, "Could not get the size of file: {:?g}", path);
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ == 0) {
+        ::close(fd);
+        return;
+    }
+
+    void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps its own reference to the file
+    if (ptr == MAP_FAILED) {
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+    data_ = static_cast<const std::byte*>(ptr);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+}
+
+#endif
+
+std::shared_ptr<MemoryMappedFile> MemoryMappedFile::open(const std::filesystem::path& path) {
+    using Key = std::tuple<std::filesystem::path, std::filesystem::file_time_type, std::uintmax_t>;
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<MemoryMappedFile>> mappings;
+
+    std::error_code ec;
+    const auto canonical = std::filesystem::weakly_canonical(path, ec);
+    const Key key{ec ? path : canonical, std::filesystem::last_write_time(path, ec),
+                  std::filesystem::file_size(path, ec)};
+
+    const std::scoped_lock lock{mutex};
+    std::erase_if(mappings, [](const auto& item) { return item.second.expired(); });
+    if (auto it = mappings.find(key); it != mappings.end()) {
+        if (auto mapping = it->second.lock()) return mapping;
+    }
+    auto mapping = std::make_shared<MemoryMappedFile>(path);
+    mappings[key] = mapping;
+    return mapping;
+}
+
+}  // namespace inviwo
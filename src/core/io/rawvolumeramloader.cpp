@@ -30,29 +30,83 @@
 #include <inviwo/core/io/rawvolumeramloader.h>
 
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/curlutils.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formatdispatching.h>
 
 #include <glm/gtx/component_wise.hpp>
 
+#include <bit>
+#include <cstdint>
+
 namespace inviwo {
 
 RawVolumeRAMLoader::RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
-                                       ByteOrder byteOrder, Compression compression)
-    : rawFile_{rawFile}, offset_{offset}, byteOrder_{byteOrder}, compression_{compression} {}
+                                       ByteOrder byteOrder, Compression compression,
+                                       MemoryMapping memoryMapping)
+    : rawFile_{rawFile}
+    , offset_{offset}
+    , byteOrder_{byteOrder}
+    , compression_{compression}
+    , memoryMapping_{memoryMapping} {}
 
 RawVolumeRAMLoader* RawVolumeRAMLoader::clone() const { return new RawVolumeRAMLoader(*this); }
 
+namespace {
+
+/**
+ * Create a VolumeRAM that directly references the memory mapped raw file. This is possible for
+ * uncompressed data in native byte order if the data is suitably aligned in the file. Returns a
+ * nullptr otherwise or if the file can not be mapped. The mapping is shared with other volumes of
+ * the same unmodified file, a replaced file gets a new mapping.
+ */
+std::shared_ptr<VolumeRAM> mapVolumeRAM(const std::filesystem::path& rawFile, size_t offset,
+                                        ByteOrder byteOrder, const VolumeRepresentation& src) {
+    const auto elementSize = src.getDataFormat()->getSizeInBytes();
+    const auto native =
+        std::endian::native == std::endian::little ? ByteOrder::LittleEndian : ByteOrder::BigEndian;
+    if (elementSize > 1 && byteOrder != native) return nullptr;
+
+    const auto filePath = net::downloadAndCacheIfUrl(rawFile);
+    std::shared_ptr<MemoryMappedFile> file;
+    try {
+        file = MemoryMappedFile::open(filePath);
+    } catch (const FileException&) {
+        return nullptr;
+    }
+
+    const auto size = glm::compMul(src.getDimensions()) * elementSize;
+    if (!file->data() || offset > file->size() || file->size() - offset < size) return nullptr;
+
+    return dispatching::singleDispatch<std::shared_ptr<VolumeRAM>, dispatching::filter::All>(
+        src.getDataFormat()->getId(), [&]<typename T>() -> std::shared_ptr<VolumeRAM> {
+            const auto* data = file->data() + offset;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0) return nullptr;
+
+            // The representation keeps the mapping alive and copies the data on the first
+            // editable access, the mapping itself is read only.
+            return std::make_shared<VolumeRAMPrecision<T>>(
+                reinterpret_cast<const T*>(data), file, src.getDimensions(), src.getSwizzleMask(),
+                src.getInterpolation(), src.getWrapping());
+        });
+}
+
+}  // namespace
+
 std::shared_ptr<VolumeRepresentation> RawVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
 
+    if (compression_ == Compression::Disabled && memoryMapping_ == MemoryMapping::Enabled) {
+        if (auto volumeRAM = mapVolumeRAM(rawFile_, offset_, byteOrder_, src)) {
+            return volumeRAM;
+        }
+    }
+
     const auto size = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes();
     auto data = std::make_unique<char[]>(size);
-    if (compression_ == Compression::Enabled) {
-        util::readCompressedBytesIntoBuffer(rawFile_, offset_, size, byteOrder_,
-                                            src.getDataFormat()->getSizeInBytes(), data.get());
-    } else {
-        util::readBytesIntoBuffer(rawFile_, offset_, size, byteOrder_,
-                                  src.getDataFormat()->getSizeInBytes(), data.get());
-    }
+    util::readBytesIntoBuffer(rawFile_, offset_, size, byteOrder_,
+                              src.getDataFormat()->getSizeInBytes(), compression_, data.get());
 
     auto volumeRAM =
         createVolumeRAM(src.getDimensions(), src.getDataFormat(), data.get(), src.getSwizzleMask(),
@@ -71,15 +125,9 @@ void RawVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentati
     }
 
     const auto size = glm::compMul(src.getDimensions());
-    if (compression_ == Compression::Enabled) {
-        util::readCompressedBytesIntoBuffer(
-            rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(), byteOrder_,
-            src.getDataFormat()->getSizeInBytes(), volumeDst->getData());
-    } else {
-        util::readBytesIntoBuffer(rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(),
-                                  byteOrder_, src.getDataFormat()->getSizeInBytes(),
-                                  volumeDst->getData());
-    }
+    util::readBytesIntoBuffer(rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(),
+                              byteOrder_, src.getDataFormat()->getSizeInBytes(), compression_,
+                              volumeDst->getData());
 
     volumeDst->setSwizzleMask(src.getSwizzleMask());
     volumeDst->setInterpolation(src.getInterpolation());
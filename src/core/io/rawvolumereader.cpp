@@ -49,7 +49,8 @@ RawVolumeReader::RawVolumeReader()
     , spacing_(0.01f)
     , format_(nullptr)
     , byteOffset_(0u)
-    , compression_{Compression::Disabled} {
+    , compression_{Compression::Disabled}
+    , memoryMapping_{MemoryMapping::Disabled} {
     addExtension(FileExtension("raw", "Raw binary file"));
 }
 
@@ -61,7 +62,8 @@ RawVolumeReader::RawVolumeReader(const RawVolumeReader& rhs)
     , spacing_(rhs.spacing_)
     , format_(rhs.format_)
     , byteOffset_(rhs.byteOffset_)
-    , compression_{rhs.compression_} {}
+    , compression_{rhs.compression_}
+    , memoryMapping_{rhs.memoryMapping_} {}
 
 RawVolumeReader& RawVolumeReader::operator=(const RawVolumeReader& that) {
     if (this != &that) {
@@ -73,6 +75,7 @@ RawVolumeReader& RawVolumeReader::operator=(const RawVolumeReader& that) {
         dataMapper_ = that.dataMapper_;
         byteOffset_ = that.byteOffset_;
         compression_ = that.compression_;
+        memoryMapping_ = that.memoryMapping_;
         DataReaderType<Volume>::operator=(that);
     }
 
@@ -176,8 +179,8 @@ std::shared_ptr<Volume> RawVolumeReader::readData(const std::filesystem::path& p
         volume->setOffset(offset);
         volume->setWorldMatrix(wtm);
         auto vd = std::make_shared<VolumeDisk>(filePath, dimensions_, format_);
-        auto loader =
-            std::make_unique<RawVolumeRAMLoader>(rawFile_, byteOffset_, byteOrder_, compression_);
+        auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile_, byteOffset_, byteOrder_,
+                                                           compression_, memoryMapping_);
         vd->setLoader(loader.release());
         volume->addRepresentation(vd);
 
@@ -191,4 +194,25 @@ std::shared_ptr<Volume> RawVolumeReader::readData(const std::filesystem::path& p
     }
 }
 
+bool RawVolumeReader::setOption(std::string_view key, std::any value) {
+    if (auto* mapping = std::any_cast<MemoryMapping>(&value); mapping && key == "MemoryMapping") {
+        setMemoryMapping(*mapping);
+        return true;
+    }
+    return false;
+}
+
+std::any RawVolumeReader::getOption(std::string_view key) {
+    if (key == "MemoryMapping") {
+        return memoryMapping_;
+    }
+    return {};
+}
+
+RawVolumeReader& RawVolumeReader::setMemoryMapping(MemoryMapping memoryMapping) {
+    memoryMapping_ = memoryMapping;
+    return *this;
+}
+MemoryMapping RawVolumeReader::getMemoryMapping() const { return memoryMapping_; }
+
 }  // namespace inviwo
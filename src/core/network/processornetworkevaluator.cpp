@@ -35,17 +35,48 @@
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/tracerecorder.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/ports/inport.h>
+#include <inviwo/core/ports/outport.h>
+#include <inviwo/core/network/portconnection.h>
+
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 namespace inviwo {
 
 ProcessorNetworkEvaluator::ProcessorNetworkEvaluator(ProcessorNetwork* processorNetwork)
     : processorNetwork_(processorNetwork)
-    , processorsSorted_(util::topologicalSortFiltered(processorNetwork_))
-    , needsSorting_(true)
+    , order_{}
+    , firstOrder_{0}
+    , lastOrder_{-1}
+    , relevant_{}
+    , relevanceDirty_{true}
+    , dirty_{}
+    , dormant_{}
+    , queue_{nullptr}
+    , position_{0}
     , evaluationQueued_(false)
+    , parallelEvaluation_(false)
     , reentranceCount_{0}
+    , evaluatingThread_{}
+    , inFlight_{}
+    , invalidatedInFlight_{}
     , exceptionHandler_(StandardEvaluationErrorHandler()) {
 
+    std::unordered_set<Processor*> state;
+    processorNetwork_->forEachProcessor([&](Processor* processor) {
+        processor->ProcessorObservable::addObserver(this);
+        dirty_.insert(processor);
+        util::traverseNetwork<util::TraversalDirection::Up, util::VisitPattern::Post>(
+            state, processor, [&](Processor* p) { order_[p] = ++lastOrder_; });
+    });
+
     processorNetwork_->addObserver(this);
     processorNetwork_->setEvaluator(this);
 }
@@ -116,89 +147,414 @@ void ProcessorNetworkEvaluator::evaluate() {
 
     notifyObserversProcessorNetworkEvaluationBegin();
 
-    if (needsSorting_) {
-        processorsSorted_ = util::topologicalSortFiltered(processorNetwork_);
-        needsSorting_ = false;
-    }
+    if (relevanceDirty_) updateRelevance();
 
     IVW_CPU_PROFILING_IF(500, "Evaluated Processor Network");
+    IVW_TRACE("network", "Evaluate Network");
+
+    // All processors in dirty_ have a sink downstream, processors invalidated during the pass that
+    // come later in the topological order are evaluated in the same pass, others in the next.
+    std::set<std::pair<std::ptrdiff_t, Processor*>> queue;
+    for (auto* processor : dirty_) queue.emplace(order_.at(processor), processor);
+    dirty_.clear();
+
+    if (parallelEvaluation_) {
+        const auto processors =
+            util::transform(queue, [](const auto& item) { return item.second; });
+        evaluateParallel(processors);
+    } else {
+        const util::OnScopeExit reset{
+            [&, previous = std::exchange(queue_, &queue), position = position_]() {
+                queue_ = previous;
+                position_ = position;
+            }};
+        while (!queue.empty()) {
+            auto* processor = queue.begin()->second;
+            position_ = queue.begin()->first;
+            queue.erase(queue.begin());
+
+            if (processor->isValid()) continue;
+
+            if (!processor->isReady()) {
+                notReady(processor);
+            } else if (prepare(processor)) {
+                processor->notifyObserversAboutToProcess(processor);
+                process(processor);
+            }
+            // processors that are not ready are revisited when their ready state changes
+            if (!processor->isValid() && processor->isReady()) markDirty(processor);
+        }
+    }
 
-    for (auto* processor : processorsSorted_) {
-        if (!processor->isValid()) {
-            if (processor->isReady()) {
-                try {
-                    // re-initialize resources (e.g., shaders) if necessary
-                    if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
-                        processor->initializeResources();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::InitResource, SourceContext{});
-                    continue;
-                }
+    notifyObserversProcessorNetworkEvaluationEnd();
+}
 
-                try {
-                    // call onChange for all invalid inports
-                    for (auto* inport : processor->getInports()) {
-                        inport->callOnChangeIfChanged();
+void ProcessorNetworkEvaluator::evaluateParallel(const std::vector<Processor*>& processors) {
+    const auto size = processors.size();
+
+    std::unordered_map<Processor*, size_t> indices;
+    for (size_t i = 0; i < size; ++i) indices[processors[i]] = i;
+
+    // Number of unfinished predecessors and the successors of each processor. Processors not in
+    // the list are valid, since invalidation propagates downstream.
+    std::vector<size_t> remaining(size, 0);
+    std::vector<std::vector<size_t>> successors(size);
+    for (size_t i = 0; i < size; ++i) {
+        auto* processor = processors[i];
+        for (auto* inport : processor->getInports()) {
+            for (auto* outport : inport->getConnectedOutports()) {
+                if (!processor->isConnectionActive(inport, outport)) continue;
+                const auto it = indices.find(outport->getProcessor());
+                if (it == indices.end() || util::contains(successors[it->second], i)) continue;
+                successors[it->second].push_back(i);
+                ++remaining[i];
+            }
+        }
+    }
+
+    // Processors connected by property links, directly or through other processors, share a
+    // group. Callbacks and process() of one of them can set the properties of the others, hence
+    // nothing is done for a group on the evaluating thread while one of its processors is
+    // processed on the pool.
+    std::unordered_map<Processor*, Processor*> parents;
+    const auto group = [&](Processor* processor) {
+        auto it = parents.find(processor);
+        while (it != parents.end() && it->second != processor) {
+            processor = it->second;
+            it = parents.find(processor);
+        }
+        return processor;
+    };
+    for (const auto& link : processorNetwork_->getLinks()) {
+        auto* a = group(link.getSource()->getOwner()->getProcessor());
+        auto* b = group(link.getDestination()->getOwner()->getProcessor());
+        parents[a] = a;
+        parents[b] = a;
+    }
+    std::unordered_map<Processor*, size_t> busy;
+
+    evaluatingThread_ = std::this_thread::get_id();
+    const util::OnScopeExit resetThread{[&]() { evaluatingThread_ = std::thread::id{}; }};
+
+    // Ready processors are launched in topological order, running pool jobs are finished in
+    // topological order, hence the evaluation order only depends on the network.
+    struct Job {
+        std::future<void> future;
+        // Successors whose ready state might change when the job sets its outport data.
+        std::vector<Processor*> blocked;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, std::greater<>> ready;
+    std::map<size_t, Job> running;
+    for (size_t i = 0; i < size; ++i) {
+        if (remaining[i] == 0) ready.push(i);
+    }
+    const auto done = [&](size_t i) {
+        if (!processors[i]->isValid() && processors[i]->isReady()) markDirty(processors[i]);
+        for (auto successor : successors[i]) {
+            if (--remaining[successor] == 0) ready.push(successor);
+        }
+    };
+
+    auto* app = processorNetwork_->getApplication();
+    std::vector<size_t> deferred;
+    while (!ready.empty() || !running.empty()) {
+        while (!ready.empty()) {
+            const auto i = ready.top();
+            ready.pop();
+            auto* processor = processors[i];
+
+            if (processor->isValid()) {
+                done(i);
+            } else if (busy[group(processor)] > 0) {
+                deferred.push_back(i);
+            } else if (!processor->isReady()) {
+                notReady(processor);
+                done(i);
+            } else if (!prepare(processor)) {
+                done(i);
+            } else if (processor->isThreadSafe()) {
+                processor->notifyObserversAboutToProcess(processor);
+                // Observers of the successors, e.g. the network editor, expect ready state
+                // notifications on the main thread, those are sent when the job is finished.
+                std::vector<Processor*> blocked;
+                for (auto* outport : processor->getOutports()) {
+                    for (auto* inport : outport->getConnectedInports()) {
+                        auto* successor = inport->getProcessor();
+                        if (util::contains(blocked, successor)) continue;
+                        successor->ProcessorObservable::startBlockingNotifications();
+                        blocked.push_back(successor);
                     }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::PortOnChange, SourceContext{});
-                    continue;
                 }
-
+                ++busy[group(processor)];
+                inFlight_.insert(processor);
+                running.emplace(i, Job{app->dispatchPool([processor]() {
+                                           IVW_TRACE("process", processor->getIdentifier());
+                                           processor->process();
+                                       }),
+                                       std::move(blocked)});
+            } else {
                 processor->notifyObserversAboutToProcess(processor);
+                process(processor);
+                done(i);
+            }
+        }
+        if (!running.empty()) {
+            auto node = running.extract(running.begin());
+            auto& job = node.mapped();
+            auto* processor = processors[node.key()];
+            finish(processor, job.future);
+            --busy[group(processor)];
+            for (auto* successor : job.blocked) {
+                successor->ProcessorObservable::stopBlockingNotifications();
+                successor->notifyObserversReadyChange(successor);
+            }
+            done(node.key());
+        }
+        for (auto i : deferred) ready.push(i);
+        deferred.clear();
+    }
+}
+
+bool ProcessorNetworkEvaluator::prepare(Processor* processor) {
+    try {
+        // re-initialize resources (e.g., shaders) if necessary
+        if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+            IVW_TRACE("initializeResources", processor->getIdentifier());
+            processor->initializeResources();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::InitResource, SourceContext{});
+        return false;
+    }
 
-                try {
-                    IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
-                    // do the actual processing
-                    processor->process();
+    try {
+        // call onChange for all invalid inports
+        for (auto* inport : processor->getInports()) {
+            inport->callOnChangeIfChanged();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::PortOnChange, SourceContext{});
+        return false;
+    }
+    return true;
+}
 
-                    // Set processor as valid only if we still are ready.
-                    // Callbacks might have made our inports invalid, if so abort
-                    // the evaluation by not setting the processor valid.
-                    if (processor->isReady()) processor->setValid();
+void ProcessorNetworkEvaluator::process(Processor* processor) {
+    try {
+        IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+        IVW_TRACE("process", processor->getIdentifier());
+        // do the actual processing
+        processor->process();
 
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
-                }
+        // Set processor as valid only if we still are ready.
+        // Callbacks might have made our inports invalid, if so abort
+        // the evaluation by not setting the processor valid.
+        if (processor->isReady()) processor->setValid();
+
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
+    }
 
-                processor->notifyObserversFinishedProcess(processor);
+    processor->notifyObserversFinishedProcess(processor);
+}
 
-            } else {
-                try {
-                    processor->doIfNotReady();
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::NotReady, SourceContext{});
+void ProcessorNetworkEvaluator::finish(Processor* processor, std::future<void>& job) {
+    inFlight_.erase(processor);
+    // An invalidation that arrived while the job was running is newer than its output
+    const bool invalidated = invalidatedInFlight_.erase(processor) > 0;
+    try {
+        job.get();
+        if (!invalidated && processor->isReady()) processor->setValid();
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
+    }
+
+    processor->notifyObserversFinishedProcess(processor);
+}
+
+void ProcessorNetworkEvaluator::notReady(Processor* processor) {
+    try {
+        processor->doIfNotReady();
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::NotReady, SourceContext{});
+    }
+}
+
+void ProcessorNetworkEvaluator::setParallelEvaluation(bool enable) { parallelEvaluation_ = enable; }
+
+bool ProcessorNetworkEvaluator::getParallelEvaluation() const { return parallelEvaluation_; }
+
+void ProcessorNetworkEvaluator::addEdge(Processor* source, Processor* target) {
+    const auto lower = order_.at(target);
+    const auto upper = order_.at(source);
+    if (upper < lower) return;
+
+    const auto connected = [](const auto& ports) {
+        return std::ranges::any_of(ports, [](const auto* port) { return port->isConnected(); });
+    };
+    if (!connected(source->getInports())) {
+        order_[source] = --firstOrder_;
+        return;
+    } else if (!connected(target->getOutports())) {
+        order_[target] = ++lastOrder_;
+        return;
+    }
+
+    // Processors downstream of target and upstream of source within the affected range
+    std::vector<Processor*> forward;
+    std::vector<Processor*> backward;
+    std::unordered_set<Processor*> visited;
+    std::vector<Processor*> stack{target};
+    while (!stack.empty()) {
+        auto* processor = stack.back();
+        stack.pop_back();
+        if (!visited.insert(processor).second) continue;
+        forward.push_back(processor);
+        for (auto* outport : processor->getOutports()) {
+            for (auto* inport : outport->getConnectedInports()) {
+                auto* successor = inport->getProcessor();
+                if (order_.at(successor) < upper) stack.push_back(successor);
+            }
+        }
+    }
+    stack.push_back(source);
+    while (!stack.empty()) {
+        auto* processor = stack.back();
+        stack.pop_back();
+        if (!visited.insert(processor).second) continue;
+        backward.push_back(processor);
+        for (auto* inport : processor->getInports()) {
+            for (auto* outport : inport->getConnectedOutports()) {
+                auto* predecessor = outport->getProcessor();
+                if (order_.at(predecessor) > lower) stack.push_back(predecessor);
+            }
+        }
+    }
+
+    // Reuse the order indices of the affected processors, placing everything upstream of source
+    // before everything downstream of target while keeping the relative order within each set.
+    const auto byOrder = [&](Processor* a, Processor* b) { return order_.at(a) < order_.at(b); };
+    std::ranges::sort(forward, byOrder);
+    std::ranges::sort(backward, byOrder);
+    std::vector<std::ptrdiff_t> indices;
+    indices.reserve(forward.size() + backward.size());
+    for (auto* processor : backward) indices.push_back(order_.at(processor));
+    for (auto* processor : forward) indices.push_back(order_.at(processor));
+    std::ranges::sort(indices);
+
+    auto index = indices.begin();
+    for (auto* processor : backward) order_[processor] = *index++;
+    for (auto* processor : forward) order_[processor] = *index++;
+}
+
+void ProcessorNetworkEvaluator::markRelevant(Processor* processor) {
+    std::vector<Processor*> stack{processor};
+    while (!stack.empty()) {
+        auto* current = stack.back();
+        stack.pop_back();
+        if (!relevant_.insert(current).second) continue;
+        if (dormant_.erase(current) != 0) dirty_.insert(current);
+
+        for (auto* inport : current->getInports()) {
+            for (auto* outport : inport->getConnectedOutports()) {
+                if (current->isConnectionActive(inport, outport)) {
+                    stack.push_back(outport->getProcessor());
                 }
             }
         }
     }
+}
 
-    notifyObserversProcessorNetworkEvaluationEnd();
+void ProcessorNetworkEvaluator::updateRelevance() {
+    relevant_.clear();
+    processorNetwork_->forEachProcessor([&](Processor* processor) {
+        if (processor->isSink()) markRelevant(processor);
+    });
+    std::erase_if(dirty_, [&](Processor* processor) {
+        if (relevant_.contains(processor)) return false;
+        dormant_.insert(processor);
+        return true;
+    });
+    relevanceDirty_ = false;
 }
 
-void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor*) { needsSorting_ = true; }
+void ProcessorNetworkEvaluator::markDirty(Processor* processor) {
+    if (queue_) {
+        if (const auto it = order_.find(processor);
+            it != order_.end() && it->second > position_ && relevant_.contains(processor)) {
+            queue_->emplace(it->second, processor);
+            return;
+        }
+    }
+    if (relevanceDirty_ || relevant_.contains(processor)) {
+        dirty_.insert(processor);
+    } else {
+        dormant_.insert(processor);
+    }
+}
 
-void ProcessorNetworkEvaluator::onProcessorActiveConnectionsChanged(Processor*) {
-    needsSorting_ = true;
+void ProcessorNetworkEvaluator::onProcessorInvalidationBegin(Processor* processor) {
+    // Invalidations from within a pool job are discarded by setValid, as in process()
+    if (evaluatingThread_ != std::thread::id{} &&
+        std::this_thread::get_id() != evaluatingThread_) {
+        return;
+    }
+    if (inFlight_.contains(processor)) invalidatedInFlight_.insert(processor);
+    markDirty(processor);
+}
+
+void ProcessorNetworkEvaluator::onProcessorReadyChanged(Processor* processor) {
+    if (processor->isReady()) markDirty(processor);
+}
+
+void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor* processor) {
+    if (processor->isSink()) {
+        if (!relevanceDirty_) markRelevant(processor);
+    } else {
+        relevanceDirty_ = true;
+    }
+    markDirty(processor);
+}
+
+void ProcessorNetworkEvaluator::onProcessorActiveConnectionsChanged(Processor* processor) {
+    relevanceDirty_ = true;
+    markDirty(processor);
 }
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidAddProcessor(Processor* p) {
     p->ProcessorObservable::addObserver(this);
-    needsSorting_ = true;
+    order_[p] = ++lastOrder_;
+    if (p->isSink() && !relevanceDirty_) markRelevant(p);
+    markDirty(p);
 }
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveProcessor(Processor* p) {
     p->ProcessorObservable::removeObserver(this);
-    needsSorting_ = true;
+    if (queue_) {
+        std::erase_if(*queue_, [&](const auto& item) { return item.second == p; });
+    }
+    order_.erase(p);
+    relevant_.erase(p);
+    dirty_.erase(p);
+    dormant_.erase(p);
 }
 
-void ProcessorNetworkEvaluator::onProcessorNetworkDidAddConnection(const PortConnection&) {
-    needsSorting_ = true;
+void ProcessorNetworkEvaluator::onProcessorNetworkDidAddConnection(const PortConnection& con) {
+    auto* source = con.getOutport()->getProcessor();
+    auto* target = con.getInport()->getProcessor();
+    addEdge(source, target);
+
+    if (!relevanceDirty_ && relevant_.contains(target) &&
+        target->isConnectionActive(con.getInport(), con.getOutport())) {
+        markRelevant(source);
+    }
+    markDirty(target);
 }
 
-void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveConnection(const PortConnection&) {
-    needsSorting_ = true;
+void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveConnection(const PortConnection& con) {
+    // the order stays valid, but the source might have lost its path to a sink
+    relevanceDirty_ = true;
+    markDirty(con.getInport()->getProcessor());
 }
 
 }  // namespace inviwo
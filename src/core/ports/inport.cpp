@@ -31,6 +31,7 @@
 #include <inviwo/core/ports/outport.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/tracerecorder.h>
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/util/docutils.h>
 #include <inviwo/core/network/networkutils.h>
@@ -151,6 +152,7 @@ const std::vector<Outport*>& Inport::getConnectedOutports() const noexcept {
 
 void Inport::callOnChangeIfChanged() const {
     if (isChanged()) {
+        IVW_TRACE("onChange", getPath());
         onChangeCallback_.invokeAll();
     }
 }
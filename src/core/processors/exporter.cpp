@@ -30,20 +30,42 @@
 #include <inviwo/core/processors/exporter.h>
 
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/processors/processor.h>
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/util/stringconversion.h>
 
 #include <fmt/format.h>
 
+#include <string>
+#include <string_view>
+
 namespace inviwo {
 
-std::vector<std::filesystem::path> util::exportAllFiles(
-    ProcessorNetwork& network, const std::filesystem::path& path, std::string_view nameTemplate,
-    const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) {
+namespace {
+
+std::string exportName(std::string_view nameTemplate, const Processor& p, size_t count) {
+    StrBuffer name;
+    if (nameTemplate.empty()) {
+        name.append("{}", p.getIdentifier());
+    } else if (nameTemplate.find("UPN") != std::string::npos) {
+        auto [before, after] = util::splitByFirst(nameTemplate, "UPN");
+        name.append("{}{}{}", before, p.getIdentifier(), after);
+    } else {
+        name.append("{}{:03}", nameTemplate, count);
+    }
+    return std::string{std::string_view{name}};
+}
 
+template <typename ExporterType>
+std::vector<std::filesystem::path> exportAll(ProcessorNetwork& network,
+                                             const std::filesystem::path& path,
+                                             std::string_view nameTemplate,
+                                             const std::vector<FileExtension>& candidateExtensions,
+                                             Overwrite overwrite, bool skipNotReady) {
     std::vector<std::filesystem::path> exportedFiles;
     network.forEachProcessor([&](Processor* p) {
-        if (auto exporter = dynamic_cast<const Exporter*>(p)) {
+        if (auto exporter = dynamic_cast<const ExporterType*>(p)) {
+            if (skipNotReady && !p->isReady()) return;
             if (!p->isValid()) {
                 throw Exception(SourceContext{}, "Processor {} is not valid, no file exported",
                                 p->getIdentifier());
@@ -53,16 +75,7 @@ std::vector<std::filesystem::path> util::exportAllFiles(
                                 p->getIdentifier());
             }
 
-            StrBuffer name;
-            if (nameTemplate.empty()) {
-                name.append("{}", p->getIdentifier());
-            } else if (nameTemplate.find("UPN") != std::string::npos) {
-                auto [before, after] = util::splitByFirst(nameTemplate, "UPN");
-                name.append("{}{}{}", before, p->getIdentifier(), after);
-            } else {
-                name.append("{}{:03}", nameTemplate, exportedFiles.size());
-            }
-
+            const auto name = exportName(nameTemplate, *p, exportedFiles.size());
             if (auto file = exporter->exportFile(path, name, candidateExtensions, overwrite)) {
                 exportedFiles.push_back(*file);
             } else {
@@ -76,4 +89,19 @@ std::vector<std::filesystem::path> util::exportAllFiles(
     return exportedFiles;
 }
 
+}  // namespace
+
+std::vector<std::filesystem::path> util::exportAllFiles(
+    ProcessorNetwork& network, const std::filesystem::path& path, std::string_view nameTemplate,
+    const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) {
+    return exportAll<Exporter>(network, path, nameTemplate, candidateExtensions, overwrite, false);
+}
+
+std::vector<std::filesystem::path> util::exportAllDataFiles(
+    ProcessorNetwork& network, const std::filesystem::path& path, std::string_view nameTemplate,
+    const std::vector<FileExtension>& candidateExtensions, Overwrite overwrite) {
+    return exportAll<DataExporter>(network, path, nameTemplate, candidateExtensions, overwrite,
+                                   true);
+}
+
 }  // namespace inviwo
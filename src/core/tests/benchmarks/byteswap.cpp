@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+/**
+ * The previous implementation of util::reverseByteOrder, for reference
+ */
+void reverseByteOrderReference(void* dest, size_t bytes, size_t elementSize) {
+    auto temp = std::make_unique<char[]>(elementSize);
+
+    for (std::size_t i = 0; i < bytes; i += elementSize) {
+        for (std::size_t j = 0; j < elementSize; j++) {
+            temp[j] = static_cast<char*>(dest)[i + j];
+        }
+
+        for (std::size_t j = 0; j < elementSize; j++) {
+            static_cast<char*>(dest)[i + j] = temp[elementSize - j - 1];
+        }
+    }
+}
+
+/**
+ * Load one of the BigEndian test volumes from tests/volumes and repeat it to get a buffer of
+ * approximately \p bytes.
+ */
+std::vector<char> loadFixture(std::string_view format, size_t bytes) {
+    const auto file = filesystem::getPath(PathType::Tests) / "volumes" /
+                      fmt::format("testdata.{}.BigEndian.raw", format);
+    std::ifstream in{file, std::ios::binary};
+    const std::vector<char> raw{std::istreambuf_iterator<char>{in},
+                                std::istreambuf_iterator<char>{}};
+    if (raw.empty()) return std::vector<char>(bytes, 1);
+
+    std::vector<char> data;
+    data.reserve(bytes + raw.size());
+    while (data.size() < bytes) data.insert(data.end(), raw.begin(), raw.end());
+    return data;
+}
+
+constexpr size_t dataSize = size_t{256} << 20;
+
+void Reference(benchmark::State& state, std::string_view format, size_t elementSize) {
+    auto data = loadFixture(format, dataSize);
+    for (auto _ : state) {
+        reverseByteOrderReference(data.data(), data.size(), elementSize);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void Swap(benchmark::State& state, std::string_view format, size_t elementSize) {
+    auto data = loadFixture(format, dataSize);
+    for (auto _ : state) {
+        util::reverseByteOrder(data.data(), data.size(), elementSize);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+/**
+ * Read and swap a big endian file, state.range(0) is the size of the thread pool
+ */
+void Read(benchmark::State& state, std::string_view format, size_t elementSize) {
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(0)));
+    const auto data = loadFixture(format, dataSize);
+    const auto file = std::filesystem::temp_directory_path() /
+                      fmt::format("inviwo-bm-byteswap.{}.BigEndian.raw", format);
+    {
+        std::ofstream out{file, std::ios::binary};
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    std::vector<char> dest(data.size());
+    for (auto _ : state) {
+        util::readBytesIntoBuffer(file, 0, dest.size(), ByteOrder::BigEndian, elementSize,
+                                  dest.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+    std::filesystem::remove(file);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(Reference, INT16, "INT16", 2)->UseRealTime();
+BENCHMARK_CAPTURE(Swap, INT16, "INT16", 2)->UseRealTime();
+BENCHMARK_CAPTURE(Reference, FLOAT32, "FLOAT32", 4)->UseRealTime();
+BENCHMARK_CAPTURE(Swap, FLOAT32, "FLOAT32", 4)->UseRealTime();
+BENCHMARK_CAPTURE(Reference, FLOAT64, "FLOAT64", 8)->UseRealTime();
+BENCHMARK_CAPTURE(Swap, FLOAT64, "FLOAT64", 8)->UseRealTime();
+
+BENCHMARK_CAPTURE(Read, FLOAT32, "FLOAT32", 4)->Arg(0)->Arg(4)->UseRealTime();
+BENCHMARK_CAPTURE(Read, FLOAT64, "FLOAT64", 8)->Arg(0)->Arg(4)->UseRealTime();
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-ByteSwap");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
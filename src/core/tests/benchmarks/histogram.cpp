@@ -0,0 +1,147 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/algorithm/histogram1d.h>
+#include <inviwo/core/datastructures/datamapper.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+template <typename T>
+std::vector<T> makeData(size_t size) {
+    std::vector<T> data(size);
+    std::mt19937 rand{0};
+    if constexpr (std::is_floating_point_v<T>) {
+        std::normal_distribution<T> dist{T{0.5}, T{0.15}};
+        std::ranges::generate(data, [&]() { return dist(rand); });
+    } else {
+        std::uniform_int_distribution<int> dist{std::numeric_limits<T>::lowest(),
+                                                std::numeric_limits<T>::max()};
+        std::ranges::generate(data, [&]() { return static_cast<T>(dist(rand)); });
+    }
+    return data;
+}
+
+template <typename T>
+DataMapper makeDataMap() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return DataMapper{dvec2{0.0, 1.0}};
+    } else {
+        return DataMapper{dvec2{std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()}};
+    }
+}
+
+constexpr size_t dataSize = size_t{1} << 27;
+
+/**
+ * Reference implementation, a single scalar loop over all elements
+ */
+template <typename T>
+void Scalar(benchmark::State& state) {
+    const auto data = makeData<T>(dataSize);
+    const auto dataMap = makeDataMap<T>();
+    const auto [numbins, range] = util::detail::optimalBinCount<T>(dataMap, 2048);
+    const auto scale = static_cast<double>(numbins - 1) / range;
+
+    for (auto _ : state) {
+        std::vector<size_t> hist(numbins, 0);
+        double min = std::numeric_limits<double>::max();
+        double max = std::numeric_limits<double>::lowest();
+        double sum = 0.0;
+        double sum2 = 0.0;
+        for (const auto& item : data) {
+            const auto val = static_cast<double>(item);
+            min = glm::min(min, val);
+            max = glm::max(max, val);
+            sum += val;
+            sum2 += val * val;
+            const auto nc = (val - dataMap.dataRange.x) * scale;
+            if (nc >= 0.0 && nc < static_cast<double>(numbins)) ++hist[static_cast<size_t>(nc)];
+        }
+        benchmark::DoNotOptimize(hist.data());
+        benchmark::DoNotOptimize(min + max + sum + sum2);
+    }
+    state.SetBytesProcessed(state.iterations() * dataSize * sizeof(T));
+}
+
+/**
+ * util::calculateHistograms using state.range(0) threads, 0 means the calling thread only.
+ */
+template <typename T>
+void Histogram(benchmark::State& state) {
+    const auto data = makeData<T>(dataSize);
+    const auto dataMap = makeDataMap<T>();
+    InviwoApplication::getPtr()->resizePool(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto histograms = util::calculateHistograms<T>(data, dataMap, 2048);
+        benchmark::DoNotOptimize(histograms.data());
+    }
+    state.SetBytesProcessed(state.iterations() * dataSize * sizeof(T));
+}
+
+const auto maxThreads = static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+}  // namespace
+
+BENCHMARK(Scalar<uint8_t>)->UseRealTime();
+BENCHMARK(Scalar<uint16_t>)->UseRealTime();
+BENCHMARK(Scalar<float>)->UseRealTime();
+
+BENCHMARK(Histogram<uint8_t>)->Arg(0)->RangeMultiplier(2)->Range(1, maxThreads)->UseRealTime();
+BENCHMARK(Histogram<uint16_t>)->Arg(0)->RangeMultiplier(2)->Range(1, maxThreads)->UseRealTime();
+BENCHMARK(Histogram<float>)->Arg(0)->RangeMultiplier(2)->Range(1, maxThreads)->UseRealTime();
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-Histogram");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
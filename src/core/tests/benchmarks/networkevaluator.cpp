@@ -0,0 +1,167 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <memory>
+#include <string_view>
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+using namespace inviwo;
+
+struct Forward : Processor {
+    Forward(std::string_view id, bool hasInport, bool hasOutport)
+        : Processor(id, id), inport{"in"}, outport{"out"} {
+        if (hasInport) addPort(inport);
+        if (hasOutport) addPort(outport);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override {
+        outport.setData(inport.hasData() ? inport.getData() : std::make_shared<int>(0));
+    }
+
+    DataInport<int> inport;
+    DataOutport<int> outport;
+};
+
+const ProcessorInfo Forward::processorInfo_{
+    "org.inviwo.Forward",  // Class identifier
+    "Forward",             // Display name
+    "Testing",             // Category
+    CodeState::Stable,     // Code state
+    Tags::CPU,             // Tags
+};
+
+enum class Order { Forward, Reverse };
+
+/**
+ * Adds a chain of processors, a source followed by @p size - 2 processors and a sink, to the
+ * network in the given order, connecting each new processor as it is added, like a script would.
+ */
+std::vector<Forward*> buildChain(ProcessorNetwork& network, size_t size, Order order) {
+    std::vector<Forward*> chain(size, nullptr);
+    const auto add = [&](size_t i) {
+        chain[i] = network.addProcessor(
+            std::make_shared<Forward>(fmt::format("forward{}", i), i != 0, i + 1 != size));
+        if (order == Order::Forward && i > 0) {
+            network.addConnection(&chain[i - 1]->outport, &chain[i]->inport);
+        } else if (order == Order::Reverse && i + 1 < size) {
+            network.addConnection(&chain[i]->outport, &chain[i + 1]->inport);
+        }
+    };
+    if (order == Order::Forward) {
+        for (size_t i = 0; i < size; ++i) add(i);
+    } else {
+        for (size_t i = size; i-- > 0;) add(i);
+    }
+    return chain;
+}
+
+// Scripted construction, evaluating the network after every change
+void NetworkBuild(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto order = static_cast<Order>(state.range(1));
+    const auto locked = state.range(2) != 0;
+    for (auto _ : state) {
+        ProcessorNetwork network{InviwoApplication::getPtr()};
+        ProcessorNetworkEvaluator evaluator{&network};
+        {
+            std::optional<NetworkLock> lock;
+            if (locked) lock.emplace(&network);
+            benchmark::DoNotOptimize(buildChain(network, size, order));
+        }
+        state.PauseTiming();
+        network.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A fan out of independent branches where only one branch is invalidated
+void NetworkEvaluateBranch(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    std::vector<Forward*> sources;
+    {
+        const NetworkLock lock{&network};
+        for (size_t i = 0; i < size / 2; ++i) {
+            sources.push_back(network.addProcessor(
+                std::make_shared<Forward>(fmt::format("source{}", i), false, true)));
+            auto* sink = network.addProcessor(
+                std::make_shared<Forward>(fmt::format("sink{}", i), true, false));
+            network.addConnection(&sources.back()->outport, &sink->inport);
+        }
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        sources[i++ % sources.size()]->invalidate(InvalidationLevel::InvalidOutput);
+    }
+    network.clear();
+}
+
+}  // namespace
+
+BENCHMARK(NetworkBuild)
+    ->ArgsProduct({{1000, 10000},
+                   {static_cast<int64_t>(Order::Forward), static_cast<int64_t>(Order::Reverse)},
+                   {0, 1}})
+    ->ArgNames({"size", "reverse", "locked"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(NetworkEvaluateBranch)->Arg(1000)->Arg(10000)->ArgName("size");
+
+int main(int argc, char** argv) {
+    LogCentral::init();
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-NetworkEvaluator");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <glm/gtx/component_wise.hpp>
+
+using namespace inviwo;
+
+namespace {
+
+template <typename T>
+std::shared_ptr<Volume> makeVolume() {
+    const size3_t dims{128, 128, 128};
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dims);
+    std::mt19937 rand{0};
+    std::uniform_real_distribution<double> dist{0.0, 100.0};
+    auto data = ram->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        data[i] = util::glm_convert<T>(dvec4{dist(rand), dist(rand), dist(rand), dist(rand)});
+    }
+    return std::make_shared<Volume>(ram);
+}
+
+std::vector<dvec3> makePositions() {
+    std::mt19937 rand{1};
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    std::vector<dvec3> positions(size_t{1} << 20);
+    for (auto& p : positions) p = dvec3{dist(rand), dist(rand), dist(rand)};
+    return positions;
+}
+
+template <typename T, typename ReturnType>
+void Single(benchmark::State& state) {
+    const auto volume = makeVolume<T>();
+    const auto positions = makePositions();
+    const VolumeSampler<ReturnType> sampler{volume};
+    std::vector<ReturnType> result(positions.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < positions.size(); ++i) {
+            result[i] = sampler.sample(positions[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+
+template <typename T, typename ReturnType>
+void Batch(benchmark::State& state) {
+    const auto volume = makeVolume<T>();
+    const auto positions = makePositions();
+    const VolumeSampler<ReturnType> sampler{volume};
+    std::vector<ReturnType> result(positions.size());
+
+    for (auto _ : state) {
+        sampler.sample(positions, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+
+}  // namespace
+
+BENCHMARK(Single<unsigned char, double>);
+BENCHMARK(Batch<unsigned char, double>);
+BENCHMARK(Single<float, double>);
+BENCHMARK(Batch<float, double>);
+BENCHMARK(Single<vec3, dvec3>);
+BENCHMARK(Batch<vec3, dvec3>);
+BENCHMARK(Single<vec3, dvec4>);
+BENCHMARK(Batch<vec3, dvec4>);
+
+BENCHMARK_MAIN();
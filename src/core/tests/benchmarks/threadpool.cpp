@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <inviwo/core/util/threadpool.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace {
+
+using namespace inviwo;
+
+constexpr size_t nTasks = 10000;
+
+// Many tiny independent tasks enqueued from a single thread
+void ThreadPoolFlat(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    std::vector<std::future<void>> futures;
+    futures.reserve(nTasks);
+    std::atomic<size_t> count{0};
+
+    for (auto _ : state) {
+        futures.clear();
+        for (size_t i = 0; i < nTasks; ++i) {
+            futures.push_back(pool.enqueue([&count]() { ++count; }));
+        }
+        for (auto& f : futures) f.wait();
+    }
+    benchmark::DoNotOptimize(count.load());
+    state.SetItemsProcessed(state.iterations() * nTasks);
+}
+
+// Recursive fork-join, tasks enqueue sub tasks and wait for them from within the pool
+size_t fib(ThreadPool& pool, size_t n) {
+    if (n < 10) {
+        size_t a = 0;
+        size_t b = 1;
+        for (size_t i = 0; i < n; ++i) {
+            b = std::exchange(a, b) + b;
+        }
+        return a;
+    }
+    auto f = pool.enqueue([&pool, n]() { return fib(pool, n - 1); });
+    const auto res = fib(pool, n - 2);
+    pool.wait(f);
+    return res + f.get();
+}
+
+void ThreadPoolForkJoin(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto res = pool.enqueue([&pool]() { return fib(pool, 25); });
+        benchmark::DoNotOptimize(res.get());
+    }
+}
+
+// Independent work loads of a fixed size, measures the scaling with the number of threads
+void ThreadPoolWork(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    std::vector<std::future<double>> futures;
+    futures.reserve(nTasks);
+
+    for (auto _ : state) {
+        futures.clear();
+        for (size_t i = 0; i < nTasks; ++i) {
+            futures.push_back(pool.enqueue([i]() {
+                double sum = 0.0;
+                for (size_t j = 0; j < 2000; ++j) {
+                    sum += static_cast<double>((i + j) % 7) * 0.5;
+                }
+                return sum;
+            }));
+        }
+        double sum = 0.0;
+        for (auto& f : futures) sum += f.get();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * nTasks);
+}
+
+const auto maxThreads = static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+}  // namespace
+
+BENCHMARK(ThreadPoolFlat)->RangeMultiplier(2)->Range(1, maxThreads)->UseRealTime();
+BENCHMARK(ThreadPoolForkJoin)->RangeMultiplier(2)->Range(1, maxThreads)->UseRealTime();
+BENCHMARK(ThreadPoolWork)->RangeMultiplier(2)->Range(1, maxThreads)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,193 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/bytewriterutil.h>
+#include <inviwo/core/io/chunkedrawfile.h>
+#include <inviwo/core/io/datareaderexception.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+struct TempFile {
+    TempFile()
+        : path{std::filesystem::temp_directory_path() /
+               (std::string{"inviwo-chunkedrawfile-"} +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".raw.zc")} {}
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+    std::filesystem::path path;
+};
+
+std::vector<std::uint16_t> makeData(size_t size) {
+    std::vector<std::uint16_t> data(size);
+    std::iota(data.begin(), data.end(), std::uint16_t{0});
+    return data;
+}
+
+}  // namespace
+
+TEST(ChunkedRawFile, RoundTrip) {
+    const TempFile tmp;
+    const auto data = makeData(10'000);
+    ChunkedRawFile::write(tmp.path, data.data(), data.size() * 2, 1000);
+
+    const ChunkedRawFile file{tmp.path};
+    EXPECT_EQ(file.size(), data.size() * 2);
+    EXPECT_EQ(file.chunkSize(), size_t{1000});
+    EXPECT_EQ(file.chunkCount(), size_t{20});
+
+    std::vector<std::uint16_t> result(data.size());
+    file.read(0, result.size() * 2, result.data());
+    EXPECT_EQ(result, data);
+}
+
+TEST(ChunkedRawFile, ReadRange) {
+    const TempFile tmp;
+    const auto data = makeData(10'000);
+    // Use small chunks to have the range span several chunks, starting and ending mid chunk
+    ChunkedRawFile::write(tmp.path, data.data(), data.size() * 2, 998);
+    std::vector<std::uint16_t> result(1500);
+    util::readBytesIntoBuffer(tmp.path, 2 * 4321, result.size() * 2, ByteOrder::LittleEndian, 2,
+                              Compression::Chunked, result.data());
+    EXPECT_TRUE(std::equal(result.begin(), result.end(), data.begin() + 4321));
+
+    EXPECT_THROW(util::readChunkedBytesIntoBuffer(tmp.path, 2 * 9999, 4, ByteOrder::LittleEndian,
+                                                  2, result.data()),
+                 DataReaderException);
+}
+
+TEST(ChunkedRawFile, WriteBytes) {
+    const TempFile tmp;
+    const auto data = makeData(10'000);
+    util::writeBytes(tmp.path, data.data(), data.size() * 2, Compression::Chunked);
+
+    std::vector<std::uint16_t> result(data.size());
+    util::readBytesIntoBuffer(tmp.path, 0, result.size() * 2, ByteOrder::LittleEndian, 2,
+                              Compression::Chunked, result.data());
+    EXPECT_EQ(result, data);
+}
+
+TEST(ChunkedRawFile, ReadBrick) {
+    const TempFile tmp;
+    const size3_t dims{20, 15, 12};
+    const auto data = makeData(dims.x * dims.y * dims.z);
+    ChunkedRawFile::write(tmp.path, data.data(), data.size() * 2, 250);
+
+    const size3_t offset{3, 4, 5};
+    const size3_t brick{7, 6, 5};
+    std::vector<std::uint16_t> result(brick.x * brick.y * brick.z);
+    util::readChunkedBrickIntoBuffer(tmp.path, 0, dims, offset, brick, ByteOrder::LittleEndian, 2,
+                                     result.data());
+
+    for (size_t z = 0; z < brick.z; ++z) {
+        for (size_t y = 0; y < brick.y; ++y) {
+            for (size_t x = 0; x < brick.x; ++x) {
+                const auto expected =
+                    data[((z + offset.z) * dims.y + y + offset.y) * dims.x + x + offset.x];
+                EXPECT_EQ(result[(z * brick.y + y) * brick.x + x], expected);
+            }
+        }
+    }
+
+    EXPECT_THROW(util::readChunkedBrickIntoBuffer(tmp.path, 0, dims, size3_t{15, 0, 0}, brick,
+                                                  ByteOrder::LittleEndian, 2, result.data()),
+                 DataReaderException);
+}
+
+TEST(ChunkedRawFile, ByteOrder) {
+    const TempFile tmp;
+    const auto data = makeData(5'000);
+    ChunkedRawFile::write(tmp.path, data.data(), data.size() * 2, 512);
+
+    std::vector<std::uint16_t> result(data.size());
+    util::readChunkedBytesIntoBuffer(tmp.path, 0, result.size() * 2, ByteOrder::BigEndian, 2,
+                                     result.data());
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(result[i], std::byteswap(data[i]));
+    }
+}
+
+TEST(ChunkedRawFile, CorruptIndex) {
+    const TempFile tmp;
+    const auto data = makeData(5'000);
+    ChunkedRawFile::write(tmp.path, data.data(), data.size() * 2, 512);
+
+    const auto patch = [&](std::streamoff pos, std::uint64_t value) {
+        std::fstream file{tmp.path, std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(pos);
+        if constexpr (std::endian::native == std::endian::big) value = std::byteswap(value);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    // magic, version, size, chunk size, chunk count, offsets
+    constexpr std::streamoff sizePos = 16;
+    constexpr std::streamoff countPos = 32;
+    constexpr std::streamoff firstOffsetPos = 40;
+
+    // A huge size and chunk count must not be allocated
+    patch(sizePos, std::uint64_t{1} << 60);
+    patch(countPos, (std::uint64_t{1} << 60) / 512);
+    EXPECT_THROW(ChunkedRawFile{tmp.path}, DataReaderException);
+
+    patch(sizePos, data.size() * 2);
+    patch(countPos, (data.size() * 2 + 511) / 512);
+    EXPECT_NO_THROW(ChunkedRawFile{tmp.path});
+
+    // Chunk offsets outside of the file
+    patch(firstOffsetPos + 8, std::uint64_t{1} << 40);
+    EXPECT_THROW(ChunkedRawFile{tmp.path}, DataReaderException);
+}
+
+TEST(ChunkedRawFile, TruncatedFile) {
+    const TempFile tmp;
+    const auto data = makeData(5'000);
+    ChunkedRawFile::write(tmp.path, data.data(), data.size() * 2, 512);
+
+    std::filesystem::resize_file(tmp.path, std::filesystem::file_size(tmp.path) - 1);
+    EXPECT_THROW(ChunkedRawFile{tmp.path}, DataReaderException);
+}
+
+}  // namespace inviwo
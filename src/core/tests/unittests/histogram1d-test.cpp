@@ -198,4 +198,65 @@ TEST_F(Histogram1DTest, floatFractionalRangeUpper) {
     EXPECT_EQ(20, histograms[0].totalCounts) << "different total counts";
 }
 
+TEST_F(Histogram1DTest, multipleChunksUint16) {
+    // enough values to be split into several chunks, counted through the value count path
+    const size_t numValues = 3 * util::detail::histogramChunkSize + 17;
+    std::vector<uint16_t> data(numValues);
+    std::mt19937 rand{0};
+    std::uniform_int_distribution<int> dist{100, 4000};
+    std::ranges::generate(data, [&]() { return static_cast<uint16_t>(dist(rand)); });
+
+    const DataMapper dataMap{dvec2{0.0, 2047.0}};
+    auto histograms = util::calculateHistograms<uint16_t>(data, dataMap, 2048);
+
+    std::vector<size_t> expected(2048, 0);
+    size_t overflow = 0;
+    for (auto v : data) {
+        if (v < 2048) {
+            ++expected[v];
+        } else {
+            ++overflow;
+        }
+    }
+    EXPECT_EQ(expected, histograms[0].counts) << "different counts per bin";
+    EXPECT_EQ(overflow, histograms[0].overflow);
+    EXPECT_EQ(0, histograms[0].underflow);
+    EXPECT_EQ(numValues, histograms[0].totalCounts);
+    EXPECT_DOUBLE_EQ(static_cast<double>(*std::ranges::min_element(data)),
+                     histograms[0].dataStats.min);
+    EXPECT_DOUBLE_EQ(static_cast<double>(*std::ranges::max_element(data)),
+                     histograms[0].dataStats.max);
+}
+
+TEST_F(Histogram1DTest, multipleChunksFloat) {
+    const size_t numValues = 2 * util::detail::histogramChunkSize + 5;
+    std::vector<float> data(numValues);
+    std::mt19937 rand{0};
+    std::uniform_real_distribution<float> dist{-0.5f, 1.5f};
+    std::ranges::generate(data, [&]() { return dist(rand); });
+
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+    auto histograms = util::calculateHistograms<float>(data, dataMap, 64);
+
+    const auto binCount = histograms[0].counts.size();
+    const auto scale = static_cast<double>(binCount - 1);
+    std::vector<size_t> expected(binCount, 0);
+    size_t underflow = 0;
+    size_t overflow = 0;
+    for (auto v : data) {
+        const auto nc = static_cast<double>(v) * scale;
+        if (nc < 0.0) {
+            ++underflow;
+        } else if (nc >= static_cast<double>(binCount)) {
+            ++overflow;
+        } else {
+            ++expected[static_cast<size_t>(nc)];
+        }
+    }
+    EXPECT_EQ(expected, histograms[0].counts) << "different counts per bin";
+    EXPECT_EQ(underflow, histograms[0].underflow);
+    EXPECT_EQ(overflow, histograms[0].overflow);
+    EXPECT_EQ(numValues, histograms[0].totalCounts);
+}
+
 }  // namespace inviwo
@@ -44,7 +44,11 @@
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <map>
+#include <thread>
 
 namespace inviwo {
 
@@ -86,12 +90,14 @@ struct TestProcessor : Processor {
     virtual void doIfNotReady() override {
         if (callbacks.onNotReady) callbacks.onNotReady(*this);
     }
+    virtual bool isThreadSafe() const override { return threadSafe; }
 
     DataInport<int> inport;
     DataOutport<int> outport;
     IntProperty prop;
 
     OnCallbacks callbacks;
+    bool threadSafe = false;
 };
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -171,6 +177,13 @@ auto createProcessor(std::string_view id, OnCallbacks callbacks = {}) {
     return sink;
 };
 
+struct FinishedObserver : ProcessorObserver {
+    virtual void onProcessorFinishedProcess(Processor* p) override {
+        finished.emplace_back(p->getIdentifier());
+    }
+    std::vector<std::string> finished;
+};
+
 }  // namespace
 
 TEST(NetworkEvaluator, Eval) {
@@ -606,4 +619,289 @@ TEST(NetworkEvaluator, UpwardsPropertyLinkWithError) {
     }
 }
 
+TEST(NetworkEvaluator, Parallel) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setParallelEvaluation(true);
+
+    std::map<Processor*, unsigned int> throwCount;
+    evaluator.setExceptionHandler(
+        [&throwCount](Processor* p, EvaluationType type, SourceContext) {
+            EXPECT_EQ(type, EvaluationType::Process);
+            ++throwCount[p];
+        });
+
+    auto source = createSource("source", {.onProcess = [](TestProcessor& p) {
+                                   p.outport.setData(std::make_shared<int>(p.prop.get()));
+                               }});
+
+    std::atomic<bool> shouldThrow = false;
+    const auto branch = [&](std::string_view id, int offset) {
+        auto processor = createProcessor(
+            id, {.onProcess = [offset, &shouldThrow](TestProcessor& p) {
+                if (shouldThrow) throw Exception(SourceContext{}, "Error");
+                p.outport.setData(std::make_shared<int>(*p.inport.getData() + offset));
+            }});
+        processor->threadSafe = true;
+        return processor;
+    };
+    auto processor1 = branch("processor1", 1);
+    auto processor2 = branch("processor2", 2);
+    auto sink1 = createSink("sink1");
+    auto sink2 = createSink("sink2");
+
+    auto& src = *source;
+    auto& prc1 = *processor1;
+    auto& prc2 = *processor2;
+    auto& snk1 = *sink1;
+    auto& snk2 = *sink2;
+
+    Instrument srcInst(src);
+    Instrument prcInst1(prc1);
+    Instrument prcInst2(prc2);
+    Instrument snkInst1(snk1);
+    Instrument snkInst2(snk2);
+
+    FinishedObserver observer;
+    for (auto* p : std::initializer_list<Processor*>{&src, &prc1, &prc2, &snk1, &snk2}) {
+        p->ProcessorObservable::addObserver(&observer);
+    }
+
+    {
+        const NetworkLock lock{&network};
+        network.addProcessor(std::move(source));
+        network.addProcessor(std::move(processor1));
+        network.addProcessor(std::move(processor2));
+        network.addProcessor(std::move(sink1));
+        network.addProcessor(std::move(sink2));
+        network.addConnection(&src.outport, &prc1.inport);
+        network.addConnection(&src.outport, &prc2.inport);
+        network.addConnection(&prc1.outport, &snk1.inport);
+        network.addConnection(&prc2.outport, &snk2.inport);
+    }
+
+    srcInst.checkAndReset({.init = 1, .process = 1});
+    prcInst1.checkAndReset({.init = 1, .process = 1});
+    prcInst2.checkAndReset({.init = 1, .process = 1});
+    snkInst1.checkAndReset({.init = 1, .process = 1});
+    snkInst2.checkAndReset({.init = 1, .process = 1});
+    const auto order = observer.finished;
+    EXPECT_EQ(order.size(), 5u);
+
+    {
+        SCOPED_TRACE("Change Property");
+        for (int i = 0; i < 10; ++i) {
+            observer.finished.clear();
+            src.prop.set(10 * i);
+
+            srcInst.checkAndReset({.process = 1, .propModified = 1});
+            prcInst1.checkAndReset({.process = 1});
+            prcInst2.checkAndReset({.process = 1});
+            snkInst1.checkAndReset({.process = 1});
+            snkInst2.checkAndReset({.process = 1});
+
+            EXPECT_EQ(*snk1.inport.getData(), 10 * i + 1);
+            EXPECT_EQ(*snk2.inport.getData(), 10 * i + 2);
+            EXPECT_EQ(observer.finished, order);
+        }
+    }
+
+    {
+        SCOPED_TRACE("Error in thread safe processors");
+        shouldThrow = true;
+        src.prop.set(-1);
+
+        EXPECT_EQ(throwCount[&prc1], 1);
+        EXPECT_EQ(throwCount[&prc2], 1);
+        EXPECT_FALSE(prc1.isValid());
+        EXPECT_FALSE(prc2.isValid());
+        snkInst1.checkAndReset({.notReady = 1});
+        snkInst2.checkAndReset({.notReady = 1});
+    }
+
+    for (auto* p : std::initializer_list<Processor*>{&src, &prc1, &prc2, &snk1, &snk2}) {
+        p->ProcessorObservable::removeObserver(&observer);
+    }
+}
+
 }  // namespace inviwo
+
+TEST(NetworkEvaluator, ParallelPropertyLink) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setParallelEvaluation(true);
+
+    auto source = createSource("source", {.onProcess = [](TestProcessor& p) {
+                                   p.outport.setData(std::make_shared<int>(p.prop.get()));
+                               }});
+
+    // worker runs on the pool, its property is linked from linked, which runs on the evaluating
+    // thread and sets its property while processing
+    std::atomic<bool> processing = false;
+    auto worker = createProcessor("worker", {.onProcess = [&processing](TestProcessor& p) {
+                                      processing = true;
+                                      std::this_thread::sleep_for(std::chrono::milliseconds{20});
+                                      const auto value = *p.inport.getData() + p.prop.get();
+                                      p.outport.setData(std::make_shared<int>(value));
+                                      processing = false;
+                                  }});
+    worker->threadSafe = true;
+    auto linked = createSink("linked", {.onProcess = [&processing](TestProcessor& p) {
+                                 EXPECT_FALSE(processing);
+                                 p.prop.set(2 * *p.inport.getData());
+                             }});
+    auto sink = createSink("sink");
+
+    auto& src = *source;
+    auto& wrk = *worker;
+    auto& lnk = *linked;
+    auto& snk = *sink;
+
+    {
+        const NetworkLock lock{&network};
+        network.addProcessor(std::move(source));
+        // added before linked to be launched first
+        network.addProcessor(std::move(worker));
+        network.addProcessor(std::move(linked));
+        network.addProcessor(std::move(sink));
+        network.addConnection(&src.outport, &wrk.inport);
+        network.addConnection(&src.outport, &lnk.inport);
+        network.addConnection(&wrk.outport, &snk.inport);
+        network.addLink(&lnk.prop, &wrk.prop);
+    }
+
+    for (int i = 1; i < 5; ++i) {
+        src.prop.set(10 * i);
+        // The worker is evaluated again with the linked value, it is not left valid with the
+        // output of the old value
+        EXPECT_TRUE(wrk.isValid());
+        EXPECT_EQ(wrk.prop.get(), 20 * i);
+        EXPECT_EQ(*snk.inport.getData(), 30 * i);
+    }
+}
+
+TEST(NetworkEvaluator, Order) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto source = createSource("source", {.onProcess = [](TestProcessor& p) {
+                                   p.outport.setData(std::make_shared<int>(p.prop.get()));
+                               }});
+    const auto forward = [](TestProcessor& p) {
+        p.outport.setData(std::make_shared<int>(*p.inport.getData()));
+    };
+    auto processor = createProcessor("processor", {.onProcess = forward});
+    auto dangling = createProcessor("dangling", {.onProcess = forward});
+    auto sink = createSink("sink");
+
+    auto& src = *source;
+    auto& prc = *processor;
+    auto& dng = *dangling;
+    auto& snk = *sink;
+
+    Instrument srcInst(src);
+    Instrument prcInst(prc);
+    Instrument dngInst(dng);
+    Instrument snkInst(snk);
+
+    FinishedObserver observer;
+    for (auto* p : std::initializer_list<Processor*>{&src, &prc, &dng, &snk}) {
+        p->ProcessorObservable::addObserver(&observer);
+    }
+
+    {
+        // Add the processors in reverse topological order to force a reordering
+        const NetworkLock lock{&network};
+        network.addProcessor(std::move(sink));
+        network.addProcessor(std::move(dangling));
+        network.addProcessor(std::move(processor));
+        network.addProcessor(std::move(source));
+        network.addConnection(&prc.outport, &snk.inport);
+        network.addConnection(&src.outport, &prc.inport);
+        network.addConnection(&src.outport, &dng.inport);
+    }
+
+    srcInst.checkAndReset({.init = 1, .process = 1});
+    prcInst.checkAndReset({.init = 1, .process = 1});
+    dngInst.checkAndReset({});
+    snkInst.checkAndReset({.init = 1, .process = 1});
+    EXPECT_EQ(observer.finished, (std::vector<std::string>{"source", "processor", "sink"}));
+
+    {
+        SCOPED_TRACE("Invalidate sink");
+        observer.finished.clear();
+        snk.invalidate(InvalidationLevel::InvalidOutput);
+        srcInst.checkAndReset({});
+        prcInst.checkAndReset({});
+        snkInst.checkAndReset({.process = 1});
+        EXPECT_EQ(observer.finished, (std::vector<std::string>{"sink"}));
+    }
+
+    {
+        SCOPED_TRACE("Connect dangling");
+        observer.finished.clear();
+        {
+            const NetworkLock lock{&network};
+            network.removeConnection(&prc.outport, &snk.inport);
+            network.addConnection(&dng.outport, &snk.inport);
+        }
+        srcInst.checkAndReset({});
+        prcInst.checkAndReset({});
+        dngInst.checkAndReset({.init = 1, .process = 1});
+        snkInst.checkAndReset({.process = 1});
+        EXPECT_EQ(observer.finished, (std::vector<std::string>{"dangling", "sink"}));
+    }
+
+    {
+        SCOPED_TRACE("Change Property");
+        observer.finished.clear();
+        src.prop.set(42);
+        srcInst.checkAndReset({.process = 1, .propModified = 1});
+        prcInst.checkAndReset({});
+        dngInst.checkAndReset({.process = 1});
+        snkInst.checkAndReset({.process = 1});
+        EXPECT_EQ(*snk.inport.getData(), 42);
+        EXPECT_EQ(observer.finished, (std::vector<std::string>{"source", "dangling", "sink"}));
+    }
+}
+
+TEST(NetworkEvaluator, Reorder) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    const auto forward = [](TestProcessor& p) {
+        p.outport.setData(std::make_shared<int>(*p.inport.getData() + 1));
+    };
+    auto source = createSource("source", {.onProcess = [](TestProcessor& p) {
+                                   p.outport.setData(std::make_shared<int>(0));
+                               }});
+    auto processor1 = createProcessor("processor1", {.onProcess = forward});
+    auto processor2 = createProcessor("processor2", {.onProcess = forward});
+    auto sink = createSink("sink");
+
+    auto& src = *source;
+    auto& prc1 = *processor1;
+    auto& prc2 = *processor2;
+    auto& snk = *sink;
+
+    FinishedObserver observer;
+    for (auto* p : std::initializer_list<Processor*>{&src, &prc1, &prc2, &snk}) {
+        p->ProcessorObservable::addObserver(&observer);
+    }
+
+    {
+        // Connect two separate chains in the middle, both already being connected on the far side
+        const NetworkLock lock{&network};
+        network.addProcessor(std::move(sink));
+        network.addProcessor(std::move(processor2));
+        network.addProcessor(std::move(processor1));
+        network.addProcessor(std::move(source));
+        network.addConnection(&prc2.outport, &snk.inport);
+        network.addConnection(&src.outport, &prc1.inport);
+        network.addConnection(&prc1.outport, &prc2.inport);
+    }
+
+    EXPECT_EQ(*snk.inport.getData(), 2);
+    EXPECT_EQ(observer.finished,
+              (std::vector<std::string>{"source", "processor1", "processor2", "sink"}));
+}
@@ -0,0 +1,103 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/inviwofileformattypes.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+struct TempFile {
+    TempFile()
+        : path{std::filesystem::temp_directory_path() /
+               (std::string{"inviwo-rawvolumeramloader-"} +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".raw")} {}
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+    std::filesystem::path path;
+};
+
+}  // namespace
+
+TEST(RawVolumeRAMLoader, MappedDataIsCopiedOnEdit) {
+    const TempFile tmp;
+    const size3_t dims{4, 3, 2};
+    std::vector<std::uint16_t> data(glm::compMul(dims));
+    std::iota(data.begin(), data.end(), std::uint16_t{0});
+    {
+        std::ofstream out{tmp.path, std::ios::binary};
+        out.write(reinterpret_cast<const char*>(data.data()),
+                  static_cast<std::streamsize>(data.size() * sizeof(std::uint16_t)));
+    }
+
+    const auto byteOrder = std::endian::native == std::endian::little ? ByteOrder::LittleEndian
+                                                                        : ByteOrder::BigEndian;
+    const RawVolumeRAMLoader loader{tmp.path, 0, byteOrder, Compression::Disabled,
+                                    MemoryMapping::Enabled};
+    const VolumeDisk disk{dims, DataUInt16::get()};
+
+    auto first = std::static_pointer_cast<VolumeRAMPrecision<std::uint16_t>>(
+        loader.createRepresentation(disk));
+    auto second = std::static_pointer_cast<VolumeRAMPrecision<std::uint16_t>>(
+        loader.createRepresentation(disk));
+
+    const auto& constFirst = *first;
+    const auto& constSecond = *second;
+    EXPECT_EQ(constFirst.getDataTyped(), constSecond.getDataTyped());
+
+    first->getDataTyped()[0] = 1234;
+    EXPECT_NE(constFirst.getDataTyped(), constSecond.getDataTyped());
+    EXPECT_EQ(constFirst.getDataTyped()[0], 1234);
+    EXPECT_EQ(constSecond.getDataTyped()[0], 0);
+    for (size_t i = 1; i < data.size(); ++i) {
+        EXPECT_EQ(constFirst.getDataTyped()[i], data[i]);
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,146 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/imagesampler.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<Volume> createVolume(size3_t dims) {
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dims);
+    std::mt19937 rand{0};
+    std::uniform_int_distribution<int> dist{0, 100};
+    auto data = ram->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        data[i] = util::glm_convert<T>(dvec4{dist(rand), dist(rand), dist(rand), dist(rand)});
+    }
+    return std::make_shared<Volume>(ram);
+}
+
+std::vector<dvec3> randomPositions(size_t count, double min, double max) {
+    std::mt19937 rand{1};
+    std::uniform_real_distribution<double> dist{min, max};
+    std::vector<dvec3> positions(count);
+    for (auto& p : positions) p = dvec3{dist(rand), dist(rand), dist(rand)};
+    // include the corners
+    positions.emplace_back(0.0, 0.0, 0.0);
+    positions.emplace_back(1.0, 1.0, 1.0);
+    return positions;
+}
+
+template <typename T>
+double maxAbsDiff(const T& a, const T& b) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::abs(a - b);
+    } else {
+        return glm::compMax(glm::abs(a - b));
+    }
+}
+
+template <typename ReturnType>
+void expectBatchMatches(const SpatialSampler<ReturnType>& sampler,
+                        const std::vector<dvec3>& positions, CoordinateSpace space) {
+    std::vector<ReturnType> result(positions.size());
+    sampler.sample(positions, result, space);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_NEAR(maxAbsDiff(result[i], sampler.sample(positions[i], space)), 0.0, 1e-12)
+            << "at position " << i;
+    }
+}
+
+}  // namespace
+
+TEST(SpatialSampler, VolumeBatchMatchesSingle) {
+    const auto positions = randomPositions(500, -0.1, 1.1);
+    for (const auto& volume :
+         {createVolume<unsigned char>(size3_t{7, 5, 3}), createVolume<float>(size3_t{4, 9, 6}),
+          createVolume<glm::i16vec3>(size3_t{5, 5, 5}), createVolume<dvec4>(size3_t{2, 3, 4})}) {
+        expectBatchMatches(VolumeSampler<double>{volume}, positions, CoordinateSpace::Data);
+        expectBatchMatches(VolumeSampler<dvec3>{volume}, positions, CoordinateSpace::Data);
+        expectBatchMatches(VolumeSampler<dvec4>{volume}, positions, CoordinateSpace::Data);
+        expectBatchMatches(VolumeSampler<dvec4>{volume}, positions, CoordinateSpace::Model);
+    }
+}
+
+TEST(SpatialSampler, VolumeBatchOtherSpace) {
+    auto volume = createVolume<float>(size3_t{6, 6, 6});
+    volume->setModelMatrix(glm::scale(glm::translate(mat4{1.0f}, vec3{1.0f, 2.0f, 3.0f}),
+                                      vec3{2.0f, 0.5f, 3.0f}));
+    const auto positions = randomPositions(1000, 0.0, 3.0);
+
+    const VolumeSampler<double> sampler{volume, CoordinateSpace::Model};
+    std::vector<double> result(positions.size());
+    sampler.sample(positions, result);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_NEAR(result[i], sampler.sample(positions[i]), 1e-12) << "at position " << i;
+    }
+    expectBatchMatches(sampler, positions, CoordinateSpace::World);
+}
+
+TEST(SpatialSampler, ImageBatchMatchesSingle) {
+    const size2_t dims{13, 7};
+    auto ram = std::make_shared<LayerRAMPrecision<glm::u8vec4>>(dims);
+    std::mt19937 rand{0};
+    std::uniform_int_distribution<int> dist{0, 255};
+    for (size_t i = 0; i < dims.x * dims.y; ++i) {
+        ram->getDataTyped()[i] = glm::u8vec4{dist(rand), dist(rand), dist(rand), dist(rand)};
+    }
+    const Layer layer{ram};
+    const auto positions = randomPositions(500, 0.0, 1.0);
+    expectBatchMatches(ImageSampler<dvec4>{&layer}, positions, CoordinateSpace::Data);
+}
+
+TEST(SpatialSampler, BatchSizeMismatchThrows) {
+    const VolumeSampler<double> sampler{createVolume<float>(size3_t{3, 3, 3})};
+    std::vector<dvec3> positions(4);
+    std::vector<double> result(3);
+    EXPECT_THROW(sampler.sample(positions, result), Exception);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,117 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace inviwo {
+
+namespace {
+
+struct TraceRecording {
+    TraceRecording() {
+        TraceRecorder::clear();
+        TraceRecorder::setEnabled(true);
+    }
+    ~TraceRecording() {
+        TraceRecorder::setEnabled(false);
+        TraceRecorder::clear();
+    }
+};
+
+}  // namespace
+
+TEST(TraceRecorder, Disabled) {
+    TraceRecorder::clear();
+    bool evaluated = false;
+    {
+        const TraceScope scope{"test"_sl, [&]() {
+                                   evaluated = true;
+                                   return std::string{"name"};
+                               }};
+    }
+    EXPECT_FALSE(evaluated);
+    EXPECT_TRUE(TraceRecorder::getEvents().empty());
+}
+
+TEST(TraceRecorder, Record) {
+    const TraceRecording recording;
+    {
+        IVW_TRACE("test", "outer");
+        { IVW_TRACE("test", "inner"); }
+    }
+    std::thread{[]() { IVW_TRACE("test", "thread"); }}.join();
+
+    const auto events = TraceRecorder::getEvents();
+    ASSERT_EQ(3, events.size());
+    EXPECT_EQ("outer", events[0].name);
+    EXPECT_EQ("inner", events[1].name);
+    EXPECT_EQ("thread", events[2].name);
+    EXPECT_EQ("test", events[0].category);
+    EXPECT_LE(events[0].start, events[1].start);
+    EXPECT_GE(events[0].duration, events[1].duration);
+    EXPECT_EQ(events[0].thread, events[1].thread);
+    EXPECT_NE(events[0].thread, events[2].thread);
+}
+
+TEST(TraceRecorder, RingBuffer) {
+    const TraceRecording recording;
+    const auto capacity = TraceRecorder::getCapacity();
+    TraceRecorder::setCapacity(4);
+    for (int i = 0; i < 10; ++i) {
+        IVW_TRACE("test", std::to_string(i));
+    }
+    const auto events = TraceRecorder::getEvents();
+    TraceRecorder::setCapacity(capacity);
+
+    ASSERT_EQ(4, events.size());
+    EXPECT_EQ("6", events.front().name);
+    EXPECT_EQ("9", events.back().name);
+}
+
+TEST(TraceRecorder, ChromeTrace) {
+    const TraceRecording recording;
+    { IVW_TRACE("test", "a \"quoted\"\nname"); }
+
+    std::stringstream ss;
+    TraceRecorder::writeChromeTrace(ss);
+    const auto json = ss.str();
+    EXPECT_NE(std::string::npos, json.find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, json.find(R"("name":"a \"quoted\"\nname","cat":"test","ph":"X")"));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,205 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumesequencecache.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <atomic>
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+class CountingLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    explicit CountingLoader(std::shared_ptr<std::atomic<size_t>> loads)
+        : loads_{std::move(loads)} {}
+
+    virtual CountingLoader* clone() const override { return new CountingLoader(*this); }
+
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        ++*loads_;
+        return createVolumeRAM(src.getDimensions(), src.getDataFormat());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {
+        ++*loads_;
+    }
+
+private:
+    std::shared_ptr<std::atomic<size_t>> loads_;
+};
+
+constexpr size3_t dims{8, 8, 8};
+constexpr size_t volumeBytes = 8 * 8 * 8;
+
+std::shared_ptr<VolumeSequence> createSequence(size_t size,
+                                               std::shared_ptr<std::atomic<size_t>> loads) {
+    auto seq = std::make_shared<VolumeSequence>();
+    for (size_t i = 0; i < size; ++i) {
+        auto disk = std::make_shared<VolumeDisk>(dims, DataUInt8::get());
+        disk->setLoader(new CountingLoader(loads));
+        seq->push_back(std::make_shared<Volume>(disk));
+    }
+    return seq;
+}
+
+/**
+ * Prefetching needs a thread pool, make sure there is one for the duration of a test
+ */
+struct EnsurePool {
+    EnsurePool() : size{util::getPoolSize()} {
+        if (size == 0) InviwoApplication::getPtr()->resizePool(2);
+    }
+    ~EnsurePool() {
+        if (size == 0) InviwoApplication::getPtr()->resizePool(0);
+    }
+    size_t size;
+};
+
+}  // namespace
+
+TEST(VolumeSequenceCache, HitsAndMisses) {
+    auto loads = std::make_shared<std::atomic<size_t>>(0);
+    VolumeSequenceCache cache{4 * volumeBytes, 0};
+    cache.setSequence(createSequence(4, loads));
+
+    auto v0 = cache.get(0);
+    ASSERT_TRUE(v0);
+    EXPECT_TRUE(v0->hasRepresentation<VolumeRAM>());
+    cache.get(0);
+    cache.get(1);
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(2u, stats.misses);
+    EXPECT_EQ(2u, stats.loaded);
+    EXPECT_EQ(2 * volumeBytes, stats.bytes);
+    EXPECT_EQ(2u, loads->load());
+    EXPECT_FALSE(cache.get(4));
+}
+
+TEST(VolumeSequenceCache, EvictsLeastRecentlyUsed) {
+    auto loads = std::make_shared<std::atomic<size_t>>(0);
+    auto seq = createSequence(4, loads);
+    VolumeSequenceCache cache{2 * volumeBytes, 0};
+    cache.setSequence(seq);
+
+    cache.get(0);
+    cache.get(1);
+    cache.get(0);
+    cache.get(2);
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(2 * volumeBytes, stats.bytes);
+    EXPECT_TRUE((*seq)[0]->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*seq)[1]->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE((*seq)[1]->hasRepresentation<VolumeDisk>());
+    EXPECT_TRUE((*seq)[2]->hasRepresentation<VolumeRAM>());
+
+    // An evicted volume is reloaded from disk
+    cache.get(1);
+    EXPECT_TRUE((*seq)[1]->hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(4u, loads->load());
+}
+
+TEST(VolumeSequenceCache, KeepsVolumesInUse) {
+    auto loads = std::make_shared<std::atomic<size_t>>(0);
+    auto seq = createSequence(4, loads);
+    VolumeSequenceCache cache{2 * volumeBytes, 0};
+    cache.setSequence(seq);
+
+    const auto v0 = cache.get(0);
+    cache.get(1);
+    cache.get(2);
+
+    // The least recently used volume is still held here, the next one is released instead
+    const auto stats = cache.getStats();
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(2 * volumeBytes, stats.bytes);
+    EXPECT_TRUE(v0->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*seq)[1]->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE((*seq)[2]->hasRepresentation<VolumeRAM>());
+}
+
+TEST(VolumeSequenceCache, Prefetch) {
+    const EnsurePool pool;
+    auto loads = std::make_shared<std::atomic<size_t>>(0);
+    auto seq = createSequence(8, loads);
+    {
+        VolumeSequenceCache cache{8 * volumeBytes, 2};
+        cache.setSequence(seq);
+        cache.get(4);
+        cache.get(3);
+    }
+    // Moving backwards prefetches 2 and 1, moving forwards prefetched 5 and 6
+    EXPECT_TRUE((*seq)[1]->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE((*seq)[2]->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE((*seq)[5]->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*seq)[7]->hasRepresentation<VolumeRAM>());
+}
+
+TEST(VolumeSequenceCache, PrefetchWithinBudget) {
+    const EnsurePool pool;
+    auto loads = std::make_shared<std::atomic<size_t>>(0);
+    auto seq = createSequence(8, loads);
+    VolumeSequenceCache cache{3 * volumeBytes, 0};
+    cache.setSequence(seq);
+
+    cache.get(0);
+    cache.get(1);
+    cache.get(2);
+    cache.setPrefetchCount(2);
+    cache.get(3);
+
+    // The loaded volumes are released before prefetching 4 and 5
+    EXPECT_FALSE((*seq)[0]->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*seq)[1]->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*seq)[2]->hasRepresentation<VolumeRAM>());
+
+    cache.get(4);
+    cache.get(5);
+    const auto stats = cache.getStats();
+    EXPECT_EQ(2u, stats.hits);
+    EXPECT_LE(stats.bytes, 3 * volumeBytes);
+}
+
+}  // namespace inviwo
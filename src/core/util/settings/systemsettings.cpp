@@ -32,6 +32,7 @@
 #include <inviwo/core/util/logstream.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/util/commandlineparser.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
 
@@ -70,6 +71,15 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                               "Useful for gettting a overview of memory usage, "
                               "but comes with a small runtime overhead"_help,
                               false}
+    , enableTracing_{"enableTracing", "Record evaluation trace",
+                     "Record processor evaluation, thread pool jobs, representation conversions, "
+                     "and reader/writer calls into the TraceRecorder, which can be exported as a "
+                     "Chrome trace"_help,
+                     false}
+    , parallelEvaluation_{"parallelEvaluation", "Parallel network evaluation",
+                          "Process thread safe processors of independent network branches "
+                          "concurrently on the thread pool"_help,
+                          false}
     , redirectCout_{"redirectCout", "Redirect cout to LogCentral",
                     "Enabling this means that any std::cout messages will no longer end up in the "
                     "console, which can be confusing. "
@@ -87,7 +97,8 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                   enableGesturesProperty_, enablePickingProperty_, enableSoundProperty_,
                   logStackTraceProperty_, moduleSearchPaths_, runtimeModuleReloading_,
                   breakOnMessage_, breakOnException_, stackTraceInException_,
-                  enableResourceTracking_, redirectCout_, redirectCerr_);
+                  enableResourceTracking_, enableTracing_, parallelEvaluation_, redirectCout_,
+                  redirectCerr_);
 
     logStackTraceProperty_.onChange(
         [this]() { LogCentral::getPtr()->setLogStacktrace(logStackTraceProperty_.get()); });
@@ -111,6 +122,8 @@ SystemSettings::SystemSettings(InviwoApplication* app)
         }
     });
 
+    enableTracing_.onChange([this]() { TraceRecorder::setEnabled(enableTracing_); });
+
     redirectCout_.onChange([this]() {
         if (redirectCout_ && !cout_) {
             if (app_->getCommandLineParser().getLogToConsole()) {
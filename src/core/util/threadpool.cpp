@@ -31,96 +31,219 @@
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace inviwo {
 
 // the constructor just launches some amount of workers
 ThreadPool::ThreadPool(size_t threads, std::function<void()> onThreadStart,
                        std::function<void()> onThreadStop)
     : onThreadStart_{std::move(onThreadStart)}, onThreadStop_{std::move(onThreadStop)} {
-    while (workers.size() < threads) {
-        workers.push_back(std::make_unique<Worker>(*this, workers.size() + 1));
-    }
+    trySetSize(threads);
 }
 
 size_t ThreadPool::trySetSize(size_t size) {
-    while (workers.size() < size) {
-        workers.push_back(std::make_unique<Worker>(*this, workers.size() + 1));
+    {
+        std::unique_lock<std::shared_mutex> lock(workers_mutex);
+        while (workers.size() < size) {
+            workers.push_back(std::make_unique<Worker>(*this, workers.size() + 1));
+        }
+        nworkers = workers.size();
     }
 
-    if (workers.size() > size) {
-        auto active = workers.size();
-        for (auto& worker : workers) {
-            auto exprected = State::Free;
-            if (worker->state.compare_exchange_strong(exprected, State::Stop)) {
-                --active;
-            } else if (exprected == State::Stop || exprected == State::Done) {
-                --active;
+    if (nworkers > size) {
+        {
+            std::shared_lock<std::shared_mutex> lock(workers_mutex);
+            auto active = workers.size();
+            for (auto& worker : workers) {
+                auto exprected = State::Free;
+                if (worker->state.compare_exchange_strong(exprected, State::Stop)) {
+                    --active;
+                } else if (exprected == State::Stop || exprected == State::Done) {
+                    --active;
+                }
+                if (active <= size) break;
             }
-            if (active <= size) break;
+        }
+        {
+            // Take the lock to not miss workers that are about to go to sleep
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            condition.notify_all();
         }
 
-        condition.notify_all();
-
-        std::erase_if(workers, [](const std::unique_ptr<Worker>& worker) {
-            return worker->state == State::Done;
-        });
+        std::vector<std::unique_ptr<Worker>> done;
+        {
+            std::unique_lock<std::shared_mutex> lock(workers_mutex);
+            auto it = std::stable_partition(
+                workers.begin(), workers.end(),
+                [](const std::unique_ptr<Worker>& worker) { return worker->state != State::Done; });
+            std::move(it, workers.end(), std::back_inserter(done));
+            workers.erase(it, workers.end());
+            nworkers = workers.size();
+        }
+        done.clear();  // this will join the finished threads.
     }
-    return workers.size();
+    return nworkers;
 }
 
-size_t ThreadPool::getSize() const { return workers.size(); }
+size_t ThreadPool::getSize() const { return nworkers; }
 
-size_t ThreadPool::getQueueSize() {
-    std::unique_lock<std::mutex> lock(queue_mutex);
-    return tasks.size();
-}
+size_t ThreadPool::getQueueSize() { return pending; }
 
 ThreadPool::~ThreadPool() {
     for (auto& worker : workers) worker->state = State::Abort;
-    condition.notify_all();
-    workers.clear();  // this will join all threads.
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        condition.notify_all();
+    }
+    // join all threads before destroying any worker, the others might still try to steal from it.
+    for (auto& worker : workers) worker->thread.join();
+    workers.clear();
 }
 
-ThreadPool::Worker::~Worker() { thread.join(); }
+ThreadPool::Worker::~Worker() {
+    if (thread.joinable()) thread.join();
+}
 
-ThreadPool::Worker::Worker(ThreadPool& pool, size_t index)
-    : state{State::Free}, thread{[this, &pool, index]() {
+ThreadPool::Worker::Worker(ThreadPool& aPool, size_t aIndex)
+    : state{State::Free}, mutex{}, tasks{}, pool{aPool}, index{aIndex}, thread{[this]() {
         util::setThreadDescription(fmt::format("Inviwo BG {}", index));
+        currentWorker() = this;
         pool.onThreadStart_();
-        util::OnScopeExit cleanup{[&pool]() { pool.onThreadStop_(); }};
+        util::OnScopeExit cleanup{[this]() {
+            pool.onThreadStop_();
+            currentWorker() = nullptr;
+        }};
 
         for (;;) {
-            std::function<void()> task;
-            state = State::Free;
-            {
+            if (state == State::Abort) break;
+
+            Task task;
+            if (!pool.pop(this, task)) {
+                if (state == State::Stop) break;
+
                 std::unique_lock<std::mutex> lock(pool.queue_mutex);
-                pool.condition.wait(lock, [this, &pool] {
-                    return state == State::Abort || state == State::Stop || !pool.tasks.empty();
+                ++pool.sleeping;
+                pool.condition.wait(lock, [this] {
+                    return state == State::Abort || state == State::Stop || pool.pending != 0;
                 });
-                if (state == State::Abort || (state == State::Stop && pool.tasks.empty())) break;
-                task = std::move(pool.tasks.front());
-                pool.tasks.pop();
+                --pool.sleeping;
+                continue;
             }
-            state = State::Working;
+
+            auto expected = State::Free;
+            state.compare_exchange_strong(expected, State::Working);
             try {
+                IVW_TRACE("threadpool", "Task");
                 task();
             } catch (...) {  // Make sure we don't leak any exceptions.
             }
+            expected = State::Working;
+            state.compare_exchange_strong(expected, State::Free);
         }
         state = State::Done;
     }} {}
 
+ThreadPool::Worker*& ThreadPool::currentWorker() {
+    thread_local Worker* worker = nullptr;
+    return worker;
+}
+
+bool ThreadPool::isWorkerThread() const {
+    auto* worker = currentWorker();
+    return worker && &worker->pool == this;
+}
+
+void ThreadPool::push(Task task) {
+    ++pending;
+    if (isWorkerThread()) {
+        auto* self = currentWorker();
+        {
+            std::unique_lock<std::mutex> lock(self->mutex);
+            self->tasks.push_back(std::move(task));
+        }
+        notify();
+    } else {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        tasks.push_back(std::move(task));
+        condition.notify_one();
+    }
+}
+
+void ThreadPool::notify() {
+    // pending is incremented before sleeping is read here, and the workers increment sleeping
+    // before reading pending, so either we see the sleeping worker or it sees the new task.
+    if (sleeping != 0) {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        condition.notify_one();
+    }
+}
+
+bool ThreadPool::pop(Worker* self, Task& task) {
+    if (pending == 0) return false;
+
+    {
+        std::unique_lock<std::mutex> lock(self->mutex);
+        if (!self->tasks.empty()) {
+            task = std::move(self->tasks.back());
+            self->tasks.pop_back();
+            --pending;
+            return true;
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        if (!tasks.empty()) {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            --pending;
+            return true;
+        }
+    }
+    return steal(self, task);
+}
+
+bool ThreadPool::steal(Worker* self, Task& task) {
+    std::shared_lock<std::shared_mutex> lock(workers_mutex);
+    const auto size = workers.size();
+    for (size_t i = 0; i < size; ++i) {
+        auto& victim = workers[(self->index + i) % size];
+        if (victim.get() == self) continue;
+
+        std::unique_lock<std::mutex> victimLock(victim->mutex);
+        if (victim->tasks.empty()) continue;
+        task = std::move(victim->tasks.front());
+        victim->tasks.pop_front();
+        --pending;
+        return true;
+    }
+    return false;
+}
+
+bool ThreadPool::runPendingTask() {
+    if (!isWorkerThread()) return false;
+
+    Task task;
+    if (!pop(currentWorker(), task)) return false;
+    try {
+        IVW_TRACE("threadpool", "Task");
+        task();
+    } catch (...) {  // Make sure we don't leak any exceptions.
+    }
+    return true;
+}
+
 void ThreadPool::enqueueRaw(std::function<void()> task) {
-    if (workers.empty()) {
+    if (getSize() == 0) {
         task();  // No worker threads, just run the task.
     } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace(std::move(task));
+        push(Task{std::move(task)});
     }
-    condition.notify_one();
 }
 
 }  // namespace inviwo
@@ -0,0 +1,232 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+std::atomic<bool> TraceRecorder::enabled_{false};
+
+namespace {
+
+constexpr size_t defaultCapacity = 1 << 14;
+
+struct ThreadBuffer {
+    ThreadBuffer(std::uint32_t aThread, std::string aName, size_t capacity)
+        : thread{aThread}, name{std::move(aName)}, events(capacity) {}
+
+    void push(TraceRecorder::Event&& event) {
+        const std::scoped_lock lock{mutex};
+        if (events.empty()) return;
+        events[next] = std::move(event);
+        next = (next + 1) % events.size();
+        count = std::min(count + 1, events.size());
+    }
+
+    void reset(size_t capacity) {
+        const std::scoped_lock lock{mutex};
+        events.clear();
+        events.resize(capacity);
+        next = 0;
+        count = 0;
+    }
+
+    // Only contended while exporting or clearing
+    std::mutex mutex;
+    std::uint32_t thread;
+    std::string name;
+    std::vector<TraceRecorder::Event> events;
+    size_t next = 0;
+    size_t count = 0;
+};
+
+struct Registry {
+    std::mutex mutex;
+    size_t capacity = defaultCapacity;
+    std::uint32_t nextThread = 0;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& registry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer& threadBuffer() {
+    thread_local const std::shared_ptr<ThreadBuffer> buffer = []() {
+        auto& reg = registry();
+        const std::scoped_lock lock{reg.mutex};
+        auto res = std::make_shared<ThreadBuffer>(reg.nextThread++, util::getThreadDescription(),
+                                                  reg.capacity);
+        reg.buffers.push_back(res);
+        return res;
+    }();
+    return *buffer;
+}
+
+void writeJSONString(std::string_view str, fmt::memory_buffer& buff) {
+    auto out = std::back_inserter(buff);
+    buff.push_back('"');
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                fmt::format_to(out, "\\\"");
+                break;
+            case '\\':
+                fmt::format_to(out, "\\\\");
+                break;
+            case '\n':
+                fmt::format_to(out, "\\n");
+                break;
+            case '\t':
+                fmt::format_to(out, "\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::format_to(out, "\\u{:04x}", static_cast<int>(c));
+                } else {
+                    buff.push_back(c);
+                }
+        }
+    }
+    buff.push_back('"');
+}
+
+}  // namespace
+
+void TraceRecorder::setEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void TraceRecorder::setCapacity(size_t eventsPerThread) {
+    auto& reg = registry();
+    const std::scoped_lock lock{reg.mutex};
+    reg.capacity = eventsPerThread;
+    for (auto& buffer : reg.buffers) {
+        buffer->reset(eventsPerThread);
+    }
+}
+
+size_t TraceRecorder::getCapacity() {
+    auto& reg = registry();
+    const std::scoped_lock lock{reg.mutex};
+    return reg.capacity;
+}
+
+void TraceRecorder::clear() {
+    auto& reg = registry();
+    const std::scoped_lock lock{reg.mutex};
+    // Drop the buffers of threads that have exited
+    std::erase_if(reg.buffers, [](const auto& buffer) { return buffer.use_count() == 1; });
+    for (auto& buffer : reg.buffers) {
+        buffer->reset(reg.capacity);
+    }
+}
+
+void TraceRecorder::record(Literal category, std::string name, clock::time_point start,
+                           clock::time_point end) {
+    auto& buffer = threadBuffer();
+    buffer.push(Event{category.view(), std::move(name), start, end - start, buffer.thread});
+}
+
+std::vector<TraceRecorder::Event> TraceRecorder::getEvents() {
+    std::vector<Event> events;
+    auto& reg = registry();
+    const std::scoped_lock lock{reg.mutex};
+    for (auto& buffer : reg.buffers) {
+        const std::scoped_lock bufferLock{buffer->mutex};
+        const auto size = buffer->events.size();
+        const auto first = (buffer->next + size - buffer->count) % std::max(size, size_t{1});
+        for (size_t i = 0; i < buffer->count; ++i) {
+            events.push_back(buffer->events[(first + i) % size]);
+        }
+    }
+    std::ranges::sort(events, {}, &Event::start);
+    return events;
+}
+
+void TraceRecorder::writeChromeTrace(std::ostream& os) {
+    const auto events = getEvents();
+
+    const auto micro = [](auto duration) {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    };
+    const auto origin = events.empty() ? clock::time_point{} : events.front().start;
+
+    fmt::memory_buffer buff;
+    auto out = std::back_inserter(buff);
+    fmt::format_to(out, "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    {
+        auto& reg = registry();
+        const std::scoped_lock lock{reg.mutex};
+        for (auto& buffer : reg.buffers) {
+            if (buffer->name.empty()) continue;
+            fmt::format_to(out, "{}\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},",
+                           first ? "" : ",", buffer->thread);
+            fmt::format_to(out, "\"args\":{{\"name\":");
+            writeJSONString(buffer->name, buff);
+            fmt::format_to(out, "}}}}");
+            first = false;
+        }
+    }
+    for (const auto& event : events) {
+        fmt::format_to(out, "{}\n{{\"name\":", first ? "" : ",");
+        writeJSONString(event.name, buff);
+        fmt::format_to(out, ",\"cat\":");
+        writeJSONString(event.category, buff);
+        fmt::format_to(out, ",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                       micro(event.start - origin), micro(event.duration), event.thread);
+        first = false;
+    }
+    fmt::format_to(out, "\n]}}\n");
+    os.write(buff.data(), static_cast<std::streamsize>(buff.size()));
+}
+
+void TraceRecorder::writeChromeTrace(const std::filesystem::path& path) {
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    if (!file) {
+        throw FileException(SourceContext{}, "Could not open file {} for writing", path);
+    }
+    writeChromeTrace(file);
+}
+
+}  // namespace inviwo
@@ -28,7 +28,11 @@
  *********************************************************************************/
 
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/io/serialization/ticpp.h>
+#include <inviwo/core/network/networklock.h>
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/util/rendercontext.h>
 #include <inviwo/qt/applicationbase/undomanager.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/filesystem.h>
@@ -49,6 +53,10 @@
 #include <vector>
 #include <string>
 #include <filesystem>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <iterator>
 
 #include <fmt/format.h>
 #include <fmt/chrono.h>
@@ -182,6 +190,60 @@ private:
     std::thread saver_;
 };
 
+namespace {
+
+using Xml = std::shared_ptr<const std::pmr::string>;
+/// The src and dst paths of a connection or a link
+using Endpoints = std::pair<std::string, std::string>;
+
+std::set<Endpoints> endpoints(const TiXmlElement& list) {
+    std::set<Endpoints> res;
+    for (const auto* item = list.FirstChildElement(); item; item = item->NextSiblingElement()) {
+        res.emplace(item->GetAttribute("src"), item->GetAttribute("dst"));
+    }
+    return res;
+}
+
+std::vector<Endpoints> difference(const std::set<Endpoints>& a, const std::set<Endpoints>& b) {
+    std::vector<Endpoints> res;
+    std::ranges::set_difference(a, b, std::back_inserter(res));
+    return res;
+}
+
+}  // namespace
+
+/**
+ * The saved workspace split into the serialized state of each processor, the connections, the
+ * links, and everything else.
+ */
+struct UndoManager::State {
+    Xml xml;
+    std::string version;
+    std::map<std::string, Xml, std::less<>> processors;
+    std::set<Endpoints> connections;
+    std::set<Endpoints> links;
+    std::pmr::string other;
+};
+
+/**
+ * The difference between two consecutive states. Processors missing before or after the change
+ * have a null state. If anything but the network changed, the full workspaces are stored too.
+ */
+struct UndoManager::Step {
+    struct ProcessorChange {
+        std::string identifier;
+        Xml before;
+        Xml after;
+    };
+    std::vector<ProcessorChange> processors;
+    std::vector<Endpoints> addedConnections;
+    std::vector<Endpoints> removedConnections;
+    std::vector<Endpoints> addedLinks;
+    std::vector<Endpoints> removedLinks;
+    Xml beforeWorkspace;
+    Xml afterWorkspace;
+};
+
 UndoManager::UndoManager(WorkspaceManager* wm, ProcessorNetwork* network,
                          std::function<int()> numRestoreFiles,
                          std::function<int()> restoreFrequency)
@@ -227,55 +289,212 @@ void UndoManager::pushStateIfDirty() {
 }
 void UndoManager::markDirty() { dirty_ = true; }
 
-void UndoManager::pushState() {
-    if (isRestoring) return;
-
+std::unique_ptr<UndoManager::State> UndoManager::saveState() {
     auto str = std::make_shared<std::pmr::string>();
     str->reserve(8 * 1024);
+    manager_->save(
+        *str, refPath_, [](SourceContext) -> void { throw; }, WorkspaceSaveMode::Undo);
 
+    if (current_ && *str == *current_->xml) return nullptr;  // No Change
+
+    auto state = std::make_unique<State>();
+    state->xml = str;
+
+    TxDocument doc;
+    doc.Parse(str->c_str());
+    const auto* root = doc.RootElement();
+    if (!root) throw Exception(SourceContext{}, "No XML root node found in undo state");
+    state->version = root->GetAttribute("version");
+
+    for (const auto* elem = root->FirstChildElement(); elem; elem = elem->NextSiblingElement()) {
+        if (elem->Value() != "ProcessorNetwork") {
+            state->other << *elem;
+            continue;
+        }
+        for (const auto* item = elem->FirstChildElement(); item;
+             item = item->NextSiblingElement()) {
+            if (item->Value() == "Processors") {
+                for (const auto* p = item->FirstChildElement(); p; p = p->NextSiblingElement()) {
+                    auto identifier = p->GetAttribute("identifier");
+                    auto frag = std::make_shared<std::pmr::string>();
+                    *frag << *p;
+                    // Share the unchanged states with the previous state
+                    if (current_) {
+                        if (auto it = current_->processors.find(identifier);
+                            it != current_->processors.end() && *it->second == *frag) {
+                            state->processors.emplace(std::move(identifier), it->second);
+                            continue;
+                        }
+                    }
+                    state->processors.emplace(std::move(identifier), std::move(frag));
+                }
+            } else if (item->Value() == "Connections") {
+                state->connections = endpoints(*item);
+            } else if (item->Value() == "PropertyLinks") {
+                state->links = endpoints(*item);
+            } else {
+                state->other << *item;
+            }
+        }
+    }
+    return state;
+}
+
+void UndoManager::pushState() {
+    if (isRestoring) return;
+
+    std::unique_ptr<State> state;
     try {
-        manager_->save(
-            *str, refPath_, [](SourceContext) -> void { throw; }, WorkspaceSaveMode::Undo);
+        state = saveState();
     } catch (...) {
         return;
     }
-
     dirty_ = false;
-    if (head_ >= 0 && *str == *undoBuffer_[head_]) return;  // No Change
+    if (!state) return;  // No Change
+
+    if (current_) {
+        Step step;
+        for (const auto& [identifier, before] : current_->processors) {
+            const auto it = state->processors.find(identifier);
+            if (it == state->processors.end()) {
+                step.processors.push_back({identifier, before, nullptr});
+            } else if (it->second != before) {
+                step.processors.push_back({identifier, before, it->second});
+            }
+        }
+        for (const auto& [identifier, after] : state->processors) {
+            if (!current_->processors.contains(identifier)) {
+                step.processors.push_back({identifier, nullptr, after});
+            }
+        }
+        step.addedConnections = difference(state->connections, current_->connections);
+        step.removedConnections = difference(current_->connections, state->connections);
+        step.addedLinks = difference(state->links, current_->links);
+        step.removedLinks = difference(current_->links, state->links);
+        if (state->other != current_->other || state->version != current_->version) {
+            step.beforeWorkspace = current_->xml;
+            step.afterWorkspace = state->xml;
+        }
 
-    ++head_;
-    auto offset = std::min(std::distance(undoBuffer_.begin(), undoBuffer_.end()), head_);
-    undoBuffer_.erase(undoBuffer_.begin() + offset, undoBuffer_.end());
-    undoBuffer_.push_back(str);
+        undoBuffer_.erase(undoBuffer_.begin() + (head_ + 1), undoBuffer_.end());
+        undoBuffer_.push_back(std::move(step));
+        ++head_;
+    }
+    current_ = std::move(state);
 
     if (!network_->empty()) {
-        autoSaver_->save(str);
+        autoSaver_->save(current_->xml);
     }
 
     updateActions();
 }
-void UndoManager::undoState() {
-    if (head_ > 0) {
-        util::KeepTrueWhileInScope restore(&isRestoring);
-        --head_;
 
-        manager_->load(*undoBuffer_[head_], refPath_, StandardExceptionHandler{},
-                       WorkspaceSaveMode::Undo);
+void UndoManager::apply(const Step& step, bool forward) {
+    util::KeepTrueWhileInScope restore(&isRestoring);
+
+    if (const auto& workspace = forward ? step.afterWorkspace : step.beforeWorkspace) {
+        manager_->load(*workspace, refPath_, StandardExceptionHandler{}, WorkspaceSaveMode::Undo);
+    } else {
+        try {
+            applyInPlace(step, forward);
+        } catch (const Exception& e) {
+            log::exception(e);
+        } catch (const std::exception& e) {
+            log::error("Error applying undo step: {}", e.what());
+        }
+    }
 
-        dirty_ = false;
-        updateActions();
+    // Resynchronize with the network, if the step could not be fully applied the current state
+    // will differ from the state stored in the undo buffer.
+    try {
+        if (auto state = saveState()) current_ = std::move(state);
+    } catch (...) {
+        log::error("Error saving the workspace state after undo");
     }
+    dirty_ = false;
 }
-void UndoManager::redoState() {
-    if (head_ >= -1 && head_ < static_cast<DiffType>(undoBuffer_.size()) - 1) {
 
-        util::KeepTrueWhileInScope restore(&isRestoring);
-        ++head_;
+void UndoManager::applyInPlace(const Step& step, bool forward) {
+    const auto& addedConnections = forward ? step.addedConnections : step.removedConnections;
+    const auto& removedConnections = forward ? step.removedConnections : step.addedConnections;
+    const auto& addedLinks = forward ? step.addedLinks : step.removedLinks;
+    const auto& removedLinks = forward ? step.removedLinks : step.addedLinks;
+
+    RenderContext::getPtr()->activateDefaultRenderContext();
+    const NetworkLock lock{network_};
+
+    for (const auto& [src, dst] : removedLinks) {
+        auto* source = network_->getProperty(src);
+        auto* destination = network_->getProperty(dst);
+        if (source && destination) network_->removeLink(source, destination);
+    }
+    for (const auto& [src, dst] : removedConnections) {
+        auto* outport = network_->getOutport(src);
+        auto* inport = network_->getInport(dst);
+        if (outport && inport) network_->removeConnection(outport, inport);
+    }
+
+    std::pmr::string updated;
+    std::pmr::string created;
+    std::vector<Processor*> existing;
+    for (const auto& change : step.processors) {
+        const auto& target = forward ? change.after : change.before;
+        auto* processor = network_->getProcessorByIdentifier(change.identifier);
+        if (!target) {
+            if (processor) network_->removeProcessor(processor);
+        } else if (processor) {
+            updated.append(*target);
+            existing.push_back(processor);
+        } else {
+            created.append(*target);
+        }
+    }
 
-        manager_->load(*undoBuffer_[head_], refPath_, StandardExceptionHandler{},
-                       WorkspaceSaveMode::Undo);
+    const auto deserializer = [&](std::string_view processors) {
+        const std::pmr::string xml{fmt::format(
+            R"(<InviwoWorkspace version="{}"><Processors>{}</Processors></InviwoWorkspace>)",
+            current_->version, processors)};
+        return std::move(manager_->createWorkspaceDeserializerAndInfo(xml, refPath_).first);
+    };
+
+    if (!updated.empty()) {
+        auto d = deserializer(updated);
+        d.deserializeRange("Processors", "Processor", [&](Deserializer& nested, size_t i) {
+            existing[i]->deserialize(nested);
+        });
+    }
+    if (!created.empty()) {
+        auto d = deserializer(created);
+        std::vector<std::shared_ptr<Processor>> processors;
+        d.deserialize("Processors", processors, "Processor");
+        for (auto& processor : processors) {
+            network_->addProcessor(processor);
+        }
+    }
 
-        dirty_ = false;
+    for (const auto& [src, dst] : addedConnections) {
+        auto* outport = network_->getOutport(src);
+        auto* inport = network_->getInport(dst);
+        if (outport && inport) network_->addConnection(outport, inport);
+    }
+    for (const auto& [src, dst] : addedLinks) {
+        auto* source = network_->getProperty(src);
+        auto* destination = network_->getProperty(dst);
+        if (source && destination) network_->addLink(source, destination);
+    }
+}
+
+void UndoManager::undoState() {
+    if (head_ >= 0 && current_) {
+        apply(undoBuffer_[head_], false);
+        --head_;
+        updateActions();
+    }
+}
+void UndoManager::redoState() {
+    if (head_ + 1 < static_cast<DiffType>(undoBuffer_.size()) && current_) {
+        ++head_;
+        apply(undoBuffer_[head_], true);
         updateActions();
     }
 }
@@ -283,6 +502,7 @@ void UndoManager::redoState() {
 void UndoManager::clear() {
     head_ = -1;
     undoBuffer_.clear();
+    current_.reset();
 }
 
 QAction* UndoManager::getUndoAction() const { return undoAction_; }
@@ -305,8 +525,8 @@ void UndoManager::restore() {
 }
 
 void UndoManager::updateActions() {
-    undoAction_->setEnabled(head_ > 0);
-    redoAction_->setEnabled(head_ >= -1 && head_ < static_cast<DiffType>(undoBuffer_.size()) - 1);
+    undoAction_->setEnabled(head_ >= 0);
+    redoAction_->setEnabled(head_ + 1 < static_cast<DiffType>(undoBuffer_.size()));
 }
 
 #include <warn/push>